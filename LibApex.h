@@ -23,6 +23,8 @@ END_JUCE_MODULE_DECLARATION
 
 #include "src/base/StandardIncludes.h"
 #include "src/dsp/WaveShaper.h"
+#include "src/dsp/WaveShaperADAA.h"
+#include "src/dsp/WaveshaperTable.h"
 #include "src/dsp/dynamics/DynamicsState.h"
 #include "src/dsp/dynamics/gaincomputers/GainComputer.h"
 #include "src/dsp/dynamics/gaincomputers/GainComputerCompressor.h"
@@ -40,7 +42,16 @@ END_JUCE_MODULE_DECLARATION
 #include "src/dsp/dynamics/sidechains/Sidechain1176.h"
 #include "src/dsp/dynamics/sidechains/SidechainModernBus.h"
 #include "src/dsp/dynamics/sidechains/SidechainSSL.h"
+#include "src/dsp/filters/BiQuadBank.h"
+#include "src/dsp/filters/BiQuadBatch.h"
+#include "src/dsp/filters/BiQuadCascade.h"
+#include "src/dsp/filters/BiQuadChunked.h"
 #include "src/dsp/filters/BiQuadFilter.h"
+#include "src/dsp/filters/DitherQuantizer.h"
+#include "src/dsp/filters/HalfBandFIR.h"
+#include "src/dsp/filters/HalfBandIIR.h"
+#include "src/dsp/filters/ResponseGrid.h"
+#include "src/dsp/filters/StateVariableFilter.h"
 #include "src/dsp/gainstages/GainStage.h"
 #include "src/dsp/gainstages/GainStageFET.h"
 #include "src/dsp/gainstages/GainStageVCA.h"
@@ -50,8 +61,10 @@ END_JUCE_MODULE_DECLARATION
 #include "src/dsp/processors/BaseCompressor.h"
 #include "src/dsp/processors/Compressor1176.h"
 #include "src/dsp/processors/EQBand.h"
+#include "src/dsp/processors/EQCurve.h"
 #include "src/dsp/processors/Gain.h"
 #include "src/dsp/processors/OverSampler.h"
+#include "src/dsp/processors/OversampledProcessor.h"
 #include "src/dsp/processors/ParallelEQBand.h"
 #include "src/dsp/processors/Processor.h"
 #include "src/ui/ApexComboBox.h"
@@ -64,3 +77,4 @@ END_JUCE_MODULE_DECLARATION
 #include "src/ui/ApexToggleButton.h"
 #include "src/utils/synchronization/ReadWriteLock.h"
 #include "src/utils/synchronization/ScopedLockGuard.h"
+#include "src/utils/synchronization/TripleBuffer.h"
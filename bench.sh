@@ -0,0 +1,3 @@
+#!/bin/zsh
+
+cd build && ./ApexBench --gtest_color=yes
@@ -3,12 +3,14 @@
 #include <gsl/gsl>
 #include <memory>
 
+#include "../math/Accuracy.h"
 #include "../math/Constants.h"
 #include "../math/Decibels.h"
 #include "../math/Exponentials.h"
 #include "../math/Frequency.h"
 #include "../math/General.h"
 #include "../math/Random.h"
+#include "../math/RandomBank.h"
 #include "../math/TrigFuncs.h"
 #include "../utils/Concepts.h"
 #include "../utils/Error.h"
@@ -72,6 +74,7 @@ namespace apex {
 	using apex::utils::Some;
 	using apex::utils::Span;
 
+	using apex::math::Accuracy;
 	using apex::math::Constants;
 	using apex::math::Decibels;
 	using apex::math::Exponentials;
@@ -1,13 +1,26 @@
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <type_traits>
 
 #include "../math/Exponentials.h"
 #include "../math/General.h"
+#include "../utils/Span.h"
 
 namespace apex::dsp::waveshapers {
 	using math::Exponentials;
 	using math::General;
+	using utils::Span;
+
+	/// The number of samples the block waveshapers process per pass of their inner loops
+	static const constexpr size_t WAVESHAPER_CHUNK_SIZE = 64;
+	/// Below this, the antiderivatives of soft clipping are calculated from series, because
+	/// their closed forms are small differences of much larger terms. Above it, the terms are
+	/// at most a few hundred times the difference, whatever order fast-math sums them in
+	static const constexpr double ANTIDERIVATIVE_SERIES_LIMIT = 0.25;
+	/// The number of terms of those series, enough for double precision below the limit
+	static const constexpr size_t ANTIDERIVATIVE_SERIES_TERMS = 25;
 
 	/// @brief Calculates the resulting value from applying soft saturation to the input
 	///
@@ -57,4 +70,221 @@ namespace apex::dsp::waveshapers {
 		auto signX = x / General<FloatType>::abs(x);
 		return (General<FloatType>::abs(x) > clipLevel ? clipLevel * signX : x);
 	}
+
+	/// @brief Applies soft saturation to a block of samples. The same function as the single
+	/// sample version, but evaluated more accurately: the absolute value is exact, and the block
+	/// `Exponentials::pow` is accurate over the whole input range.
+	///
+	/// The block is processed in chunks: the magnitudes of a chunk are raised to `slope` with
+	/// the branch-free, vectorizable block `Exponentials::pow`, then combined with the input in
+	/// a second vectorizable loop
+	///
+	/// @param input - The input to apply saturation to
+	/// @param output - Where to write the saturated values; Must be the same size as `input`,
+	/// and may be the same memory
+	/// @param amount - The amount of saturation
+	/// @param slope - The slope of the saturation
+	template<typename FloatType = float,
+			 typename Enable = std::enable_if_t<std::is_floating_point_v<FloatType>, bool>>
+	inline static auto softSaturation(Span<const FloatType> input,
+									  Span<FloatType> output,
+									  FloatType amount = static_cast<FloatType>(1.0),
+									  FloatType slope = static_cast<FloatType>(0.4)) noexcept
+		-> void {
+		const auto gain = static_cast<FloatType>(1.0) + amount;
+		const auto size = input.size();
+		auto magnitudes = std::array<FloatType, WAVESHAPER_CHUNK_SIZE>();
+		for(size_t offset = 0; offset < size; offset += WAVESHAPER_CHUNK_SIZE) {
+			const auto chunkSize = General<size_t>::min(WAVESHAPER_CHUNK_SIZE, size - offset);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto* in = input.data() + offset;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			auto* out = output.data() + offset;
+			for(size_t index = 0; index < chunkSize; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto sample = in[index];
+				magnitudes.at(index) = sample < static_cast<FloatType>(0.0) ? -sample : sample;
+			}
+			Exponentials<FloatType>::pow(
+				Span<const FloatType>::MakeSpan(magnitudes.data(), chunkSize),
+				slope,
+				Span<FloatType>::MakeSpan(magnitudes.data(), chunkSize));
+			for(size_t index = 0; index < chunkSize; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[index] = in[index] * gain
+							 / (static_cast<FloatType>(1.0) + amount * magnitudes.at(index));
+			}
+		}
+	}
+
+	/// @brief Applies soft clipping to a block of samples. The same function as the single
+	/// sample version, but with an exact absolute value. Branch-free, so the compiler can
+	/// vectorize it
+	///
+	/// @param input - The input to apply soft clipping to
+	/// @param output - Where to write the clipped values; Must be the same size as `input`, and
+	/// may be the same memory
+	/// @param amount - The amount of clipping
+	template<typename FloatType = float,
+			 typename Enable = std::enable_if_t<std::is_floating_point_v<FloatType>, bool>>
+	inline static auto softClip(Span<const FloatType> input,
+								Span<FloatType> output,
+								FloatType amount = static_cast<FloatType>(1.0)) noexcept -> void {
+		const auto gain = static_cast<FloatType>(1.0) + amount;
+		const auto* in = input.data();
+		auto* out = output.data();
+		const auto size = input.size();
+		for(size_t index = 0; index < size; ++index) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto sample = in[index];
+			const auto magnitude = sample < static_cast<FloatType>(0.0) ? -sample : sample;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			out[index] = sample * gain / (static_cast<FloatType>(1.0) + amount * magnitude);
+		}
+	}
+
+	/// @brief Applies hard clipping to a block of samples. The same function as the single
+	/// sample version, but with an exact absolute value. Branch-free, so the compiler can
+	/// vectorize it
+	///
+	/// @param input - The input to apply clipping to
+	/// @param output - Where to write the clipped values; Must be the same size as `input`, and
+	/// may be the same memory
+	/// @param clipLevel - The hard clip level, in the linear domain
+	/// @param amount - The amount of clipping
+	template<typename FloatType = float,
+			 typename Enable = std::enable_if_t<std::is_floating_point_v<FloatType>, bool>>
+	inline static auto hardClip(Span<const FloatType> input,
+								Span<FloatType> output,
+								FloatType clipLevel,
+								FloatType amount = static_cast<FloatType>(1.0)) noexcept -> void {
+		const auto gain = static_cast<FloatType>(1.0) + amount;
+		const auto* in = input.data();
+		auto* out = output.data();
+		const auto size = input.size();
+		for(size_t index = 0; index < size; ++index) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto sample = in[index];
+			const auto magnitude = sample < static_cast<FloatType>(0.0) ? -sample : sample;
+			const auto shaped = sample * gain / (static_cast<FloatType>(1.0) + amount * magnitude);
+			const auto shapedMagnitude = shaped < static_cast<FloatType>(0.0) ? -shaped : shaped;
+			const auto sign = shaped < static_cast<FloatType>(0.0) ? static_cast<FloatType>(-1.0) :
+																	   static_cast<FloatType>(1.0);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			out[index] = shapedMagnitude > clipLevel ? clipLevel * sign : shaped;
+		}
+	}
+
+	/// @brief Calculates the antiderivative of soft clipping that is zero at zero, ie the
+	/// integral of the block `softClip` (which has an exact absolute value) from zero to the
+	/// input. Used for antiderivative anti-aliasing
+	///
+	/// @param input - The input to calculate the antiderivative at
+	/// @param amount - The amount of clipping
+	/// @return - The antiderivative
+	template<typename FloatType = float,
+			 typename Enable = std::enable_if_t<std::is_floating_point_v<FloatType>, bool>>
+	[[nodiscard]] inline static auto
+	softClipAntiderivative(FloatType input, FloatType amount = static_cast<FloatType>(1.0)) noexcept
+		-> FloatType {
+		const auto scaled = amount * (input < static_cast<FloatType>(0.0) ? -input : input);
+		// the antiderivative is (1 + amount) * input^2 * (y - ln(1 + y)) / y^2, for
+		// y = amount * |input|
+		auto ratio = static_cast<FloatType>(0.0);
+		if(scaled < static_cast<FloatType>(ANTIDERIVATIVE_SERIES_LIMIT)) {
+			for(auto term = ANTIDERIVATIVE_SERIES_TERMS; term > 0; --term) {
+				ratio = -scaled * ratio
+						+ static_cast<FloatType>(1.0) / static_cast<FloatType>(term + 1);
+			}
+		}
+		else {
+			ratio = (scaled - std::log1p(scaled)) / (scaled * scaled);
+		}
+		return (static_cast<FloatType>(1.0) + amount) * input * input * ratio;
+	}
+
+	/// @brief Calculates the second antiderivative of soft clipping that is zero at zero, ie
+	/// the integral of `softClipAntiderivative` from zero to the input. Used for second order
+	/// antiderivative anti-aliasing
+	///
+	/// @param input - The input to calculate the antiderivative at
+	/// @param amount - The amount of clipping
+	/// @return - The second antiderivative
+	template<typename FloatType = float,
+			 typename Enable = std::enable_if_t<std::is_floating_point_v<FloatType>, bool>>
+	[[nodiscard]] inline static auto
+	softClipSecondAntiderivative(FloatType input,
+								 FloatType amount = static_cast<FloatType>(1.0)) noexcept
+		-> FloatType {
+		const auto scaled = amount * (input < static_cast<FloatType>(0.0) ? -input : input);
+		// the second antiderivative is
+		// (1 + amount) * input^3 * (y^2 / 2 + y - (1 + y) * ln(1 + y)) / y^3,
+		// for y = amount * |input|
+		auto ratio = static_cast<FloatType>(0.0);
+		if(scaled < static_cast<FloatType>(ANTIDERIVATIVE_SERIES_LIMIT)) {
+			for(auto term = ANTIDERIVATIVE_SERIES_TERMS; term > 0; --term) {
+				ratio = -scaled * ratio
+						+ static_cast<FloatType>(1.0)
+							  / static_cast<FloatType>((term + 1) * (term + 2));
+			}
+		}
+		else {
+			ratio = (scaled * scaled / static_cast<FloatType>(2.0) + scaled
+					 - (static_cast<FloatType>(1.0) + scaled) * std::log1p(scaled))
+					/ (scaled * scaled * scaled);
+		}
+		return (static_cast<FloatType>(1.0) + amount) * input * input * input * ratio;
+	}
+
+	/// @brief Calculates the antiderivative of hard clipping that is zero at zero, ie the
+	/// integral of the block `hardClip` from zero to the input. The clip level must be
+	/// positive. Used for antiderivative anti-aliasing
+	///
+	/// @param input - The input to calculate the antiderivative at
+	/// @param clipLevel - The hard clip level, in the linear domain
+	/// @param amount - The amount of clipping
+	/// @return - The antiderivative
+	template<typename FloatType = float,
+			 typename Enable = std::enable_if_t<std::is_floating_point_v<FloatType>, bool>>
+	[[nodiscard]] inline static auto
+	hardClipAntiderivative(FloatType input,
+						   FloatType clipLevel,
+						   FloatType amount = static_cast<FloatType>(1.0)) noexcept -> FloatType {
+		const auto magnitude = input < static_cast<FloatType>(0.0) ? -input : input;
+		// the soft clipped value reaches the clip level at `clipLevel / headroom`, if at all
+		const auto headroom = static_cast<FloatType>(1.0) + amount - amount * clipLevel;
+		if(headroom <= static_cast<FloatType>(0.0) || magnitude * headroom <= clipLevel) {
+			return softClipAntiderivative<FloatType>(input, amount);
+		}
+		const auto knee = clipLevel / headroom;
+		return softClipAntiderivative<FloatType>(knee, amount) + clipLevel * (magnitude - knee);
+	}
+
+	/// @brief Calculates the second antiderivative of hard clipping that is zero at zero, ie
+	/// the integral of `hardClipAntiderivative` from zero to the input. The clip level must be
+	/// positive. Used for second order antiderivative anti-aliasing
+	///
+	/// @param input - The input to calculate the antiderivative at
+	/// @param clipLevel - The hard clip level, in the linear domain
+	/// @param amount - The amount of clipping
+	/// @return - The second antiderivative
+	template<typename FloatType = float,
+			 typename Enable = std::enable_if_t<std::is_floating_point_v<FloatType>, bool>>
+	[[nodiscard]] inline static auto
+	hardClipSecondAntiderivative(FloatType input,
+								 FloatType clipLevel,
+								 FloatType amount = static_cast<FloatType>(1.0)) noexcept
+		-> FloatType {
+		const auto magnitude = input < static_cast<FloatType>(0.0) ? -input : input;
+		const auto headroom = static_cast<FloatType>(1.0) + amount - amount * clipLevel;
+		if(headroom <= static_cast<FloatType>(0.0) || magnitude * headroom <= clipLevel) {
+			return softClipSecondAntiderivative<FloatType>(input, amount);
+		}
+		const auto knee = clipLevel / headroom;
+		const auto beyond = magnitude - knee;
+		const auto value = softClipSecondAntiderivative<FloatType>(knee, amount)
+						   + softClipAntiderivative<FloatType>(knee, amount) * beyond
+						   + clipLevel * beyond * beyond / static_cast<FloatType>(2.0);
+		return input < static_cast<FloatType>(0.0) ? -value : value;
+	}
 } // namespace apex::dsp::waveshapers
@@ -0,0 +1,722 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../base/StandardIncludes.h"
+#include "WaveShaper.h"
+#include "WaveshaperTable.h"
+
+namespace apex::dsp {
+	/// @brief The order of antiderivative anti-aliasing
+	enum class ADAAOrder
+	{
+		/// Uses the first antiderivative of the shape. Delays the signal by half a sample
+		First = 1,
+		/// Uses the second antiderivative of the shape. Suppresses more aliasing, and dulls the
+		/// top of the band a little more, than `First`. Delays the signal by one sample
+		Second
+	};
+
+	/// @brief Soft clipping (as the block `waveshapers::softClip`) and its closed form
+	/// antiderivatives
+	struct SoftClipAntiderivatives {
+		/// The amount of clipping
+		double amount = 1.0;
+
+		/// @brief Returns the soft clipped input
+		///
+		/// @param input - The input to clip
+		///
+		/// @return - The clipped value
+		[[nodiscard]] inline auto value(double input) const noexcept -> double {
+			return input * (1.0 + amount) / (1.0 + amount * (input < 0.0 ? -input : input));
+		}
+
+		/// @brief Returns the antiderivative that is zero at zero
+		///
+		/// @param input - The input to calculate the antiderivative at
+		///
+		/// @return - The antiderivative
+		[[nodiscard]] inline auto antiderivative(double input) const noexcept -> double {
+			return waveshapers::softClipAntiderivative<double>(input, amount);
+		}
+
+		/// @brief Returns the second antiderivative that is zero at zero
+		///
+		/// @param input - The input to calculate the second antiderivative at
+		///
+		/// @return - The second antiderivative
+		[[nodiscard]] inline auto secondAntiderivative(double input) const noexcept -> double {
+			return waveshapers::softClipSecondAntiderivative<double>(input, amount);
+		}
+	};
+
+	/// @brief Hard clipping (as the block `waveshapers::hardClip`) and its closed form
+	/// antiderivatives
+	struct HardClipAntiderivatives {
+		/// The hard clip level, in the linear domain. Must be positive
+		double clipLevel = 1.0;
+		/// The amount of clipping
+		double amount = 1.0;
+
+		/// @brief Returns the hard clipped input
+		///
+		/// @param input - The input to clip
+		///
+		/// @return - The clipped value
+		[[nodiscard]] inline auto value(double input) const noexcept -> double {
+			const auto shaped
+				= input * (1.0 + amount) / (1.0 + amount * (input < 0.0 ? -input : input));
+			if(shaped > clipLevel) {
+				return clipLevel;
+			}
+			return shaped < -clipLevel ? -clipLevel : shaped;
+		}
+
+		/// @brief Returns the antiderivative that is zero at zero
+		///
+		/// @param input - The input to calculate the antiderivative at
+		///
+		/// @return - The antiderivative
+		[[nodiscard]] inline auto antiderivative(double input) const noexcept -> double {
+			return waveshapers::hardClipAntiderivative<double>(input, clipLevel, amount);
+		}
+
+		/// @brief Returns the second antiderivative that is zero at zero
+		///
+		/// @param input - The input to calculate the second antiderivative at
+		///
+		/// @return - The second antiderivative
+		[[nodiscard]] inline auto secondAntiderivative(double input) const noexcept -> double {
+			return waveshapers::hardClipSecondAntiderivative<double>(input, clipLevel, amount);
+		}
+	};
+
+	/// @brief Soft saturation and its antiderivatives.
+	///
+	/// For slopes other than one or two, soft saturation's antiderivatives aren't elementary
+	/// functions, so the shape is tabulated instead, as a cubic `WaveshaperTable`, and the
+	/// antiderivatives are the exact integrals of the table's polynomials. That keeps the three
+	/// consistent with each other, which antiderivative anti-aliasing relies on: it divides
+	/// differences of the antiderivatives by differences of the input, so independent
+	/// approximations of them would have their errors amplified. Outside the table's range the
+	/// shape is held at its value at the edge, as the table does, and the antiderivatives
+	/// continue accordingly
+	class SoftSaturationAntiderivatives {
+	  public:
+		/// The default range of inputs, from `-DEFAULT_RANGE` to `DEFAULT_RANGE`
+		static const constexpr double DEFAULT_RANGE = 8.0;
+		/// The default number of points the shape is sampled at
+		static const constexpr size_t DEFAULT_NUM_POINTS = 4097;
+
+		/// @brief Constructs the antiderivatives of soft saturation with the given parameters,
+		/// over the default range
+		///
+		/// @param amount - The amount of saturation
+		/// @param slope - The slope of the saturation
+		explicit SoftSaturationAntiderivatives(double amount = 1.0, double slope = 0.4) noexcept
+			: mTable(WaveshaperTable<double>::softSaturation(amount, slope)) {
+			prepare(-DEFAULT_RANGE, DEFAULT_RANGE, DEFAULT_NUM_POINTS);
+		}
+
+		/// @brief Move constructs the given `SoftSaturationAntiderivatives`
+		///
+		/// @param antiderivatives - The `SoftSaturationAntiderivatives` to move
+		SoftSaturationAntiderivatives(SoftSaturationAntiderivatives&& antiderivatives) noexcept
+			= default;
+		~SoftSaturationAntiderivatives() noexcept = default;
+
+		/// @brief Prepares the table for the given range of inputs and resolution, and builds
+		/// it. Allocates, so must not be called on the audio thread
+		///
+		/// @param minInput - The smallest input the table covers
+		/// @param maxInput - The largest input the table covers
+		/// @param numPoints - The number of points to sample the shape at, at least 2
+		inline auto prepare(double minInput, double maxInput, size_t numPoints) noexcept -> void {
+			mTable.prepare(minInput, maxInput, numPoints, WaveshaperInterpolation::Cubic);
+			mFirstConstants.resize(mTable.getNumSegments() + 1);
+			mSecondConstants.resize(mTable.getNumSegments() + 1);
+			build();
+		}
+
+		/// @brief Sets the amount and slope of the saturation, rebuilding the table if either
+		/// changed
+		///
+		/// @param amount - The amount of saturation
+		/// @param slope - The slope of the saturation
+		///
+		/// @return - Whether either changed
+		inline auto setParameters(double amount, double slope) noexcept -> bool {
+			if(amount == mTable.getAmount() && slope == mTable.getSlope()) {
+				return false;
+			}
+			mTable.setAmount(amount);
+			mTable.setSlope(slope);
+			build();
+			return true;
+		}
+
+		/// @brief Returns the amount of saturation
+		///
+		/// @return - The amount
+		[[nodiscard]] inline auto getAmount() const noexcept -> double {
+			return mTable.getAmount();
+		}
+
+		/// @brief Returns the slope of the saturation
+		///
+		/// @return - The slope
+		[[nodiscard]] inline auto getSlope() const noexcept -> double {
+			return mTable.getSlope();
+		}
+
+		/// @brief Returns the saturated input, from the table
+		///
+		/// @param input - The input to saturate
+		///
+		/// @return - The saturated value
+		[[nodiscard]] inline auto value(double input) const noexcept -> double {
+			return mTable.process(input);
+		}
+
+		/// @brief Returns the antiderivative that is zero at zero
+		///
+		/// @param input - The input to calculate the antiderivative at
+		///
+		/// @return - The antiderivative
+		[[nodiscard]] inline auto antiderivative(double input) const noexcept -> double {
+			if(input <= mTable.getMinInput()) {
+				return mFirstConstants.front()
+					   + valueAt(0, 0.0) * (input - mTable.getMinInput());
+			}
+			const auto lastSegment = mTable.getNumSegments() - 1;
+			if(input >= mTable.getMaxInput()) {
+				return mFirstConstants.back()
+					   + valueAt(lastSegment, 1.0) * (input - mTable.getMaxInput());
+			}
+			const auto position = (input - mTable.getMinInput()) / mStep;
+			const auto segment = General<size_t>::min(static_cast<size_t>(position), lastSegment);
+			const auto fraction = position - static_cast<double>(segment);
+			const auto coefficients = getSegment(segment);
+			return mFirstConstants.at(segment)
+				   + mStep * fraction
+						 * (coefficients[0]
+							+ fraction
+								  * (coefficients[1] / 2.0
+									 + fraction
+										   * (coefficients[2] / 3.0
+											  + fraction * coefficients[3] / 4.0)));
+		}
+
+		/// @brief Returns the second antiderivative that is zero at zero
+		///
+		/// @param input - The input to calculate the second antiderivative at
+		///
+		/// @return - The second antiderivative
+		[[nodiscard]] inline auto secondAntiderivative(double input) const noexcept -> double {
+			if(input <= mTable.getMinInput()) {
+				const auto beyond = input - mTable.getMinInput();
+				return mSecondConstants.front() + mFirstConstants.front() * beyond
+					   + valueAt(0, 0.0) * beyond * beyond / 2.0;
+			}
+			const auto lastSegment = mTable.getNumSegments() - 1;
+			if(input >= mTable.getMaxInput()) {
+				const auto beyond = input - mTable.getMaxInput();
+				return mSecondConstants.back() + mFirstConstants.back() * beyond
+					   + valueAt(lastSegment, 1.0) * beyond * beyond / 2.0;
+			}
+			const auto position = (input - mTable.getMinInput()) / mStep;
+			const auto segment = General<size_t>::min(static_cast<size_t>(position), lastSegment);
+			const auto fraction = position - static_cast<double>(segment);
+			return mSecondConstants.at(segment) + mFirstConstants.at(segment) * mStep * fraction
+				   + mStep * mStep * fraction * fraction * secondIntegral(segment, fraction);
+		}
+
+	  private:
+		WaveshaperTable<double> mTable;
+		double mStep = 1.0;
+		/// The antiderivative at the start of each segment, and at the end of the last
+		std::vector<double> mFirstConstants = std::vector<double>();
+		/// The second antiderivative at the start of each segment, and at the end of the last
+		std::vector<double> mSecondConstants = std::vector<double>();
+
+		/// @brief Returns the coefficients of the given segment's polynomial, lowest order first
+		///
+		/// @param segment - The segment
+		///
+		/// @return - The coefficients
+		[[nodiscard]] inline auto getSegment(size_t segment) const noexcept
+			-> std::array<double, 4> {
+			auto coefficients = mTable.getCoefficients();
+			return {coefficients.at(segment * 4),
+					coefficients.at(segment * 4 + 1),
+					coefficients.at(segment * 4 + 2),
+					coefficients.at(segment * 4 + 3)};
+		}
+
+		/// @brief Returns the value of the given segment's polynomial
+		///
+		/// @param segment - The segment
+		/// @param fraction - The position within the segment, from 0 to 1
+		///
+		/// @return - The value
+		[[nodiscard]] inline auto valueAt(size_t segment, double fraction) const noexcept
+			-> double {
+			const auto coefficients = getSegment(segment);
+			return coefficients[0]
+				   + fraction
+						 * (coefficients[1]
+							+ fraction * (coefficients[2] + fraction * coefficients[3]));
+		}
+
+		/// @brief Returns the part of the second integral of the given segment's polynomial that
+		/// doesn't depend on where the segment starts, divided by `(step * fraction)^2`
+		///
+		/// @param segment - The segment
+		/// @param fraction - The position within the segment, from 0 to 1
+		///
+		/// @return - The scaled second integral
+		[[nodiscard]] inline auto secondIntegral(size_t segment, double fraction) const noexcept
+			-> double {
+			const auto coefficients = getSegment(segment);
+			return coefficients[0] / 2.0
+				   + fraction
+						 * (coefficients[1] / 6.0
+							+ fraction
+								  * (coefficients[2] / 12.0
+									 + fraction * coefficients[3] / 20.0));
+		}
+
+		/// @brief Integrates the table's polynomials, segment by segment, then offsets both
+		/// antiderivatives to be zero at zero
+		inline auto build() noexcept -> void {
+			const auto numSegments = mTable.getNumSegments();
+			mStep = (mTable.getMaxInput() - mTable.getMinInput())
+					/ static_cast<double>(numSegments);
+			mFirstConstants.front() = 0.0;
+			for(auto segment = 0U; segment < numSegments; ++segment) {
+				const auto coefficients = getSegment(segment);
+				mFirstConstants.at(segment + 1)
+					= mFirstConstants.at(segment)
+					  + mStep
+							* (coefficients[0] + coefficients[1] / 2.0
+							   + coefficients[2] / 3.0 + coefficients[3] / 4.0);
+			}
+			const auto firstAtZero = antiderivative(0.0);
+			for(auto& constant : mFirstConstants) {
+				constant -= firstAtZero;
+			}
+
+			mSecondConstants.front() = 0.0;
+			for(auto segment = 0U; segment < numSegments; ++segment) {
+				mSecondConstants.at(segment + 1) = mSecondConstants.at(segment)
+												   + mFirstConstants.at(segment) * mStep
+												   + mStep * mStep * secondIntegral(segment, 1.0);
+			}
+			const auto secondAtZero = secondAntiderivative(0.0);
+			for(auto& constant : mSecondConstants) {
+				constant -= secondAtZero;
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SoftSaturationAntiderivatives)
+	};
+
+	/// @brief A waveshaper with antiderivative anti-aliasing (ADAA).
+	///
+	/// Rather than shaping each sample, ADAA outputs the average of the shape over the
+	/// straight line between consecutive inputs, calculated from the shape's antiderivative.
+	/// That suppresses the aliasing of the harmonics the shape adds, without oversampling. The
+	/// second order version averages again, from the second antiderivative, which suppresses
+	/// more. When consecutive inputs are too close for the difference quotients to be
+	/// accurate, the average is taken as the shape (or first antiderivative) at their midpoint
+	/// instead.
+	///
+	/// The calculations are always in double precision: the difference quotients divide small
+	/// differences of the antiderivatives by small differences of the input, and would be
+	/// swamped by rounding errors in single precision.
+	///
+	/// @tparam FloatType - The floating point type to back operations
+	/// @tparam Shape - The shape and its antiderivatives: a type with `value`, `antiderivative`
+	/// and `secondAntiderivative` const member functions, each from a double to a double. The
+	/// antiderivatives must be consistent with each other and with the shape
+	template<typename FloatType,
+			 typename Shape,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class ADAAWaveshaper {
+	  public:
+		/// @brief Move constructs the given `ADAAWaveshaper`
+		///
+		/// @param waveshaper - The `ADAAWaveshaper` to move
+		ADAAWaveshaper(ADAAWaveshaper&& waveshaper) noexcept = default;
+		~ADAAWaveshaper() noexcept = default;
+
+		/// @brief Shapes the given input
+		///
+		/// @param input - The input to shape
+		///
+		/// @return - The shaped value
+		[[nodiscard]] inline auto process(FloatType input) noexcept -> FloatType {
+			return narrow_cast<FloatType>(processSample(static_cast<double>(input)));
+		}
+
+		/// @brief Shapes a block of samples
+		///
+		/// @param input - The input to shape
+		/// @param output - Where to write the shaped values; Must be the same size as `input`,
+		/// and may be the same memory
+		inline auto process(Span<const FloatType> input, Span<FloatType> output) noexcept
+			-> void {
+			jassert(input.size() == output.size());
+			const auto* in = input.data();
+			auto* out = output.data();
+			const auto size = input.size();
+			for(size_t index = 0; index < size; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[index] = narrow_cast<FloatType>(processSample(static_cast<double>(in[index])));
+			}
+		}
+
+		/// @brief Resets the remembered inputs to zero
+		inline auto reset() noexcept -> void {
+			mPrevious = 0.0;
+			mBeforePrevious = 0.0;
+			shapeChanged();
+		}
+
+		/// @brief Sets the order of anti-aliasing
+		///
+		/// @param order - The new order
+		inline auto setOrder(ADAAOrder order) noexcept -> void {
+			mOrder = order;
+			shapeChanged();
+		}
+
+		/// @brief Returns the order of anti-aliasing
+		///
+		/// @return - The order
+		[[nodiscard]] inline auto getOrder() const noexcept -> ADAAOrder {
+			return mOrder;
+		}
+
+		/// @brief Returns the delay this adds to the signal, in samples
+		///
+		/// @return - The latency
+		[[nodiscard]] inline auto getLatency() const noexcept -> FloatType {
+			return mOrder == ADAAOrder::First ? narrow_cast<FloatType>(0.5) :
+												 narrow_cast<FloatType>(1.0);
+		}
+
+		auto operator=(ADAAWaveshaper&& waveshaper) noexcept -> ADAAWaveshaper& = default;
+
+	  protected:
+		Shape mShape;
+
+		/// @brief Constructs an `ADAAWaveshaper` with the given shape
+		///
+		/// @param shape - The shape
+		/// @param order - The order of anti-aliasing
+		ADAAWaveshaper(Shape&& shape, ADAAOrder order) noexcept
+			: mShape(std::move(shape)), mOrder(order) {
+			shapeChanged();
+		}
+
+		/// @brief Recalculates what's remembered of the shape at the previous inputs. Must be
+		/// called whenever `mShape` changes
+		inline auto shapeChanged() noexcept -> void {
+			if(mOrder == ADAAOrder::First) {
+				mPreviousAntiderivative = mShape.antiderivative(mPrevious);
+			}
+			else {
+				mPreviousAntiderivative = mShape.secondAntiderivative(mPrevious);
+				mPreviousQuotient
+					= quotient(mPrevious, mPreviousAntiderivative, mBeforePrevious);
+			}
+		}
+
+	  private:
+		/// Inputs closer together than this are treated as equal
+		static const constexpr double TOLERANCE = 1.0e-5;
+		/// When second order averages back from the midpoint of the outer inputs, its rounding
+		/// errors grow with the inverse square of the offset to the middle input, so offsets
+		/// smaller than this use the shape instead. Its error then grows with the square of
+		/// the offset, and the two are balanced here, well above where fast-math rearranging
+		/// the calculation could change the result
+		static const constexpr double OFFSET_TOLERANCE = 1.0e-3;
+
+		ADAAOrder mOrder = ADAAOrder::First;
+		double mPrevious = 0.0;
+		double mBeforePrevious = 0.0;
+		/// The antiderivative of the order in use, at the previous input
+		double mPreviousAntiderivative = 0.0;
+		/// For second order, the difference quotient of the second antiderivative between the
+		/// previous input and the one before it
+		double mPreviousQuotient = 0.0;
+
+		/// @brief Returns the difference quotient of the second antiderivative between two
+		/// inputs, ie the average of the first antiderivative between them
+		///
+		/// @param input - The later input
+		/// @param secondAntiderivative - The second antiderivative at `input`
+		/// @param previous - The earlier input
+		///
+		/// @return - The difference quotient
+		[[nodiscard]] inline auto
+		quotient(double input, double secondAntiderivative, double previous) const noexcept
+			-> double {
+			const auto delta = input - previous;
+			if(std::abs(delta) < TOLERANCE) {
+				return mShape.antiderivative((input + previous) / 2.0);
+			}
+			return (secondAntiderivative - mShape.secondAntiderivative(previous)) / delta;
+		}
+
+		/// @brief Shapes one sample
+		///
+		/// @param input - The input to shape
+		///
+		/// @return - The shaped value
+		inline auto processSample(double input) noexcept -> double {
+			if(mOrder == ADAAOrder::First) {
+				const auto antiderivative = mShape.antiderivative(input);
+				const auto delta = input - mPrevious;
+				const auto output
+					= std::abs(delta) < TOLERANCE ?
+						  mShape.value((input + mPrevious) / 2.0) :
+						  (antiderivative - mPreviousAntiderivative) / delta;
+				mPrevious = input;
+				mPreviousAntiderivative = antiderivative;
+				return output;
+			}
+
+			const auto secondAntiderivative = mShape.secondAntiderivative(input);
+			const auto delta = input - mPrevious;
+			const auto currentQuotient
+				= std::abs(delta) < TOLERANCE ?
+					  mShape.antiderivative((input + mPrevious) / 2.0) :
+					  (secondAntiderivative - mPreviousAntiderivative) / delta;
+			const auto spread = input - mBeforePrevious;
+			auto output = 0.0;
+			if(std::abs(spread) < TOLERANCE) {
+				// the quotients are of nearly the same interval, so average from the midpoint
+				// of the outer inputs to the middle one instead. That average is weighted
+				// linearly towards the midpoint, so its centroid is two thirds of the way there
+				const auto midpoint = (input + mBeforePrevious) / 2.0;
+				const auto offset = midpoint - mPrevious;
+				output = std::abs(offset) < OFFSET_TOLERANCE ?
+							 mShape.value((2.0 * midpoint + mPrevious) / 3.0) :
+							 2.0 / offset
+								 * (mShape.antiderivative(midpoint)
+									+ (mPreviousAntiderivative
+									   - mShape.secondAntiderivative(midpoint))
+										  / offset);
+			}
+			else {
+				output = 2.0 * (currentQuotient - mPreviousQuotient) / spread;
+			}
+			mBeforePrevious = mPrevious;
+			mPrevious = input;
+			mPreviousAntiderivative = secondAntiderivative;
+			mPreviousQuotient = currentQuotient;
+			return output;
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ADAAWaveshaper)
+	};
+
+	/// @brief Soft clipping (as `waveshapers::softClip`) with antiderivative anti-aliasing
+	///
+	/// @tparam FloatType - The floating point type to back operations
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class SoftClipADAA final : public ADAAWaveshaper<FloatType, SoftClipAntiderivatives> {
+	  public:
+		/// @brief Constructs a `SoftClipADAA` with the given parameters
+		///
+		/// @param amount - The amount of clipping
+		/// @param order - The order of anti-aliasing
+		explicit SoftClipADAA(FloatType amount = narrow_cast<FloatType>(1.0),
+							  ADAAOrder order = ADAAOrder::First) noexcept
+			: ADAAWaveshaper<FloatType, SoftClipAntiderivatives>(
+				SoftClipAntiderivatives{static_cast<double>(amount)},
+				order) {
+		}
+
+		/// @brief Move constructs the given `SoftClipADAA`
+		///
+		/// @param waveshaper - The `SoftClipADAA` to move
+		SoftClipADAA(SoftClipADAA&& waveshaper) noexcept = default;
+		~SoftClipADAA() noexcept = default;
+
+		/// @brief Sets the amount of clipping
+		///
+		/// @param amount - The new amount
+		inline auto setAmount(FloatType amount) noexcept -> void {
+			this->mShape.amount = static_cast<double>(amount);
+			this->shapeChanged();
+		}
+
+		/// @brief Returns the amount of clipping
+		///
+		/// @return - The amount
+		[[nodiscard]] inline auto getAmount() const noexcept -> FloatType {
+			return narrow_cast<FloatType>(this->mShape.amount);
+		}
+
+		auto operator=(SoftClipADAA&& waveshaper) noexcept -> SoftClipADAA& = default;
+
+	  private:
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SoftClipADAA)
+	};
+
+	/// @brief Hard clipping (as `waveshapers::hardClip`) with antiderivative anti-aliasing
+	///
+	/// @tparam FloatType - The floating point type to back operations
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class HardClipADAA final : public ADAAWaveshaper<FloatType, HardClipAntiderivatives> {
+	  public:
+		/// @brief Constructs a `HardClipADAA` with the given parameters
+		///
+		/// @param clipLevel - The hard clip level, in the linear domain. Must be positive
+		/// @param amount - The amount of clipping
+		/// @param order - The order of anti-aliasing
+		explicit HardClipADAA(FloatType clipLevel = narrow_cast<FloatType>(1.0),
+							  FloatType amount = narrow_cast<FloatType>(1.0),
+							  ADAAOrder order = ADAAOrder::First) noexcept
+			: ADAAWaveshaper<FloatType, HardClipAntiderivatives>(
+				HardClipAntiderivatives{static_cast<double>(clipLevel),
+										static_cast<double>(amount)},
+				order) {
+			jassert(clipLevel > narrow_cast<FloatType>(0.0));
+		}
+
+		/// @brief Move constructs the given `HardClipADAA`
+		///
+		/// @param waveshaper - The `HardClipADAA` to move
+		HardClipADAA(HardClipADAA&& waveshaper) noexcept = default;
+		~HardClipADAA() noexcept = default;
+
+		/// @brief Sets the clip level
+		///
+		/// @param clipLevel - The new clip level, in the linear domain. Must be positive
+		inline auto setClipLevel(FloatType clipLevel) noexcept -> void {
+			jassert(clipLevel > narrow_cast<FloatType>(0.0));
+			this->mShape.clipLevel = static_cast<double>(clipLevel);
+			this->shapeChanged();
+		}
+
+		/// @brief Returns the clip level
+		///
+		/// @return - The clip level, in the linear domain
+		[[nodiscard]] inline auto getClipLevel() const noexcept -> FloatType {
+			return narrow_cast<FloatType>(this->mShape.clipLevel);
+		}
+
+		/// @brief Sets the amount of clipping
+		///
+		/// @param amount - The new amount
+		inline auto setAmount(FloatType amount) noexcept -> void {
+			this->mShape.amount = static_cast<double>(amount);
+			this->shapeChanged();
+		}
+
+		/// @brief Returns the amount of clipping
+		///
+		/// @return - The amount
+		[[nodiscard]] inline auto getAmount() const noexcept -> FloatType {
+			return narrow_cast<FloatType>(this->mShape.amount);
+		}
+
+		auto operator=(HardClipADAA&& waveshaper) noexcept -> HardClipADAA& = default;
+
+	  private:
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HardClipADAA)
+	};
+
+	/// @brief Soft saturation (as `waveshapers::softSaturation`) with antiderivative
+	/// anti-aliasing. The shape is tabulated, as described by `SoftSaturationAntiderivatives`,
+	/// so changing the amount or slope rebuilds the table
+	///
+	/// @tparam FloatType - The floating point type to back operations
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class SoftSaturationADAA final
+		: public ADAAWaveshaper<FloatType, SoftSaturationAntiderivatives> {
+	  public:
+		/// @brief Constructs a `SoftSaturationADAA` with the given parameters
+		///
+		/// @param amount - The amount of saturation
+		/// @param slope - The slope of the saturation
+		/// @param order - The order of anti-aliasing
+		explicit SoftSaturationADAA(FloatType amount = narrow_cast<FloatType>(1.0),
+									FloatType slope = narrow_cast<FloatType>(0.4),
+									ADAAOrder order = ADAAOrder::First) noexcept
+			: ADAAWaveshaper<FloatType, SoftSaturationAntiderivatives>(
+				SoftSaturationAntiderivatives(static_cast<double>(amount),
+											  static_cast<double>(slope)),
+				order) {
+		}
+
+		/// @brief Move constructs the given `SoftSaturationADAA`
+		///
+		/// @param waveshaper - The `SoftSaturationADAA` to move
+		SoftSaturationADAA(SoftSaturationADAA&& waveshaper) noexcept = default;
+		~SoftSaturationADAA() noexcept = default;
+
+		/// @brief Prepares the table for the given range of inputs and resolution. Allocates,
+		/// so must not be called on the audio thread
+		///
+		/// @param range - The table covers inputs from `-range` to `range`
+		/// @param numPoints - The number of points to sample the shape at, at least 2
+		inline auto prepare(FloatType range, size_t numPoints) noexcept -> void {
+			this->mShape.prepare(-static_cast<double>(range),
+								 static_cast<double>(range),
+								 numPoints);
+			this->shapeChanged();
+		}
+
+		/// @brief Sets the amount of saturation, rebuilding the table if it changed
+		///
+		/// @param amount - The new amount
+		inline auto setAmount(FloatType amount) noexcept -> void {
+			if(this->mShape.setParameters(static_cast<double>(amount), this->mShape.getSlope()))
+			{
+				this->shapeChanged();
+			}
+		}
+
+		/// @brief Returns the amount of saturation
+		///
+		/// @return - The amount
+		[[nodiscard]] inline auto getAmount() const noexcept -> FloatType {
+			return narrow_cast<FloatType>(this->mShape.getAmount());
+		}
+
+		/// @brief Sets the slope of the saturation, rebuilding the table if it changed
+		///
+		/// @param slope - The new slope
+		inline auto setSlope(FloatType slope) noexcept -> void {
+			if(this->mShape.setParameters(this->mShape.getAmount(), static_cast<double>(slope)))
+			{
+				this->shapeChanged();
+			}
+		}
+
+		/// @brief Returns the slope of the saturation
+		///
+		/// @return - The slope
+		[[nodiscard]] inline auto getSlope() const noexcept -> FloatType {
+			return narrow_cast<FloatType>(this->mShape.getSlope());
+		}
+
+		auto operator=(SoftSaturationADAA&& waveshaper) noexcept -> SoftSaturationADAA& = default;
+
+	  private:
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SoftSaturationADAA)
+	};
+} // namespace apex::dsp
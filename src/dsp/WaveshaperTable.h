@@ -0,0 +1,466 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../base/StandardIncludes.h"
+#include "WaveShaper.h"
+
+namespace apex::dsp {
+	/// @brief How a `WaveshaperTable` interpolates between its points
+	enum class WaveshaperInterpolation
+	{
+		/// Straight lines between neighbouring points. The error is at most `h^2 / 8` times the
+		/// largest second derivative of the shape, where `h` is the spacing of the points
+		Linear = 0,
+		/// Cubics through the four nearest points. The error is at most `3h^4 / 128` times the
+		/// largest fourth derivative of the shape, where `h` is the spacing of the points
+		Cubic
+	};
+
+	/// @brief A waveshaper evaluated from a table, instead of by calling its shaping function for
+	/// every sample.
+	///
+	/// The shape is sampled at evenly spaced points over a configurable range when this is
+	/// prepared, and stored as one polynomial per gap between the points. Evaluating a sample
+	/// then takes a clamp, a few table loads and a short polynomial: no branches, divisions or
+	/// calls to `Exponentials`, so a block of samples vectorizes. Inputs outside the range are
+	/// clamped to it, so the output there is the shape's value at the edge of the range.
+	///
+	/// The interpolation error bounds given by `WaveshaperInterpolation` only hold for shapes
+	/// that are smooth over the range. They don't for a kink (`hardClip`'s clip level) or a
+	/// cusp (`softSaturation`'s with a slope below one, at zero), where the error is limited by
+	/// the spacing of the points instead. So the table also measures its actual error when it
+	/// is built, by comparing it to the shape between every pair of points, and `getMaxError`
+	/// reports it.
+	///
+	/// The shape depends on an amount and a slope, and the table is only rebuilt when one of
+	/// them actually changes. Rebuilding doesn't allocate, but evaluates the shape four times
+	/// per point (once to fit it, three times to measure the error), so parameter changes
+	/// should be rare compared to samples.
+	///
+	/// @tparam FloatType - The floating point type to back operations
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class WaveshaperTable {
+	  public:
+		/// @brief A shaping function, from an input, an amount and a slope to an output
+		using Shape = std::function<FloatType(FloatType input, FloatType amount, FloatType slope)>;
+
+		/// The default range of inputs, from `-DEFAULT_RANGE` to `DEFAULT_RANGE`
+		static const constexpr FloatType DEFAULT_RANGE = narrow_cast<FloatType>(2.0);
+		/// The default number of points the shape is sampled at
+		static const constexpr size_t DEFAULT_NUM_POINTS = 1025;
+
+		/// @brief Constructs a default `WaveshaperTable`, of `softSaturation` with its default
+		/// amount and slope
+		WaveshaperTable() noexcept {
+			prepare(-DEFAULT_RANGE, DEFAULT_RANGE, DEFAULT_NUM_POINTS);
+		}
+
+		/// @brief Constructs a `WaveshaperTable` of the given shape
+		///
+		/// @param shape - The shaping function to tabulate
+		/// @param amount - The initial amount of the shape
+		/// @param slope - The initial slope of the shape
+		explicit WaveshaperTable(Shape shape,
+								 FloatType amount = narrow_cast<FloatType>(1.0),
+								 FloatType slope = narrow_cast<FloatType>(0.4)) noexcept
+			: mShape(std::move(shape)), mAmount(amount), mSlope(slope) {
+			prepare(-DEFAULT_RANGE, DEFAULT_RANGE, DEFAULT_NUM_POINTS);
+		}
+
+		/// @brief Move constructs the given `WaveshaperTable`
+		///
+		/// @param table - The `WaveshaperTable` to move
+		WaveshaperTable(WaveshaperTable&& table) noexcept = default;
+		~WaveshaperTable() noexcept = default;
+
+		/// @brief Creates a `WaveshaperTable` of `waveshapers::softSaturation`. Like the other
+		/// built-in shapes, it's sampled from the exact function, with the standard library,
+		/// rather than the approximations the waveshapers use, since tables are only built when
+		/// parameters change
+		///
+		/// @param amount - The amount of saturation
+		/// @param slope - The slope of the saturation
+		///
+		/// @return - The table
+		[[nodiscard]] inline static auto
+		softSaturation(FloatType amount = narrow_cast<FloatType>(1.0),
+					   FloatType slope = narrow_cast<FloatType>(0.4)) noexcept -> WaveshaperTable {
+			return WaveshaperTable(softSaturationShape, amount, slope);
+		}
+
+		/// @brief Creates a `WaveshaperTable` of `waveshapers::softClip`. The slope is unused
+		///
+		/// @param amount - The amount of clipping
+		///
+		/// @return - The table
+		[[nodiscard]] inline static auto
+		softClip(FloatType amount = narrow_cast<FloatType>(1.0)) noexcept -> WaveshaperTable {
+			return WaveshaperTable(softClipShape, amount);
+		}
+
+		/// @brief Creates a `WaveshaperTable` of `waveshapers::hardClip`. The table's slope is
+		/// the clip level, so `setSlope` changes the clip level
+		///
+		/// @param clipLevel - The hard clip level, in the linear domain
+		/// @param amount - The amount of clipping
+		///
+		/// @return - The table
+		[[nodiscard]] inline static auto
+		hardClip(FloatType clipLevel,
+				 FloatType amount = narrow_cast<FloatType>(1.0)) noexcept -> WaveshaperTable {
+			return WaveshaperTable(hardClipShape, amount, clipLevel);
+		}
+
+		/// @brief Prepares this table for the given range of inputs and resolution, and builds
+		/// it. Allocates, so must not be called on the audio thread
+		///
+		/// @param minInput - The smallest input the table covers
+		/// @param maxInput - The largest input the table covers
+		/// @param numPoints - The number of points to sample the shape at, at least 2
+		/// @param interpolation - How to interpolate between the points
+		inline auto prepare(FloatType minInput,
+							FloatType maxInput,
+							size_t numPoints,
+							WaveshaperInterpolation interpolation
+							= WaveshaperInterpolation::Linear) noexcept -> void {
+			jassert(maxInput > minInput);
+			jassert(numPoints >= 2);
+			mMinInput = minInput;
+			mMaxInput = maxInput;
+			mNumSegments = General<size_t>::max(numPoints, 2) - 1;
+			mInterpolation = interpolation;
+			mStep = (mMaxInput - mMinInput) / static_cast<FloatType>(mNumSegments);
+			mInverseStep = static_cast<FloatType>(1.0) / mStep;
+			mCoefficients.resize(mNumSegments * getNumCoefficients());
+			build();
+		}
+
+		/// @brief Sets the amount of the shape, rebuilding the table if it changed
+		///
+		/// @param amount - The new amount
+		inline auto setAmount(FloatType amount) noexcept -> void {
+			if(amount != mAmount) {
+				mAmount = amount;
+				build();
+			}
+		}
+
+		/// @brief Returns the amount of the shape
+		///
+		/// @return - The amount
+		[[nodiscard]] inline auto getAmount() const noexcept -> FloatType {
+			return mAmount;
+		}
+
+		/// @brief Sets the slope of the shape, rebuilding the table if it changed
+		///
+		/// @param slope - The new slope
+		inline auto setSlope(FloatType slope) noexcept -> void {
+			if(slope != mSlope) {
+				mSlope = slope;
+				build();
+			}
+		}
+
+		/// @brief Returns the slope of the shape
+		///
+		/// @return - The slope
+		[[nodiscard]] inline auto getSlope() const noexcept -> FloatType {
+			return mSlope;
+		}
+
+		/// @brief Returns how this table interpolates between its points
+		///
+		/// @return - The interpolation
+		[[nodiscard]] inline auto getInterpolation() const noexcept -> WaveshaperInterpolation {
+			return mInterpolation;
+		}
+
+		/// @brief Returns the smallest input the table covers
+		///
+		/// @return - The smallest input
+		[[nodiscard]] inline auto getMinInput() const noexcept -> FloatType {
+			return mMinInput;
+		}
+
+		/// @brief Returns the largest input the table covers
+		///
+		/// @return - The largest input
+		[[nodiscard]] inline auto getMaxInput() const noexcept -> FloatType {
+			return mMaxInput;
+		}
+
+		/// @brief Returns the number of segments (gaps between points) in the table
+		///
+		/// @return - The number of segments
+		[[nodiscard]] inline auto getNumSegments() const noexcept -> size_t {
+			return mNumSegments;
+		}
+
+		/// @brief Returns the number of coefficients in each segment's polynomial
+		///
+		/// @return - The number of coefficients
+		[[nodiscard]] inline auto getNumCoefficients() const noexcept -> size_t {
+			return mInterpolation == WaveshaperInterpolation::Cubic ? 4U : 2U;
+		}
+
+		/// @brief Returns the polynomials of every segment, `getNumCoefficients` per segment,
+		/// lowest order first. Each is in terms of the position within its segment, from 0 at
+		/// its start to 1 at its end
+		///
+		/// @return - The coefficients
+		[[nodiscard]] inline auto getCoefficients() const noexcept -> Span<const FloatType> {
+			return Span<const FloatType>::MakeSpan(mCoefficients.data(), mCoefficients.size());
+		}
+
+		/// @brief Returns the largest difference between the table and the shape, within the
+		/// table's range, as measured when the table was last built
+		///
+		/// @return - The largest absolute error
+		[[nodiscard]] inline auto getMaxError() const noexcept -> FloatType {
+			return mMaxError;
+		}
+
+		/// @brief Shapes the given input
+		///
+		/// @param input - The input to shape
+		///
+		/// @return - The shaped value
+		[[nodiscard]] inline auto process(FloatType input) const noexcept -> FloatType {
+			switch(mInterpolation) {
+				case WaveshaperInterpolation::Linear: return evaluate<1>(input, getLookup());
+				case WaveshaperInterpolation::Cubic: return evaluate<3>(input, getLookup());
+			}
+			return input;
+		}
+
+		/// @brief Shapes a block of samples
+		///
+		/// @param input - The input to shape
+		/// @param output - Where to write the shaped values; Must be the same size as `input`,
+		/// and may be the same memory
+		inline auto process(Span<const FloatType> input, Span<FloatType> output) const noexcept
+			-> void {
+			jassert(input.size() == output.size());
+			switch(mInterpolation) {
+				case WaveshaperInterpolation::Linear: processBlock<1>(input, output); break;
+				case WaveshaperInterpolation::Cubic: processBlock<3>(input, output); break;
+			}
+		}
+
+		auto operator=(WaveshaperTable&& table) noexcept -> WaveshaperTable& = default;
+
+	  private:
+		Shape mShape = softSaturationShape;
+		FloatType mAmount = narrow_cast<FloatType>(1.0);
+		FloatType mSlope = narrow_cast<FloatType>(0.4);
+		FloatType mMinInput = -DEFAULT_RANGE;
+		FloatType mMaxInput = DEFAULT_RANGE;
+		FloatType mStep = narrow_cast<FloatType>(1.0);
+		FloatType mInverseStep = narrow_cast<FloatType>(1.0);
+		size_t mNumSegments = 1U;
+		WaveshaperInterpolation mInterpolation = WaveshaperInterpolation::Linear;
+		FloatType mMaxError = narrow_cast<FloatType>(0.0);
+		/// The polynomial of each segment, lowest order first, in terms of the position within
+		/// the segment (from 0 to 1)
+		std::vector<FloatType> mCoefficients = std::vector<FloatType>();
+
+		/// @brief The shape of `softSaturation` tables
+		///
+		/// @param input - The input to saturate
+		/// @param amount - The amount of saturation
+		/// @param slope - The slope of the saturation
+		///
+		/// @return - The saturated value
+		inline static auto
+		softSaturationShape(FloatType input, FloatType amount, FloatType slope) noexcept
+			-> FloatType {
+			return input * (static_cast<FloatType>(1.0) + amount)
+				   / (static_cast<FloatType>(1.0) + amount * std::pow(std::abs(input), slope));
+		}
+
+		/// @brief The shape of `softClip` tables
+		///
+		/// @param input - The input to clip
+		/// @param amount - The amount of clipping
+		///
+		/// @return - The clipped value
+		inline static auto
+		softClipShape(FloatType input, FloatType amount, FloatType /*slope*/) noexcept
+			-> FloatType {
+			return input * (static_cast<FloatType>(1.0) + amount)
+				   / (static_cast<FloatType>(1.0) + amount * std::abs(input));
+		}
+
+		/// @brief The shape of `hardClip` tables
+		///
+		/// @param input - The input to clip
+		/// @param amount - The amount of clipping
+		/// @param clipLevel - The hard clip level, in the linear domain
+		///
+		/// @return - The clipped value
+		inline static auto
+		hardClipShape(FloatType input, FloatType amount, FloatType clipLevel) noexcept
+			-> FloatType {
+			const auto shaped = softClipShape(input, amount, clipLevel);
+			return std::abs(shaped) > clipLevel ? std::copysign(clipLevel, shaped) : shaped;
+		}
+
+		/// @brief Returns the shape at the given point, which may be outside the range
+		///
+		/// @param point - The index of the point, where 0 is the start of the range
+		///
+		/// @return - The shape's value at the point
+		[[nodiscard]] inline auto shapeAt(int64_t point) const noexcept -> FloatType {
+			return mShape(mMinInput + static_cast<FloatType>(point) * mStep, mAmount, mSlope);
+		}
+
+		/// @brief Fits each segment's polynomial to the shape, then measures the error between
+		/// every pair of points
+		inline auto build() noexcept -> void {
+			const auto numSegments = static_cast<int64_t>(mNumSegments);
+			if(mInterpolation == WaveshaperInterpolation::Cubic) {
+				// the cubic through the points either side of each segment, ie the Lagrange
+				// interpolant on -1, 0, 1 and 2
+				auto previous = shapeAt(-1);
+				auto current = shapeAt(0);
+				auto next = shapeAt(1);
+				for(int64_t segment = 0; segment < numSegments; ++segment) {
+					const auto afterNext = shapeAt(segment + 2);
+					auto* coefficients = &mCoefficients.at(static_cast<size_t>(segment) * 4U);
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					coefficients[0] = current;
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					coefficients[1] = -previous / static_cast<FloatType>(3.0)
+									  - current / static_cast<FloatType>(2.0) + next
+									  - afterNext / static_cast<FloatType>(6.0);
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					coefficients[2] = (previous + next) / static_cast<FloatType>(2.0) - current;
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					coefficients[3] = (afterNext - previous) / static_cast<FloatType>(6.0)
+									  + (current - next) / static_cast<FloatType>(2.0);
+					previous = current;
+					current = next;
+					next = afterNext;
+				}
+			}
+			else {
+				auto current = shapeAt(0);
+				for(int64_t segment = 0; segment < numSegments; ++segment) {
+					const auto next = shapeAt(segment + 1);
+					mCoefficients.at(static_cast<size_t>(segment) * 2U) = current;
+					mCoefficients.at(static_cast<size_t>(segment) * 2U + 1U) = next - current;
+					current = next;
+				}
+			}
+
+			// the error of an interpolant peaks between the points, so check at the quarters of
+			// each segment
+			mMaxError = static_cast<FloatType>(0.0);
+			for(int64_t segment = 0; segment < numSegments; ++segment) {
+				for(auto quarter = 1; quarter < 4; ++quarter) {
+					const auto input
+						= mMinInput
+						  + (static_cast<FloatType>(segment) + static_cast<FloatType>(quarter) / 4)
+								* mStep;
+					const auto error = process(input) - mShape(input, mAmount, mSlope);
+					mMaxError = General<FloatType>::max(
+						mMaxError,
+						error < static_cast<FloatType>(0.0) ? -error : error);
+				}
+			}
+		}
+
+		/// What evaluating the table needs, copied out of the members so the compiler knows
+		/// writing an output can't change it
+		struct Lookup {
+			FloatType minInput;
+			FloatType maxInput;
+			FloatType inverseStep;
+			int32_t lastSegment;
+			const FloatType* coefficients;
+		};
+
+		/// @brief Returns what evaluating the table needs
+		///
+		/// @return - The `Lookup`
+		[[nodiscard]] inline auto getLookup() const noexcept -> Lookup {
+			return {mMinInput,
+					mMaxInput,
+					mInverseStep,
+					static_cast<int32_t>(mNumSegments) - 1,
+					mCoefficients.data()};
+		}
+
+		/// @brief Evaluates the table at the given input
+		///
+		/// @tparam Order - The order of the segments' polynomials
+		/// @param input - The input to shape
+		/// @param lookup - The table
+		///
+		/// @return - The shaped value
+		template<size_t Order>
+		[[nodiscard]] inline static auto
+		evaluate(FloatType input, const Lookup& lookup) noexcept -> FloatType {
+			const auto clamped = input < lookup.minInput ?
+									 lookup.minInput :
+									 (input > lookup.maxInput ? lookup.maxInput : input);
+			const auto position = (clamped - lookup.minInput) * lookup.inverseStep;
+			// the top of the range is the end of the last segment, not the start of another
+			auto segment = static_cast<int32_t>(position);
+			segment = segment > lookup.lastSegment ? lookup.lastSegment : segment;
+			const auto fraction = position - static_cast<FloatType>(segment);
+			// indexed from the start of the table, rather than from a pointer to the segment, so
+			// the loads can become gathers
+			const auto first = segment * static_cast<int32_t>(Order + 1);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			auto value = lookup.coefficients[first + static_cast<int32_t>(Order)];
+			for(auto index = static_cast<int32_t>(Order) - 1; index >= 0; --index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				value = value * fraction + lookup.coefficients[first + index];
+			}
+			return value;
+		}
+
+		/// @brief Evaluates the table for each sample of a block
+		///
+		/// @tparam Order - The order of the segments' polynomials
+		/// @param input - The input to shape
+		/// @param output - Where to write the shaped values
+		template<size_t Order>
+		inline auto processBlock(Span<const FloatType> input, Span<FloatType> output) const noexcept
+			-> void {
+			const auto lookup = getLookup();
+			const auto size = input.size();
+			// each chunk is shaped into a local buffer, which the compiler knows can't alias the
+			// table, then copied out; otherwise the loads from the table can't be vectorized
+			auto shaped = std::array<FloatType, waveshapers::WAVESHAPER_CHUNK_SIZE>();
+			for(size_t offset = 0; offset < size; offset += waveshapers::WAVESHAPER_CHUNK_SIZE) {
+				const auto chunkSize
+					= General<size_t>::min(waveshapers::WAVESHAPER_CHUNK_SIZE, size - offset);
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto* in = input.data() + offset;
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto* out = output.data() + offset;
+				for(size_t index = 0; index < chunkSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					shaped[index] = evaluate<Order>(in[index], lookup);
+				}
+				for(size_t index = 0; index < chunkSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					out[index] = shaped[index];
+				}
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveshaperTable)
+	};
+} // namespace apex::dsp
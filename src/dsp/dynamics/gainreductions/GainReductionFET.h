@@ -75,7 +75,7 @@ namespace apex::dsp {
 				gainReduction *= sign;
 			}
 			FloatType gainReductionStep = waveshapers::softSaturation<FloatType>(
-				narrow_cast<FloatType>(gainReduction.getLinear()),
+				gainReduction.getLinear<FloatType>(),
 				SLEW_RATE_AMOUNT,
 				SLEW_RATE_SLOPE);
 
@@ -355,7 +355,7 @@ namespace apex::dsp {
 			Logger::LogMessage("Base Sidechain Processing FeedForwardReturnToThreshold");
 #endif
 			auto rectified = General<FloatType>::abs(input);
-			auto thresholdLinear = narrow_cast<FloatType>(mState.getThreshold().getLinear());
+			auto thresholdLinear = mState.getThreshold().template getLinear<FloatType>();
 			Decibels detectedDB = Decibels::fromLinear(
 				mLevelDetector.process(rectified - thresholdLinear) + thresholdLinear);
 			Decibels outputDB = mGainComputer->process(detectedDB);
@@ -382,7 +382,7 @@ namespace apex::dsp {
 			Logger::LogMessage("Base Sidechain Processing FeedBackReturnToZero");
 #endif
 			auto rectified = General<FloatType>::abs(input)
-							 * narrow_cast<FloatType>(mGainReductionDB.getLinear());
+							 * mGainReductionDB.getLinear<FloatType>();
 			auto detectedDB = math::Decibels::linearToDecibels(mLevelDetector.process(rectified));
 			Decibels outputDB = mGainComputer->process(detectedDB);
 			mGainReductionDB += outputDB - detectedDB;
@@ -395,8 +395,8 @@ namespace apex::dsp {
 			Logger::LogMessage("Base Sidechain Processing FeedBackReturnToThreshold");
 #endif
 			auto rectified = General<FloatType>::abs(input)
-							 * narrow_cast<FloatType>(mGainReductionDB.getLinear());
-			auto thresholdLinear = narrow_cast<FloatType>(mState.getThreshold().getLinear());
+							 * mGainReductionDB.getLinear<FloatType>();
+			auto thresholdLinear = mState.getThreshold().template getLinear<FloatType>();
 			Decibels detectedDB = Decibels::fromLinear(
 				mLevelDetector.process(rectified - thresholdLinear) + thresholdLinear);
 			Decibels outputDB = mGainComputer->process(detectedDB);
@@ -411,7 +411,7 @@ namespace apex::dsp {
 			Logger::LogMessage("Base Sidechain Processing FeedBackAlternateReturnToThreshold");
 #endif
 			auto rectified = General<FloatType>::abs(input)
-							 * narrow_cast<FloatType>(mGainReductionDB.getLinear());
+							 * mGainReductionDB.getLinear<FloatType>();
 			Decibels rectifiedDB = Decibels::fromLinear(rectified);
 			Decibels gainReduction
 				= mGainReductionDB + mGainComputer->process(rectifiedDB) - rectifiedDB;
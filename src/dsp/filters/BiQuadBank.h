@@ -0,0 +1,441 @@
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "../../base/StandardIncludes.h"
+#include "BiQuadFilter.h"
+#include "ResponseGrid.h"
+
+namespace apex::dsp {
+	/// @brief A bank of `Lanes` identical BiQuad Filters (eg. one per channel), storing the
+	/// per-lane state as a structure of arrays so that all lanes are run through the recursion
+	/// together, in a single pass
+	///
+	/// All lanes share a single filter design, so coefficients are only calculated once per
+	/// parameter change, regardless of the number of lanes. The lane loops operate on contiguous
+	/// `std::array`s, allowing the compiler to map them directly onto SSE/AVX/NEON registers
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	/// @tparam Lanes - The number of lanes (channels) in the bank
+	template<typename FloatType = float,
+			 size_t Lanes = 2,
+			 std::enable_if_t<std::is_floating_point_v<FloatType> && (Lanes > 0), bool> = true>
+	class BiQuadBank {
+	  public:
+		/// @brief The per-lane values of a single frame
+		using Frame = std::array<FloatType, Lanes>;
+
+		/// @brief Constructs a default `BiQuadBank`
+		BiQuadBank() noexcept {
+			mDesign.setDeferredUpdates(true);
+			updateCoefficients();
+		}
+
+		/// @brief Constructs a `BiQuadBank` with every lane using the given filter design
+		///
+		/// @param design - The `BiQuadFilter` to use as the design for every lane
+		explicit BiQuadBank(BiQuadFilter<FloatType>&& design) noexcept
+			: mDesign(std::move(design)) {
+			mDesign.setDeferredUpdates(true);
+			updateCoefficients();
+		}
+
+		/// @brief Move constructs a `BiQuadBank` from the given one
+		///
+		/// @param bank - The `BiQuadBank` to move
+		BiQuadBank(BiQuadBank&& bank) noexcept = default;
+		~BiQuadBank() noexcept = default;
+
+		/// @brief Returns the number of lanes in this bank
+		///
+		/// @return - The number of lanes
+		[[nodiscard]] static constexpr inline auto getNumLanes() noexcept -> size_t {
+			return Lanes;
+		}
+
+		/// @brief Sets the frequency of every lane to the given value
+		///
+		/// @param frequency - The new frequency, in Hertz
+		inline auto setFrequency(Hertz frequency) noexcept -> void {
+			mDesign.setFrequency(frequency);
+			markCoefficientsDirty();
+		}
+
+		/// @brief Returns the frequency of the filters in this bank
+		///
+		/// @return - The frequency, in Hertz
+		[[nodiscard]] inline auto getFrequency() const noexcept -> Hertz {
+			return mDesign.getFrequency();
+		}
+
+		/// @brief Sets the Q of every lane to the given value
+		///
+		/// @param q - The new Q
+		inline auto setQ(FloatType q) noexcept -> void {
+			mDesign.setQ(q);
+			markCoefficientsDirty();
+		}
+
+		/// @brief Returns the Q of the filters in this bank
+		///
+		/// @return - The Q
+		[[nodiscard]] inline auto getQ() const noexcept -> FloatType {
+			return mDesign.getQ();
+		}
+
+		/// @brief Sets the gain of every lane to the given value
+		///
+		/// @param gain - The new gain, in Decibels
+		inline auto setGainDB(Decibels gain) noexcept -> void {
+			mDesign.setGainDB(gain);
+			markCoefficientsDirty();
+		}
+
+		/// @brief Returns the gain of the filters in this bank
+		///
+		/// @return - The gain, in Decibels
+		[[nodiscard]] inline auto getGainDB() const noexcept -> Decibels {
+			return mDesign.getGainDB();
+		}
+
+		/// @brief Sets the sample rate of every lane to the given value
+		///
+		/// @param sampleRate - The new sample rate, in Hertz
+		inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
+			mDesign.setSampleRate(sampleRate);
+			markCoefficientsDirty();
+		}
+
+		/// @brief Returns the sample rate of the filters in this bank
+		///
+		/// @return - The sample rate, in Hertz
+		[[nodiscard]] inline auto getSampleRate() const noexcept -> Hertz {
+			return mDesign.getSampleRate();
+		}
+
+		/// @brief Sets the method used to design the coefficients of every lane
+		///
+		/// @param method - The new design method
+		inline auto setDesignMethod(DesignMethod method) noexcept -> void {
+			mDesign.setDesignMethod(method);
+			markCoefficientsDirty();
+		}
+
+		/// @brief Returns the method used to design the coefficients of the filters in this bank
+		///
+		/// @return - The design method
+		[[nodiscard]] inline auto getDesignMethod() const noexcept -> DesignMethod {
+			return mDesign.getDesignMethod();
+		}
+
+		/// @brief Applies the given (already calculated) design to every lane of this bank, so no
+		/// maths is done here
+		///
+		/// @param design - The design to apply
+		inline auto setDesign(const BiQuadDesign<FloatType>& design) noexcept -> void {
+			mDesign.setDesign(design);
+			mCoefficients = design.coefficients;
+			mCoefficientsDirty = false;
+		}
+
+		/// @brief Sets whether coefficient updates are deferred. When deferred, the parameter
+		/// setters only mark the coefficients as out of date, and they are recalculated once, at
+		/// the start of the next block (or the next call to `updateCoefficientsIfNeeded`).
+		///
+		/// Per-sample and per-frame processing do not check for pending changes, so when using
+		/// them in deferred mode, call `updateCoefficientsIfNeeded` at the start of each block
+		///
+		/// @param deferred - Whether coefficient updates should be deferred
+		inline auto setDeferredUpdates(bool deferred) noexcept -> void {
+			mDeferredUpdates = deferred;
+			if(!mDeferredUpdates) {
+				updateCoefficientsIfNeeded();
+			}
+		}
+
+		/// @brief Returns whether coefficient updates are deferred
+		///
+		/// @return - Whether updates are deferred
+		[[nodiscard]] inline auto getDeferredUpdates() const noexcept -> bool {
+			return mDeferredUpdates;
+		}
+
+		/// @brief Recalculates the shared coefficients if any parameters have changed since they
+		/// were last calculated
+		///
+		/// @return - Whether the coefficients were recalculated
+		inline auto updateCoefficientsIfNeeded() noexcept -> bool {
+			if(mCoefficientsDirty) {
+				updateCoefficients();
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Returns the (normalized) coefficients matching the current parameters of the
+		/// bank. If an update is pending, they are calculated without being applied
+		///
+		/// @return - The coefficients
+		[[nodiscard]] inline auto
+		getCoefficients() const noexcept -> BiQuadCoefficients<FloatType> {
+			return mCoefficientsDirty ? mDesign.getCoefficients() : mCoefficients;
+		}
+
+		/// @brief Applies the filter of the given lane to the given input value
+		///
+		/// @param lane - The lane to process
+		/// @param input - The input value to apply filtering to
+		///
+		/// @return - The filtered value
+		[[nodiscard]] inline auto processLane(size_t lane, FloatType input) noexcept -> FloatType {
+			jassert(lane < Lanes);
+			auto& s1 = mS1.at(lane);
+			auto& s2 = mS2.at(lane);
+
+			auto yn = mCoefficients.b0 * input + s1;
+			s1 = mCoefficients.b1 * input - mCoefficients.a1 * yn + s2;
+			s2 = mCoefficients.b2 * input - mCoefficients.a2 * yn;
+
+			return yn;
+		}
+
+		/// @brief Applies the filter of the given lane to the array of given input values
+		///
+		/// @param lane - The lane to process
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto
+		processLane(size_t lane, Span<FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			updateCoefficientsIfNeeded();
+			processLaneBlock(lane, input.data(), output.data(), input.size());
+		}
+
+		/// @brief Applies the filter of the given lane to the array of given input values
+		///
+		/// @param lane - The lane to process
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto processLane(size_t lane,
+								Span<const FloatType> input,
+								Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			updateCoefficientsIfNeeded();
+			processLaneBlock(lane, input.data(), output.data(), input.size());
+		}
+
+		/// @brief Applies the filters of every lane to the given frame, in place
+		///
+		/// @param frame - The frame to filter, one value per lane
+		inline auto processFrame(Frame& frame) noexcept -> void {
+			const auto b0 = mCoefficients.b0;
+			const auto b1 = mCoefficients.b1;
+			const auto b2 = mCoefficients.b2;
+			const auto a1 = mCoefficients.a1;
+			const auto a2 = mCoefficients.a2;
+
+			for(size_t lane = 0; lane < Lanes; ++lane) {
+				const auto xn = frame[lane];
+				const auto yn = b0 * xn + mS1[lane];
+				mS1[lane] = b1 * xn - a1 * yn + mS2[lane];
+				mS2[lane] = b2 * xn - a2 * yn;
+				frame[lane] = yn;
+			}
+		}
+
+		/// @brief Applies the filters of every lane to the given planar (one array per lane)
+		/// input, storing the results in `output`
+		///
+		/// @param input - The arrays of input values to filter, one per lane
+		/// @param output - The arrays to store the output values in, one per lane
+		inline auto process(const std::array<Span<FloatType>, Lanes>& input,
+							const std::array<Span<FloatType>, Lanes>& output) noexcept -> void {
+			auto inputs = std::array<const FloatType*, Lanes>();
+			auto outputs = std::array<FloatType*, Lanes>();
+			for(size_t lane = 0; lane < Lanes; ++lane) {
+				jassert(input[lane].size() == input[0].size());
+				jassert(output[lane].size() == input[0].size());
+				inputs[lane] = input[lane].data();
+				outputs[lane] = output[lane].data();
+			}
+			updateCoefficientsIfNeeded();
+			processBlock(inputs, outputs, input[0].size());
+		}
+
+		/// @brief Applies the filters of every lane to the given planar (one array per lane)
+		/// input, storing the results in `output`
+		///
+		/// @param input - The arrays of input values to filter, one per lane
+		/// @param output - The arrays to store the output values in, one per lane
+		inline auto process(const std::array<Span<const FloatType>, Lanes>& input,
+							const std::array<Span<FloatType>, Lanes>& output) noexcept -> void {
+			auto inputs = std::array<const FloatType*, Lanes>();
+			auto outputs = std::array<FloatType*, Lanes>();
+			for(size_t lane = 0; lane < Lanes; ++lane) {
+				jassert(input[lane].size() == input[0].size());
+				jassert(output[lane].size() == input[0].size());
+				inputs[lane] = input[lane].data();
+				outputs[lane] = output[lane].data();
+			}
+			updateCoefficientsIfNeeded();
+			processBlock(inputs, outputs, input[0].size());
+		}
+
+		/// @brief Resets every lane of this bank to an initial state
+		inline auto reset() noexcept -> void {
+			mS1.fill(narrow_cast<FloatType>(0.0));
+			mS2.fill(narrow_cast<FloatType>(0.0));
+		}
+
+		/// @brief Calculates the magnitude response of the filters in this bank for the given
+		/// frequency
+		///
+		/// @param frequency - The frequency to calculate the magnitude response for, in Hertz
+		///
+		/// @return - The magnitude response at the given frequency
+		[[nodiscard]] inline auto
+		getMagnitudeForFrequency(Hertz frequency) const noexcept -> FloatType {
+			return mDesign.getMagnitudeForFrequency(frequency);
+		}
+
+		/// @brief Calculates the phase response of the filters in this bank for the given
+		/// frequency
+		///
+		/// @param frequency - The frequency to calculate the phase response for, in Hertz
+		///
+		/// @return - The phase response at the given frequency
+		[[nodiscard]] inline auto getPhaseForFrequency(Hertz frequency) const noexcept -> Radians {
+			return mDesign.getPhaseForFrequency(frequency);
+		}
+
+		/// @brief Calculates the magnitude response of the filters in this bank at every point of
+		/// the given grid
+		///
+		/// @param grid - The frequencies to calculate the magnitude response for
+		/// @param magnitudes - The array to store the magnitudes in
+		inline auto getMagnitudesForFrequencies(const ResponseGrid<FloatType>& grid,
+												Span<FloatType> magnitudes) const noexcept -> void {
+			jassert(grid.getSampleRate() == mDesign.getSampleRate());
+			grid.getMagnitudes(getCoefficients(), magnitudes);
+		}
+
+		/// @brief Calculates the phase response of the filters in this bank at every point of the
+		/// given grid
+		///
+		/// @param grid - The frequencies to calculate the phase response for
+		/// @param phases - The array to store the phases in
+		inline auto getPhasesForFrequencies(const ResponseGrid<FloatType>& grid,
+											Span<Radians> phases) const noexcept -> void {
+			jassert(grid.getSampleRate() == mDesign.getSampleRate());
+			grid.getPhases(getCoefficients(), phases);
+		}
+
+		auto operator=(BiQuadBank&& bank) noexcept -> BiQuadBank& = default;
+
+	  private:
+		/// The design shared by every lane, holding the parameters and calculating coefficients
+		BiQuadFilter<FloatType> mDesign = BiQuadFilter<FloatType>();
+		BiQuadCoefficients<FloatType> mCoefficients = BiQuadCoefficients<FloatType>();
+		bool mDeferredUpdates = false;
+		bool mCoefficientsDirty = false;
+
+		/// Transposed Direct Form II state, one entry per lane
+		Frame mS1 = Frame();
+		Frame mS2 = Frame();
+
+		/// @brief Calculates the coefficients of the shared design, once, and copies them into the
+		/// bank
+		inline auto updateCoefficients() noexcept -> void {
+			mDesign.updateCoefficientsIfNeeded();
+			mCoefficients = mDesign.getCoefficients();
+			mCoefficientsDirty = false;
+		}
+
+		/// @brief Marks the shared coefficients as out of date, recalculating them immediately
+		/// unless updates are deferred
+		inline auto markCoefficientsDirty() noexcept -> void {
+			mCoefficientsDirty = true;
+			if(!mDeferredUpdates) {
+				updateCoefficients();
+			}
+		}
+
+		/// @brief Applies the filter of the given lane to `size` samples from `input`, storing
+		/// the results in `output`. `input` and `output` may alias
+		///
+		/// @param lane - The lane to process
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of samples to process
+		inline auto processLaneBlock(size_t lane,
+									 const FloatType* input,
+									 FloatType* output,
+									 size_t size) noexcept -> void {
+			jassert(lane < Lanes);
+			const auto b0 = mCoefficients.b0;
+			const auto b1 = mCoefficients.b1;
+			const auto b2 = mCoefficients.b2;
+			const auto a1 = mCoefficients.a1;
+			const auto a2 = mCoefficients.a2;
+			auto s1 = mS1.at(lane);
+			auto s2 = mS2.at(lane);
+
+			for(size_t i = 0; i < size; ++i) {
+				const auto xn = input[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto yn = b0 * xn + s1;
+				s1 = b1 * xn - a1 * yn + s2;
+				s2 = b2 * xn - a2 * yn;
+				output[i] = yn; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+
+			mS1.at(lane) = s1;
+			mS2.at(lane) = s2;
+		}
+
+		/// @brief Applies the filters of every lane to `size` samples from each of `inputs`,
+		/// storing the results in `outputs`. Each input may alias its corresponding output
+		///
+		/// @param inputs - Pointers to the input samples, one per lane
+		/// @param outputs - Pointers to store the output samples in, one per lane
+		/// @param size - The number of samples to process
+		inline auto processBlock(const std::array<const FloatType*, Lanes>& inputs,
+								 const std::array<FloatType*, Lanes>& outputs,
+								 size_t size) noexcept -> void {
+			// keep the coefficients and the state in locals so the lane loops stay in registers
+			const auto b0 = mCoefficients.b0;
+			const auto b1 = mCoefficients.b1;
+			const auto b2 = mCoefficients.b2;
+			const auto a1 = mCoefficients.a1;
+			const auto a2 = mCoefficients.a2;
+			auto s1 = mS1;
+			auto s2 = mS2;
+			auto xn = Frame();
+			auto yn = Frame();
+
+			for(size_t i = 0; i < size; ++i) {
+				for(size_t lane = 0; lane < Lanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					xn[lane] = inputs[lane][i];
+				}
+
+				for(size_t lane = 0; lane < Lanes; ++lane) {
+					yn[lane] = b0 * xn[lane] + s1[lane];
+					s1[lane] = b1 * xn[lane] - a1 * yn[lane] + s2[lane];
+					s2[lane] = b2 * xn[lane] - a2 * yn[lane];
+				}
+
+				for(size_t lane = 0; lane < Lanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					outputs[lane][i] = yn[lane];
+				}
+			}
+
+			mS1 = s1;
+			mS2 = s2;
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiQuadBank)
+	};
+} // namespace apex::dsp
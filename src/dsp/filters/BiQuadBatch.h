@@ -0,0 +1,295 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "../../base/StandardIncludes.h"
+#include "BiQuadFilter.h"
+
+namespace apex::dsp {
+	/// @brief Batches independent BiQuad Filters from different instances (eg. the same band of
+	/// the EQ on several tracks) into lanes, so that they can all be run through the recursion
+	/// together in a single pass
+	///
+	/// Unlike `BiQuadBank`, where every lane shares one design, every lane of a `BiQuadBatch` has
+	/// its own coefficients. Instances register a filter to claim a lane, bind their buffers for
+	/// the current block, and a single call to `process` then filters every bound lane
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	/// @tparam Lanes - The maximum number of filters in the batch
+	template<typename FloatType = float,
+			 size_t Lanes = 8,
+			 std::enable_if_t<std::is_floating_point_v<FloatType> && (Lanes > 0), bool> = true>
+	class BiQuadBatch {
+	  public:
+		/// @brief The per-lane values of a single frame
+		using Frame = std::array<FloatType, Lanes>;
+
+		/// @brief Constructs a default `BiQuadBatch`, with no registered filters
+		BiQuadBatch() noexcept = default;
+
+		/// @brief Move constructs a `BiQuadBatch` from the given one
+		///
+		/// @param batch - The `BiQuadBatch` to move
+		BiQuadBatch(BiQuadBatch&& batch) noexcept = default;
+		~BiQuadBatch() noexcept = default;
+
+		/// @brief Returns the maximum number of filters in this batch
+		///
+		/// @return - The number of lanes
+		[[nodiscard]] static constexpr inline auto getNumLanes() noexcept -> size_t {
+			return Lanes;
+		}
+
+		/// @brief Registers the given filter with this batch, claiming the first free lane and
+		/// copying the filter's current coefficients into it
+		///
+		/// @param filter - The filter to register
+		///
+		/// @return - `Some(lane)` if a lane was free, otherwise `None`
+		[[nodiscard]] inline auto
+		registerFilter(const BiQuadFilter<FloatType>& filter) noexcept -> Option<size_t> {
+			for(size_t lane = 0; lane < Lanes; ++lane) {
+				if(!mRegistered.at(lane)) {
+					mRegistered.at(lane) = true;
+					setCoefficients(lane, filter.getCoefficients());
+					reset(lane);
+					return Some(lane);
+				}
+			}
+			return None();
+		}
+
+		/// @brief Releases the given lane, so it can be claimed by another filter
+		///
+		/// @param lane - The lane to release
+		inline auto unregisterFilter(size_t lane) noexcept -> void {
+			jassert(lane < Lanes);
+			mRegistered.at(lane) = false;
+			unbind(lane);
+			setCoefficients(lane, BiQuadCoefficients<FloatType>());
+			reset(lane);
+		}
+
+		/// @brief Returns whether the given lane is currently registered to a filter
+		///
+		/// @param lane - The lane to check
+		///
+		/// @return - Whether the lane is registered
+		[[nodiscard]] inline auto isRegistered(size_t lane) const noexcept -> bool {
+			return mRegistered.at(lane);
+		}
+
+		/// @brief Returns the number of lanes currently registered to a filter
+		///
+		/// @return - The number of registered filters
+		[[nodiscard]] inline auto getNumRegistered() const noexcept -> size_t {
+			size_t numRegistered = 0;
+			for(auto registered : mRegistered) {
+				numRegistered += registered ? 1 : 0;
+			}
+			return numRegistered;
+		}
+
+		/// @brief Copies the current coefficients of the given filter into the given lane.
+		/// Should be called whenever the parameters of a registered filter change
+		///
+		/// @param lane - The lane to update
+		/// @param filter - The filter registered to the lane
+		inline auto update(size_t lane, const BiQuadFilter<FloatType>& filter) noexcept -> void {
+			jassert(mRegistered.at(lane));
+			setCoefficients(lane, filter.getCoefficients());
+		}
+
+		/// @brief Sets the coefficients of the given lane
+		///
+		/// @param lane - The lane to update
+		/// @param coefficients - The new coefficients
+		inline auto
+		setCoefficients(size_t lane, BiQuadCoefficients<FloatType> coefficients) noexcept -> void {
+			mB0.at(lane) = coefficients.b0;
+			mB1.at(lane) = coefficients.b1;
+			mB2.at(lane) = coefficients.b2;
+			mA1.at(lane) = coefficients.a1;
+			mA2.at(lane) = coefficients.a2;
+		}
+
+		/// @brief Binds the buffers of the given lane for the next call to `process`.
+		/// `input` and `output` may alias
+		///
+		/// @param lane - The lane to bind
+		/// @param input - The input values for the lane
+		/// @param output - The array to store the lane's output values in
+		inline auto
+		bind(size_t lane, Span<const FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(mRegistered.at(lane));
+			jassert(input.size() == output.size());
+			mInputs.at(lane) = input.data();
+			mOutputs.at(lane) = output.data();
+			mBoundSizes.at(lane) = input.size();
+		}
+
+		/// @brief Binds the buffers of the given lane for the next call to `process`.
+		/// `input` and `output` may alias
+		///
+		/// @param lane - The lane to bind
+		/// @param input - The input values for the lane
+		/// @param output - The array to store the lane's output values in
+		inline auto
+		bind(size_t lane, Span<FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(mRegistered.at(lane));
+			jassert(input.size() == output.size());
+			mInputs.at(lane) = input.data();
+			mOutputs.at(lane) = output.data();
+			mBoundSizes.at(lane) = input.size();
+		}
+
+		/// @brief Unbinds the buffers of the given lane
+		///
+		/// @param lane - The lane to unbind
+		inline auto unbind(size_t lane) noexcept -> void {
+			mInputs.at(lane) = nullptr;
+			mOutputs.at(lane) = nullptr;
+			mBoundSizes.at(lane) = 0;
+		}
+
+		/// @brief Filters `numSamples` samples of every bound lane in a single pass, then
+		/// unbinds every lane. Every bound lane must have been bound with at least `numSamples`
+		/// samples. Registered lanes that were not bound keep their state, but are not advanced
+		///
+		/// @param numSamples - The number of samples to process
+		inline auto process(size_t numSamples) noexcept -> void {
+			auto inputs = std::array<const FloatType*, Lanes>();
+			auto outputs = std::array<FloatType*, Lanes>();
+			auto s1 = mS1;
+			auto s2 = mS2;
+
+			for(size_t start = 0; start < numSamples; start += CHUNK_SIZE) {
+				const auto chunkSize = std::min(CHUNK_SIZE, numSamples - start);
+
+				// lanes without buffers read silence and write to scratch, so the lane loops
+				// never have to branch
+				for(size_t lane = 0; lane < Lanes; ++lane) {
+					jassert(mInputs.at(lane) == nullptr || mBoundSizes.at(lane) >= numSamples);
+					if(mInputs.at(lane) != nullptr) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						inputs.at(lane) = mInputs.at(lane) + start;
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						outputs.at(lane) = mOutputs.at(lane) + start;
+					}
+					else {
+						inputs.at(lane) = mSilence.data();
+						outputs.at(lane) = mScratch.data();
+					}
+				}
+
+				processChunk(inputs, outputs, s1, s2, chunkSize);
+			}
+
+			// unbound lanes were only run to keep the lane loops uniform, so they keep their
+			// previous state
+			for(size_t lane = 0; lane < Lanes; ++lane) {
+				if(mInputs.at(lane) != nullptr) {
+					mS1.at(lane) = s1.at(lane);
+					mS2.at(lane) = s2.at(lane);
+				}
+				unbind(lane);
+			}
+		}
+
+		/// @brief Resets the given lane to an initial state
+		///
+		/// @param lane - The lane to reset
+		inline auto reset(size_t lane) noexcept -> void {
+			mS1.at(lane) = narrow_cast<FloatType>(0.0);
+			mS2.at(lane) = narrow_cast<FloatType>(0.0);
+		}
+
+		/// @brief Resets every lane of this batch to an initial state
+		inline auto reset() noexcept -> void {
+			mS1.fill(narrow_cast<FloatType>(0.0));
+			mS2.fill(narrow_cast<FloatType>(0.0));
+		}
+
+		auto operator=(BiQuadBatch&& batch) noexcept -> BiQuadBatch& = default;
+
+	  private:
+		/// The number of samples processed per lane between pointer updates
+		static constexpr size_t CHUNK_SIZE = 64;
+
+		/// Coefficients, one entry per lane. Unregistered lanes are a pass-through
+		Frame mB0 = filledFrame(narrow_cast<FloatType>(1.0));
+		Frame mB1 = Frame();
+		Frame mB2 = Frame();
+		Frame mA1 = Frame();
+		Frame mA2 = Frame();
+
+		/// Transposed Direct Form II state, one entry per lane
+		Frame mS1 = Frame();
+		Frame mS2 = Frame();
+
+		std::array<bool, Lanes> mRegistered = std::array<bool, Lanes>();
+		std::array<const FloatType*, Lanes> mInputs = std::array<const FloatType*, Lanes>();
+		std::array<FloatType*, Lanes> mOutputs = std::array<FloatType*, Lanes>();
+		std::array<size_t, Lanes> mBoundSizes = std::array<size_t, Lanes>();
+
+		/// Stand-in buffers for unbound lanes
+		std::array<FloatType, CHUNK_SIZE> mSilence = std::array<FloatType, CHUNK_SIZE>();
+		std::array<FloatType, CHUNK_SIZE> mScratch = std::array<FloatType, CHUNK_SIZE>();
+
+		/// @brief Returns a `Frame` with every lane set to the given value
+		///
+		/// @param value - The value to fill the frame with
+		///
+		/// @return - The filled frame
+		[[nodiscard]] static inline auto filledFrame(FloatType value) noexcept -> Frame {
+			auto frame = Frame();
+			frame.fill(value);
+			return frame;
+		}
+
+		/// @brief Filters `size` samples of every lane
+		///
+		/// @param inputs - Pointers to the input samples, one per lane
+		/// @param outputs - Pointers to store the output samples in, one per lane
+		/// @param s1 - The first state of each lane
+		/// @param s2 - The second state of each lane
+		/// @param size - The number of samples to process
+		inline auto processChunk(const std::array<const FloatType*, Lanes>& inputs,
+								 const std::array<FloatType*, Lanes>& outputs,
+								 Frame& s1,
+								 Frame& s2,
+								 size_t size) noexcept -> void {
+			// keep the coefficients in locals so the lane loops stay in registers
+			const auto b0 = mB0;
+			const auto b1 = mB1;
+			const auto b2 = mB2;
+			const auto a1 = mA1;
+			const auto a2 = mA2;
+			auto xn = Frame();
+			auto yn = Frame();
+
+			for(size_t i = 0; i < size; ++i) {
+				for(size_t lane = 0; lane < Lanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					xn[lane] = inputs[lane][i];
+				}
+
+				for(size_t lane = 0; lane < Lanes; ++lane) {
+					yn[lane] = b0[lane] * xn[lane] + s1[lane];
+					s1[lane] = b1[lane] * xn[lane] - a1[lane] * yn[lane] + s2[lane];
+					s2[lane] = b2[lane] * xn[lane] - a2[lane] * yn[lane];
+				}
+
+				for(size_t lane = 0; lane < Lanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					outputs[lane][i] = yn[lane];
+				}
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiQuadBatch)
+	};
+} // namespace apex::dsp
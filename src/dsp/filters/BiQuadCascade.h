@@ -0,0 +1,382 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "../../base/StandardIncludes.h"
+#include "BiQuadFilter.h"
+#include "ResponseGrid.h"
+
+namespace apex::dsp {
+	/// @brief A cascade of up to `MaxStages` BiQuad Filters (second-order sections), stored
+	/// inline, for building higher-order filters
+	///
+	/// The coefficients and state of every stage are kept in contiguous arrays, and block
+	/// processing keeps them in locals for the whole block. Each sample is run through every
+	/// stage before moving on to the next, which lets the recursions of successive stages
+	/// overlap in the pipeline. Running each stage over the whole block in turn serializes on
+	/// the latency of a single stage's recursion instead, and is slower
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	/// @tparam MaxStages - The maximum number of stages in the cascade
+	template<typename FloatType = float,
+			 size_t MaxStages = 8,
+			 std::enable_if_t<std::is_floating_point_v<FloatType> && (MaxStages > 0), bool> = true>
+	class BiQuadCascade {
+	  public:
+		/// @brief Constructs a default `BiQuadCascade`, with a single stage
+		BiQuadCascade() noexcept {
+			for(auto& stage : mStages) {
+				stage.setDeferredUpdates(true);
+			}
+			updateCoefficients();
+		}
+
+		/// @brief Move constructs a `BiQuadCascade` from the given one
+		///
+		/// @param cascade - The `BiQuadCascade` to move
+		BiQuadCascade(BiQuadCascade&& cascade) noexcept = default;
+		~BiQuadCascade() noexcept = default;
+
+		/// @brief Returns the maximum number of stages in this cascade
+		///
+		/// @return - The maximum number of stages
+		[[nodiscard]] static constexpr inline auto getMaxNumStages() noexcept -> size_t {
+			return MaxStages;
+		}
+
+		/// @brief Sets the number of active stages in this cascade
+		///
+		/// @param numStages - The new number of stages, in [1, MaxStages]
+		inline auto setNumStages(size_t numStages) noexcept -> void {
+			jassert(numStages > 0 && numStages <= MaxStages);
+			mNumStages = std::clamp(numStages, static_cast<size_t>(1), MaxStages);
+		}
+
+		/// @brief Returns the number of active stages in this cascade
+		///
+		/// @return - The number of stages
+		[[nodiscard]] inline auto getNumStages() const noexcept -> size_t {
+			return mNumStages;
+		}
+
+		/// @brief Replaces the given stage with the given filter
+		///
+		/// @param stage - The index of the stage to replace
+		/// @param filter - The filter to use for the stage
+		inline auto setStage(size_t stage, BiQuadFilter<FloatType>&& filter) noexcept -> void {
+			jassert(stage < MaxStages);
+			mStages.at(stage) = std::move(filter);
+			mStages.at(stage).setDeferredUpdates(true);
+			markCoefficientsDirty();
+		}
+
+		/// @brief Returns the filter used for the given stage
+		///
+		/// @param stage - The index of the stage
+		///
+		/// @return - The filter for the stage
+		[[nodiscard]] inline auto
+		getStage(size_t stage) const noexcept -> const BiQuadFilter<FloatType>& {
+			jassert(stage < MaxStages);
+			return mStages.at(stage);
+		}
+
+		/// @brief Sets the frequency of every active stage to the given value
+		///
+		/// @param frequency - The new frequency, in Hertz
+		inline auto setFrequency(Hertz frequency) noexcept -> void {
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				mStages.at(stage).setFrequency(frequency);
+			}
+			markCoefficientsDirty();
+		}
+
+		/// @brief Sets the Q of every active stage to the given value
+		///
+		/// @param q - The new Q
+		inline auto setQ(FloatType q) noexcept -> void {
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				mStages.at(stage).setQ(q);
+			}
+			markCoefficientsDirty();
+		}
+
+		/// @brief Sets the gain of every active stage to the given value
+		///
+		/// @param gain - The new gain, in Decibels
+		inline auto setGainDB(Decibels gain) noexcept -> void {
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				mStages.at(stage).setGainDB(gain);
+			}
+			markCoefficientsDirty();
+		}
+
+		/// @brief Sets the sample rate of every active stage to the given value
+		///
+		/// @param sampleRate - The new sample rate, in Hertz
+		inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				mStages.at(stage).setSampleRate(sampleRate);
+			}
+			markCoefficientsDirty();
+		}
+
+		/// @brief Sets the method used to design the coefficients of every active stage
+		///
+		/// @param method - The new design method
+		inline auto setDesignMethod(DesignMethod method) noexcept -> void {
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				mStages.at(stage).setDesignMethod(method);
+			}
+			markCoefficientsDirty();
+		}
+
+		/// @brief Sets whether coefficient updates are deferred. When deferred, the parameter
+		/// setters only mark the coefficients as out of date, and they are recalculated once, at
+		/// the start of the next block (or the next call to `updateCoefficientsIfNeeded`).
+		///
+		/// Per-sample processing does not check for pending changes, so when using it in
+		/// deferred mode, call `updateCoefficientsIfNeeded` at the start of each block
+		///
+		/// @param deferred - Whether coefficient updates should be deferred
+		inline auto setDeferredUpdates(bool deferred) noexcept -> void {
+			mDeferredUpdates = deferred;
+			if(!mDeferredUpdates) {
+				updateCoefficientsIfNeeded();
+			}
+		}
+
+		/// @brief Returns whether coefficient updates are deferred
+		///
+		/// @return - Whether updates are deferred
+		[[nodiscard]] inline auto getDeferredUpdates() const noexcept -> bool {
+			return mDeferredUpdates;
+		}
+
+		/// @brief Recalculates the coefficients of any stages whose parameters have changed since
+		/// they were last calculated
+		///
+		/// @return - Whether any coefficients were recalculated
+		inline auto updateCoefficientsIfNeeded() noexcept -> bool {
+			if(mCoefficientsDirty) {
+				updateCoefficients();
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Applies the given (already calculated) design to the given stage, so no maths is
+		/// done here
+		///
+		/// @param stage - The index of the stage
+		/// @param design - The design to apply
+		inline auto
+		setStageDesign(size_t stage, const BiQuadDesign<FloatType>& design) noexcept -> void {
+			jassert(stage < MaxStages);
+			mStages.at(stage).setDesign(design);
+			mCoefficients.at(stage) = design.coefficients;
+		}
+
+		/// @brief Copies the stage count and (already calculated) coefficients of the given
+		/// cascade into this one, so that a design shared by several channels only has to be
+		/// calculated once. The state of this cascade is kept
+		///
+		/// @param cascade - The cascade to copy the coefficients of
+		inline auto copyCoefficientsFrom(const BiQuadCascade& cascade) noexcept -> void {
+			jassert(!cascade.mCoefficientsDirty);
+			mNumStages = cascade.mNumStages;
+			mCoefficients = cascade.mCoefficients;
+			mCoefficientsDirty = false;
+		}
+
+		/// @brief Applies every active stage of this cascade to the given input value
+		///
+		/// @param input - The input value to apply filtering to
+		///
+		/// @return - The filtered value
+		[[nodiscard]] inline auto process(FloatType input) noexcept -> FloatType {
+			auto x = input;
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				const auto& coefficients = mCoefficients.at(stage);
+				auto& s1 = mS1.at(stage);
+				auto& s2 = mS2.at(stage);
+
+				const auto yn = coefficients.b0 * x + s1;
+				s1 = coefficients.b1 * x - coefficients.a1 * yn + s2;
+				s2 = coefficients.b2 * x - coefficients.a2 * yn;
+				x = yn;
+			}
+			return x;
+		}
+
+		/// @brief Applies every active stage of this cascade to the array of given input values
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto process(Span<FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			updateCoefficientsIfNeeded();
+			processBlock(input.data(), output.data(), input.size());
+		}
+
+		/// @brief Applies every active stage of this cascade to the array of given input values
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto process(Span<const FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			updateCoefficientsIfNeeded();
+			processBlock(input.data(), output.data(), input.size());
+		}
+
+		/// @brief Resets every stage of this cascade to an initial state
+		inline auto reset() noexcept -> void {
+			mS1.fill(narrow_cast<FloatType>(0.0));
+			mS2.fill(narrow_cast<FloatType>(0.0));
+		}
+
+		/// @brief Calculates the magnitude response of this cascade for the given frequency
+		///
+		/// @param frequency - The frequency to calculate the magnitude response for, in Hertz
+		///
+		/// @return - The magnitude response at the given frequency
+		[[nodiscard]] inline auto
+		getMagnitudeForFrequency(Hertz frequency) const noexcept -> FloatType {
+			auto x = narrow_cast<FloatType>(1.0);
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				x *= mStages.at(stage).getMagnitudeForFrequency(frequency);
+			}
+			return x;
+		}
+
+		/// @brief Calculates the phase response of this cascade for the given frequency
+		///
+		/// @param frequency - The frequency to calculate the phase response for, in Hertz
+		///
+		/// @return - The phase response at the given frequency
+		[[nodiscard]] inline auto getPhaseForFrequency(Hertz frequency) const noexcept -> Radians {
+			Radians x = 0.0_rad;
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				x += mStages.at(stage).getPhaseForFrequency(frequency);
+			}
+			return x;
+		}
+
+		/// @brief Calculates the magnitude response of this cascade at every point of the given
+		/// grid
+		///
+		/// @param grid - The frequencies to calculate the magnitude response for
+		/// @param magnitudes - The array to store the magnitudes in
+		inline auto getMagnitudesForFrequencies(const ResponseGrid<FloatType>& grid,
+												Span<FloatType> magnitudes) const noexcept -> void {
+			jassert(grid.getSampleRate() == mStages.at(0).getSampleRate());
+			const auto coefficients = getCurrentCoefficients();
+			const auto stages = Span<const BiQuadCoefficients<FloatType>>::MakeSpan(
+				coefficients.data(),
+				mNumStages);
+			grid.getMagnitudes(stages, magnitudes);
+		}
+
+		/// @brief Calculates the phase response of this cascade at every point of the given grid
+		///
+		/// @param grid - The frequencies to calculate the phase response for
+		/// @param phases - The array to store the phases in
+		inline auto getPhasesForFrequencies(const ResponseGrid<FloatType>& grid,
+											Span<Radians> phases) const noexcept -> void {
+			jassert(grid.getSampleRate() == mStages.at(0).getSampleRate());
+			const auto coefficients = getCurrentCoefficients();
+			const auto stages = Span<const BiQuadCoefficients<FloatType>>::MakeSpan(
+				coefficients.data(),
+				mNumStages);
+			grid.getPhases(stages, phases);
+		}
+
+		auto operator=(BiQuadCascade&& cascade) noexcept -> BiQuadCascade& = default;
+
+	  private:
+		/// The designs of each stage, holding the parameters and calculating coefficients
+		std::array<BiQuadFilter<FloatType>, MaxStages> mStages
+			= std::array<BiQuadFilter<FloatType>, MaxStages>();
+		std::array<BiQuadCoefficients<FloatType>, MaxStages> mCoefficients
+			= std::array<BiQuadCoefficients<FloatType>, MaxStages>();
+
+		/// Transposed Direct Form II state, one entry per stage
+		std::array<FloatType, MaxStages> mS1 = std::array<FloatType, MaxStages>();
+		std::array<FloatType, MaxStages> mS2 = std::array<FloatType, MaxStages>();
+
+		size_t mNumStages = 1;
+		bool mDeferredUpdates = false;
+		bool mCoefficientsDirty = false;
+
+		/// @brief Copies the coefficients of each stage's design into the cascade, recalculating
+		/// only those stages whose parameters have changed
+		inline auto updateCoefficients() noexcept -> void {
+			for(size_t stage = 0; stage < MaxStages; ++stage) {
+				mStages.at(stage).updateCoefficientsIfNeeded();
+				mCoefficients.at(stage) = mStages.at(stage).getCoefficients();
+			}
+			mCoefficientsDirty = false;
+		}
+
+		/// @brief Returns the coefficients matching the current parameters of every stage. If an
+		/// update is pending, they are calculated without being applied
+		///
+		/// @return - The coefficients
+		[[nodiscard]] inline auto getCurrentCoefficients() const noexcept
+			-> std::array<BiQuadCoefficients<FloatType>, MaxStages> {
+			if(!mCoefficientsDirty) {
+				return mCoefficients;
+			}
+
+			auto coefficients = std::array<BiQuadCoefficients<FloatType>, MaxStages>();
+			for(size_t stage = 0; stage < mNumStages; ++stage) {
+				coefficients.at(stage) = mStages.at(stage).getCoefficients();
+			}
+			return coefficients;
+		}
+
+		/// @brief Marks the coefficients as out of date, recalculating them immediately unless
+		/// updates are deferred
+		inline auto markCoefficientsDirty() noexcept -> void {
+			mCoefficientsDirty = true;
+			if(!mDeferredUpdates) {
+				updateCoefficients();
+			}
+		}
+
+		/// @brief Applies every active stage to `size` samples from `input`, storing the results
+		/// in `output`. `input` and `output` may alias
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of samples to process
+		inline auto
+		processBlock(const FloatType* input, FloatType* output, size_t size) noexcept -> void {
+			// keep the coefficients and state in locals so they stay in registers across the loop
+			const auto coefficients = mCoefficients;
+			const auto numStages = mNumStages;
+			auto s1 = mS1;
+			auto s2 = mS2;
+
+			for(size_t i = 0; i < size; ++i) {
+				auto x = input[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				for(size_t stage = 0; stage < numStages; ++stage) {
+					const auto yn = coefficients[stage].b0 * x + s1[stage];
+					s1[stage] = coefficients[stage].b1 * x - coefficients[stage].a1 * yn
+								+ s2[stage];
+					s2[stage] = coefficients[stage].b2 * x - coefficients[stage].a2 * yn;
+					x = yn;
+				}
+				output[i] = x; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+
+			mS1 = s1;
+			mS2 = s2;
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiQuadCascade)
+	};
+} // namespace apex::dsp
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../base/StandardIncludes.h"
+#include "BiQuadFilter.h"
+
+namespace apex::dsp {
+	/// @brief A single-channel BiQuad Filter for offline rendering of long buffers, which splits
+	/// each block into `Chunks` consecutive chunks and filters them side by side, as the lanes of
+	/// a SIMD register, instead of one sample after another
+	///
+	/// Each block is processed in three passes:
+	/// 1. Every chunk is filtered from a zero state, all chunks together in lanes
+	/// 2. The true starting state of each chunk is found by propagating the state through the
+	/// chunks (only `Chunks` 2x2 matrix steps)
+	/// 3. The response to each chunk's starting state, precomputed for the filter's current
+	/// coefficients, is scaled and added to its output, again with all chunks in lanes
+	///
+	/// By linearity this is the same as the serial recursion, but the additions happen in a
+	/// different order, so the output differs from `BiQuadFilter` by rounding only: within
+	/// `TOLERANCE` (relative to the peak of the output) for well-damped designs. Designs with
+	/// poles very close to the unit circle (very low frequency or very high Q) amplify the
+	/// rounding, and should be checked against the serial path before being relied on.
+	///
+	/// This allocates scratch space in `setBufferSize`, and is meant for offline processing;
+	/// realtime code should use `BiQuadFilter`
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	/// @tparam Chunks - The number of chunks each block is split into
+	template<typename FloatType = float,
+			 size_t Chunks = 8,
+			 std::enable_if_t<std::is_floating_point_v<FloatType> && (Chunks > 1), bool> = true>
+	class BiQuadChunked {
+	  public:
+		/// The maximum difference from the serial path, relative to the peak output level, for
+		/// well-damped designs
+		static constexpr FloatType TOLERANCE
+			= std::is_same_v<FloatType, float> ? narrow_cast<FloatType>(1.0e-5) :
+												 narrow_cast<FloatType>(1.0e-12);
+
+		/// @brief Constructs a default `BiQuadChunked`
+		BiQuadChunked() noexcept {
+			mDesign.setDeferredUpdates(true);
+			updateCoefficients();
+		}
+
+		/// @brief Constructs a `BiQuadChunked` using the given filter design
+		///
+		/// @param design - The `BiQuadFilter` to use as the design
+		explicit BiQuadChunked(BiQuadFilter<FloatType>&& design) noexcept
+			: mDesign(std::move(design)) {
+			mDesign.setDeferredUpdates(true);
+			updateCoefficients();
+		}
+
+		/// @brief Move constructs a `BiQuadChunked` from the given one
+		///
+		/// @param filt - The `BiQuadChunked` to move
+		BiQuadChunked(BiQuadChunked&& filt) noexcept = default;
+		~BiQuadChunked() noexcept = default;
+
+		/// @brief Sets the maximum number of samples that will be processed at once, allocating
+		/// the necessary scratch space. Blocks larger than this are processed in several parts
+		///
+		/// @param bufferSize - The maximum block size
+		inline auto setBufferSize(size_t bufferSize) noexcept -> void {
+			mChunkCapacity = bufferSize / Chunks;
+			mScratch.resize(mChunkCapacity * Chunks);
+			// the state responses are needed for one sample past the end of a chunk, to find the
+			// state the next chunk starts from
+			mResponseS1ToOutput.resize(mChunkCapacity + 1);
+			mResponseS2ToOutput.resize(mChunkCapacity + 1);
+			mResponseS1ToS2.resize(mChunkCapacity + 1);
+			mResponseS2ToS2.resize(mChunkCapacity + 1);
+			mResponsesDirty = true;
+		}
+
+		/// @brief Returns the maximum number of samples that are processed at once
+		///
+		/// @return - The maximum block size
+		[[nodiscard]] inline auto getBufferSize() const noexcept -> size_t {
+			return mChunkCapacity * Chunks;
+		}
+
+		/// @brief Applies the given (already calculated) design to this filter
+		///
+		/// @param design - The design to apply
+		inline auto setDesign(const BiQuadDesign<FloatType>& design) noexcept -> void {
+			mDesign.setDesign(design);
+			updateCoefficients();
+		}
+
+		/// @brief Returns the current design (parameters and coefficients) of this filter
+		///
+		/// @return - The design
+		[[nodiscard]] inline auto getDesign() const noexcept -> BiQuadDesign<FloatType> {
+			return mDesign.getDesign();
+		}
+
+		/// @brief Applies this filter to the array of given input values
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto process(Span<FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			processBlocks(input.data(), output.data(), input.size());
+		}
+
+		/// @brief Applies this filter to the array of given input values
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto process(Span<const FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			processBlocks(input.data(), output.data(), input.size());
+		}
+
+		/// @brief Resets this filter to an initial state
+		inline auto reset() noexcept -> void {
+			mS1 = narrow_cast<FloatType>(0.0);
+			mS2 = narrow_cast<FloatType>(0.0);
+		}
+
+		auto operator=(BiQuadChunked&& filt) noexcept -> BiQuadChunked& = default;
+
+	  private:
+		/// Chunks shorter than this are not worth the extra passes, and are filtered serially
+		static constexpr size_t MIN_CHUNK_SIZE = 32;
+
+		using Frame = std::array<FloatType, Chunks>;
+
+		BiQuadFilter<FloatType> mDesign = BiQuadFilter<FloatType>();
+		BiQuadCoefficients<FloatType> mCoefficients = BiQuadCoefficients<FloatType>();
+
+		/// Transposed Direct Form II state, carried between blocks
+		FloatType mS1 = narrow_cast<FloatType>(0.0);
+		FloatType mS2 = narrow_cast<FloatType>(0.0);
+
+		size_t mChunkCapacity = 0;
+		/// The chunks of the current block, interleaved so that the lanes of each frame are
+		/// contiguous
+		std::vector<FloatType> mScratch = std::vector<FloatType>();
+		/// The output (equal to `s1` when there is no input) and `s2` state, `n` samples after
+		/// starting from a unit `s1` or `s2` state with no input
+		std::vector<FloatType> mResponseS1ToOutput = std::vector<FloatType>();
+		std::vector<FloatType> mResponseS2ToOutput = std::vector<FloatType>();
+		std::vector<FloatType> mResponseS1ToS2 = std::vector<FloatType>();
+		std::vector<FloatType> mResponseS2ToS2 = std::vector<FloatType>();
+		/// The number of samples before the responses have decayed to nothing
+		size_t mResponseLength = 0;
+		bool mResponsesDirty = true;
+
+		/// @brief Copies the coefficients of the design into this filter
+		inline auto updateCoefficients() noexcept -> void {
+			mDesign.updateCoefficientsIfNeeded();
+			mCoefficients = mDesign.getCoefficients();
+			mResponsesDirty = true;
+		}
+
+		/// @brief Calculates the zero-input responses to unit `s1` and `s2` states, for the
+		/// current coefficients. They are calculated in double precision, because every chunk's
+		/// correction is scaled from them. Once they have decayed below anything that could
+		/// affect the output they are cut off, which also keeps them from going denormal
+		inline auto updateResponses() noexcept -> void {
+			const auto a1 = static_cast<double>(mCoefficients.a1);
+			const auto a2 = static_cast<double>(mCoefficients.a2);
+			const auto epsilon = static_cast<double>(std::numeric_limits<FloatType>::epsilon());
+			const auto cutoff = epsilon * epsilon;
+			// from s1 = 1, s2 = 0 and from s1 = 0, s2 = 1
+			auto s1FromS1 = 1.0;
+			auto s2FromS1 = 0.0;
+			auto s1FromS2 = 0.0;
+			auto s2FromS2 = 1.0;
+			const auto size = mResponseS1ToOutput.size();
+			mResponseLength = size;
+			for(size_t i = 0; i < size; ++i) {
+				if(mResponseLength == size
+				   && std::max({std::abs(s1FromS1),
+								std::abs(s2FromS1),
+								std::abs(s1FromS2),
+								std::abs(s2FromS2)})
+						  < cutoff)
+				{
+					mResponseLength = i;
+				}
+				const auto decayed = i >= mResponseLength;
+				mResponseS1ToOutput[i] = decayed ? FloatType(0) : narrow_cast<FloatType>(s1FromS1);
+				mResponseS2ToOutput[i] = decayed ? FloatType(0) : narrow_cast<FloatType>(s1FromS2);
+				mResponseS1ToS2[i] = decayed ? FloatType(0) : narrow_cast<FloatType>(s2FromS1);
+				mResponseS2ToS2[i] = decayed ? FloatType(0) : narrow_cast<FloatType>(s2FromS2);
+
+				// with no input, yn = s1, s1' = -a1 * yn + s2, s2' = -a2 * yn
+				const auto nextS1FromS1 = -a1 * s1FromS1 + s2FromS1;
+				s2FromS1 = -a2 * s1FromS1;
+				s1FromS1 = nextS1FromS1;
+				const auto nextS1FromS2 = -a1 * s1FromS2 + s2FromS2;
+				s2FromS2 = -a2 * s1FromS2;
+				s1FromS2 = nextS1FromS2;
+			}
+			mResponsesDirty = false;
+		}
+
+		/// @brief Applies this filter to `size` samples from `input`, in blocks of at most the
+		/// buffer size, storing the results in `output`. `input` and `output` may alias
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of samples to process
+		inline auto
+		processBlocks(const FloatType* input, FloatType* output, size_t size) noexcept -> void {
+			auto offset = size_t(0);
+			while(offset < size) {
+				const auto chunkSize = std::min((size - offset) / Chunks, mChunkCapacity);
+				if(chunkSize < MIN_CHUNK_SIZE) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					processSerial(input + offset, output + offset, size - offset);
+					return;
+				}
+
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				processChunks(input + offset, output + offset, chunkSize);
+				offset += chunkSize * Chunks;
+			}
+		}
+
+		/// @brief Applies this filter to `size` samples from `input` with the serial recursion,
+		/// storing the results in `output`
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of samples to process
+		inline auto
+		processSerial(const FloatType* input, FloatType* output, size_t size) noexcept -> void {
+			const auto b0 = mCoefficients.b0;
+			const auto b1 = mCoefficients.b1;
+			const auto b2 = mCoefficients.b2;
+			const auto a1 = mCoefficients.a1;
+			const auto a2 = mCoefficients.a2;
+			auto s1 = mS1;
+			auto s2 = mS2;
+
+			for(size_t i = 0; i < size; ++i) {
+				const auto xn = input[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto yn = b0 * xn + s1;
+				s1 = b1 * xn - a1 * yn + s2;
+				s2 = b2 * xn - a2 * yn;
+				output[i] = yn; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+
+			mS1 = s1;
+			mS2 = s2;
+		}
+
+		/// @brief Applies this filter to `Chunks` consecutive chunks of `chunkSize` samples from
+		/// `input`, storing the results in `output`. `input` and `output` may alias
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param chunkSize - The number of samples in each chunk
+		inline auto processChunks(const FloatType* input,
+								  FloatType* output,
+								  size_t chunkSize) noexcept -> void {
+			if(mResponsesDirty) {
+				updateResponses();
+			}
+
+			auto* scratch = mScratch.data();
+			for(size_t chunk = 0; chunk < Chunks; ++chunk) {
+				for(size_t i = 0; i < chunkSize; ++i) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					scratch[i * Chunks + chunk] = input[chunk * chunkSize + i];
+				}
+			}
+
+			// 1. filter every chunk from a zero state, all chunks in lanes
+			const auto b0 = mCoefficients.b0;
+			const auto b1 = mCoefficients.b1;
+			const auto b2 = mCoefficients.b2;
+			const auto a1 = mCoefficients.a1;
+			const auto a2 = mCoefficients.a2;
+			auto s1 = Frame();
+			auto s2 = Frame();
+			for(size_t i = 0; i < chunkSize; ++i) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto* frame = scratch + i * Chunks;
+				for(size_t lane = 0; lane < Chunks; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto xn = frame[lane];
+					const auto yn = b0 * xn + s1[lane];
+					s1[lane] = b1 * xn - a1 * yn + s2[lane];
+					s2[lane] = b2 * xn - a2 * yn;
+					frame[lane] = yn; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				}
+			}
+
+			// 2. propagate the true state through the chunks
+			const auto s1ToS1 = mResponseS1ToOutput[chunkSize];
+			const auto s2ToS1 = mResponseS2ToOutput[chunkSize];
+			const auto s1ToS2 = mResponseS1ToS2[chunkSize];
+			const auto s2ToS2 = mResponseS2ToS2[chunkSize];
+			auto start1 = Frame();
+			auto start2 = Frame();
+			auto state1 = mS1;
+			auto state2 = mS2;
+			for(size_t chunk = 0; chunk < Chunks; ++chunk) {
+				start1[chunk] = state1;
+				start2[chunk] = state2;
+				const auto next1 = s1ToS1 * state1 + s2ToS1 * state2 + s1[chunk];
+				state2 = s1ToS2 * state1 + s2ToS2 * state2 + s2[chunk];
+				state1 = next1;
+			}
+			mS1 = state1;
+			mS2 = state2;
+
+			// 3. add the response to each chunk's starting state, all chunks in lanes
+			const auto correctionSize = std::min(chunkSize, mResponseLength);
+			for(size_t i = 0; i < correctionSize; ++i) {
+				const auto fromS1 = mResponseS1ToOutput[i];
+				const auto fromS2 = mResponseS2ToOutput[i];
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto* frame = scratch + i * Chunks;
+				for(size_t lane = 0; lane < Chunks; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					frame[lane] += fromS1 * start1[lane] + fromS2 * start2[lane];
+				}
+			}
+
+			for(size_t chunk = 0; chunk < Chunks; ++chunk) {
+				for(size_t i = 0; i < chunkSize; ++i) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					output[chunk * chunkSize + i] = scratch[i * Chunks + chunk];
+				}
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiQuadChunked)
+	};
+} // namespace apex::dsp
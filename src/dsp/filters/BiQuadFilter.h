@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <type_traits>
 #include <utility>
 
@@ -20,9 +22,54 @@ namespace apex::dsp {
 		AnalogBell
 	};
 
+	/// @brief The different ways of designing the coefficients of a BiQuad Filter from its
+	/// analog prototype, available for every `FilterType`
+	enum class DesignMethod
+	{
+		/// The RBJ cookbook designs (bilinear transform). Cheapest to calculate, but the
+		/// response is cramped towards Nyquist
+		Bilinear,
+		/// Poles matched to the analog prototype's, with the zeros chosen so that the magnitude
+		/// response matches the prototype's at DC, at the filter's frequency, and at Nyquist.
+		/// Tracks the analog response up to Nyquist without oversampling, at the cost of a
+		/// more expensive design
+		MagnitudeMatched
+	};
+
+	/// @brief The coefficients of a BiQuad Filter, normalized so that a0 == 1
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	struct BiQuadCoefficients {
+		FloatType b0 = narrow_cast<FloatType>(1.0);
+		FloatType b1 = narrow_cast<FloatType>(0.0);
+		FloatType b2 = narrow_cast<FloatType>(0.0);
+		FloatType a1 = narrow_cast<FloatType>(0.0);
+		FloatType a2 = narrow_cast<FloatType>(0.0);
+	};
+
+	/// @brief The parameters of a BiQuad Filter together with the coefficients calculated for
+	/// them. Designs can be calculated on any thread (eg. the message thread) and applied to a
+	/// filter later without any further maths
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	struct BiQuadDesign {
+		FilterType type = FilterType::Bell;
+		Hertz frequency = 1.0_kHz;
+		FloatType q = narrow_cast<FloatType>(0.7);
+		Decibels gain = 0.0_dB;
+		Hertz sampleRate = 44.1_kHz;
+		DesignMethod method = DesignMethod::Bilinear;
+		BiQuadCoefficients<FloatType> coefficients = BiQuadCoefficients<FloatType>();
+	};
+
 	/// @brief Basic BiQuad Filter implementation
 	///
 	/// @see https://www.musicdsp.org/en/latest/Filters/197-rbj-audio-eq-cookbook.html
+	/// @see https://vicanek.de/articles/BiquadFits.pdf
 	///
 	/// @tparam FloatType - The floating point type to back operations, either float or double
 	template<typename FloatType = float,
@@ -512,7 +559,7 @@ namespace apex::dsp {
 		/// @param frequency - The new frequency, in Hertz
 		inline auto setFrequency(Hertz frequency) noexcept -> void {
 			mFrequency = frequency;
-			updateCoefficients();
+			markCoefficientsDirty();
 		}
 
 		/// @brief Returns the frequency of this filter
@@ -528,7 +575,7 @@ namespace apex::dsp {
 		inline auto setQ(FloatType q) noexcept -> void {
 			jassert(q > narrow_cast<FloatType>(0.0));
 			mQ = q;
-			updateCoefficients();
+			markCoefficientsDirty();
 		}
 
 		/// @brief Returns the Q of this filter
@@ -543,7 +590,7 @@ namespace apex::dsp {
 		/// @param gain - The new gain, in Decibels
 		inline auto setGainDB(Decibels gain) noexcept -> void {
 			mGain = gain;
-			updateCoefficients();
+			markCoefficientsDirty();
 		}
 
 		/// @brief Returns the gain of this filter
@@ -558,7 +605,7 @@ namespace apex::dsp {
 		/// @param sampleRate - The new sample rate, in Hertz
 		inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
 			mSampleRate = sampleRate;
-			updateCoefficients();
+			markCoefficientsDirty();
 		}
 
 		/// @brief Returns the sample rate of this filter
@@ -568,19 +615,132 @@ namespace apex::dsp {
 			return mSampleRate;
 		}
 
+		/// @brief Sets the method used to design the coefficients of this filter
+		///
+		/// @param method - The new design method
+		inline auto setDesignMethod(DesignMethod method) noexcept -> void {
+			mMethod = method;
+			markCoefficientsDirty();
+		}
+
+		/// @brief Returns the method used to design the coefficients of this filter
+		///
+		/// @return - The design method
+		[[nodiscard]] inline auto getDesignMethod() const noexcept -> DesignMethod {
+			return mMethod;
+		}
+
+		/// @brief Calculates the design of a filter with the given parameters. Does not touch
+		/// any filter, so it is safe to call from any thread
+		///
+		/// @param type - The type of the filter
+		/// @param frequency - The frequency of the filter, in Hertz
+		/// @param q - The Q of the filter
+		/// @param gain - The gain of the filter, in Decibels
+		/// @param sampleRate - The sample rate, in Hertz
+		/// @param method - The method to design the coefficients with
+		///
+		/// @return - The design
+		[[nodiscard]] static inline auto
+		calculateDesign(FilterType type,
+						Hertz frequency,
+						FloatType q,
+						Decibels gain,
+						Hertz sampleRate,
+						DesignMethod method = DesignMethod::Bilinear) noexcept
+			-> BiQuadDesign<FloatType> {
+			return {type,
+					frequency,
+					q,
+					gain,
+					sampleRate,
+					method,
+					calculateCoefficients(type, frequency, q, gain, sampleRate, method)};
+		}
+
+		/// @brief Applies the given design to this filter. The design's coefficients are used
+		/// as-is, so no maths is done here
+		///
+		/// @param design - The design to apply
+		inline auto setDesign(const BiQuadDesign<FloatType>& design) noexcept -> void {
+			mType = design.type;
+			mFrequency = design.frequency;
+			mQ = design.q;
+			mGain = design.gain;
+			mSampleRate = design.sampleRate;
+			mMethod = design.method;
+			mB0 = design.coefficients.b0;
+			mB1 = design.coefficients.b1;
+			mB2 = design.coefficients.b2;
+			mA1 = design.coefficients.a1;
+			mA2 = design.coefficients.a2;
+			mCoefficientsDirty = false;
+		}
+
+		/// @brief Returns the current design (parameters and coefficients) of this filter
+		///
+		/// @return - The design
+		[[nodiscard]] inline auto getDesign() const noexcept -> BiQuadDesign<FloatType> {
+			return {mType, mFrequency, mQ, mGain, mSampleRate, mMethod, getCoefficients()};
+		}
+
+		/// @brief Sets whether coefficient updates are deferred. When deferred, the parameter
+		/// setters only mark the coefficients as out of date, and they are recalculated once, at
+		/// the start of the next block (or the next call to `updateCoefficientsIfNeeded`), no
+		/// matter how many parameters changed in between.
+		///
+		/// Per-sample `process` does not check for pending changes, so when using it in
+		/// deferred mode, call `updateCoefficientsIfNeeded` at the start of each block
+		///
+		/// @param deferred - Whether coefficient updates should be deferred
+		inline auto setDeferredUpdates(bool deferred) noexcept -> void {
+			mDeferredUpdates = deferred;
+			if(!mDeferredUpdates) {
+				updateCoefficientsIfNeeded();
+			}
+		}
+
+		/// @brief Returns whether coefficient updates are deferred
+		///
+		/// @return - Whether updates are deferred
+		[[nodiscard]] inline auto getDeferredUpdates() const noexcept -> bool {
+			return mDeferredUpdates;
+		}
+
+		/// @brief Recalculates the coefficients of this filter if any parameters have changed
+		/// since they were last calculated
+		///
+		/// @return - Whether the coefficients were recalculated
+		inline auto updateCoefficientsIfNeeded() noexcept -> bool {
+			if(mCoefficientsDirty) {
+				updateCoefficients();
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Returns the (normalized) coefficients matching the current parameters of this
+		/// filter. If an update is pending, they are calculated without being applied
+		///
+		/// @return - The coefficients
+		[[nodiscard]] inline auto
+		getCoefficients() const noexcept -> BiQuadCoefficients<FloatType> {
+			if(mCoefficientsDirty) {
+				return calculateCoefficients(mType, mFrequency, mQ, mGain, mSampleRate, mMethod);
+			}
+			return {mB0, mB1, mB2, mA1, mA2};
+		}
+
 		/// @brief Applies this filter to the given input value
 		///
 		/// @param input - The input value to apply filtering to
 		///
 		/// @return - The filtered value
 		[[nodiscard]] inline auto process(FloatType input) noexcept -> FloatType {
-			auto yn = input * mB0 / mA0 + mX1 * mB1 / mA0 + mX2 * mB2 / mA0 - mY1 * mA1 / mA0
-					  - mY2 * mA2 / mA0;
-
-			mX2 = mX1;
-			mX1 = input;
-			mY2 = mY1;
-			mY1 = yn;
+			// Transposed Direct Form II, coefficients are pre-normalized by a0
+			auto yn = mB0 * input + mS1;
+			mS1 = mB1 * input - mA1 * yn + mS2;
+			mS2 = mB2 * input - mA2 * yn;
 
 			return yn;
 		}
@@ -591,10 +751,8 @@ namespace apex::dsp {
 		/// @param output - The array to store the output values in
 		inline auto process(Span<FloatType> input, Span<FloatType> output) noexcept -> void {
 			jassert(input.size() == output.size());
-			auto size = input.size();
-			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = process(input.at(i));
-			}
+			updateCoefficientsIfNeeded();
+			processBlock(input.data(), output.data(), input.size());
 		}
 
 		/// @brief Applies this filter to the array of given input values, in place
@@ -603,18 +761,14 @@ namespace apex::dsp {
 		/// @param output - The array to store the output values in
 		inline auto process(Span<const FloatType> input, Span<FloatType> output) noexcept -> void {
 			jassert(input.size() == output.size());
-			auto size = input.size();
-			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = process(input.at(i));
-			}
+			updateCoefficientsIfNeeded();
+			processBlock(input.data(), output.data(), input.size());
 		}
 
 		/// @brief Resets this filter to an initial state
 		inline auto reset() noexcept -> void {
-			mY1 = narrow_cast<FloatType>(0.0);
-			mY2 = narrow_cast<FloatType>(0.0);
-			mX1 = narrow_cast<FloatType>(0.0);
-			mX2 = narrow_cast<FloatType>(0.0);
+			mS1 = narrow_cast<FloatType>(0.0);
+			mS2 = narrow_cast<FloatType>(0.0);
 		}
 
 		/// @brief Calculates the magnitude response of this filter for the given frequency
@@ -625,10 +779,11 @@ namespace apex::dsp {
 		[[nodiscard]] inline auto
 		getMagnitudeForFrequency(Hertz frequency) const noexcept -> FloatType {
 			auto one = narrow_cast<FloatType>(1.0);
-			constexpr std::complex<FloatType> j(narrow_cast<FloatType>(0.0), one);
+			const std::complex<FloatType> j(narrow_cast<FloatType>(0.0), one);
 			const size_t order = 2;
+			const auto current = getCoefficients();
 			const std::array<FloatType, 5> coefficients
-				= {mB0 / mA0, mB1 / mA0, mB2 / mA0, mA1 / mA0, mA2 / mA0};
+				= {current.b0, current.b1, current.b2, current.a1, current.a2};
 
 			jassert(frequency >= 0.0_Hz
 					&& frequency
@@ -679,10 +834,11 @@ namespace apex::dsp {
 		/// @return - The phase response at the given frequency
 		[[nodiscard]] inline auto getPhaseForFrequency(Hertz frequency) const noexcept -> Radians {
 			auto one = narrow_cast<FloatType>(1.0);
-			constexpr std::complex<FloatType> j(narrow_cast<FloatType>(0.0), one);
+			const std::complex<FloatType> j(narrow_cast<FloatType>(0.0), one);
 			const size_t order = 2;
+			const auto current = getCoefficients();
 			const std::array<FloatType, 5> coefficients
-				= {mB0 / mA0, mB1 / mA0, mB2 / mA0, mA1 / mA0, mA2 / mA0};
+				= {current.b0, current.b1, current.b2, current.a1, current.a2};
 
 			jassert(frequency >= 0.0_Hz
 					&& frequency
@@ -730,23 +886,29 @@ namespace apex::dsp {
 		auto operator=(BiQuadFilter&& filt) noexcept -> BiQuadFilter& = default;
 
 	  private:
+		/// The highest angular frequency the magnitude-matched designs match their prototype at,
+		/// 0.9 * Nyquist
+		static constexpr double MAX_MATCHED_ANGLE = 0.9 * Constants<double>::pi;
+
+		/// Coefficients, normalized by a0 when they are calculated
 		FloatType mB0 = narrow_cast<FloatType>(0.0);
 		FloatType mB1 = narrow_cast<FloatType>(0.0);
 		FloatType mB2 = narrow_cast<FloatType>(0.0);
-		FloatType mA0 = narrow_cast<FloatType>(0.0);
 		FloatType mA1 = narrow_cast<FloatType>(0.0);
 		FloatType mA2 = narrow_cast<FloatType>(0.0);
 
-		FloatType mY1 = narrow_cast<FloatType>(0.0);
-		FloatType mY2 = narrow_cast<FloatType>(0.0);
-		FloatType mX1 = narrow_cast<FloatType>(0.0);
-		FloatType mX2 = narrow_cast<FloatType>(0.0);
+		/// Transposed Direct Form II state
+		FloatType mS1 = narrow_cast<FloatType>(0.0);
+		FloatType mS2 = narrow_cast<FloatType>(0.0);
 
 		FilterType mType = FilterType::Bell;
 		Hertz mFrequency = 1.0_kHz;
 		FloatType mQ = narrow_cast<FloatType>(0.7);
 		Decibels mGain = 0.0_dB;
 		Hertz mSampleRate = 44.1_kHz;
+		DesignMethod mMethod = DesignMethod::Bilinear;
+		bool mDeferredUpdates = false;
+		bool mCoefficientsDirty = false;
 
 		BiQuadFilter(Hertz frequency,
 					 FloatType q,
@@ -757,119 +919,371 @@ namespace apex::dsp {
 			updateCoefficients();
 		}
 
-		/// @brief Updates the coefficients of this filter
-		inline auto updateCoefficients() noexcept -> void {
+		/// @brief Calculates the (normalized) coefficients for a filter with the given parameters
+		///
+		/// @param type - The type of the filter
+		/// @param frequency - The frequency of the filter, in Hertz
+		/// @param q - The Q of the filter
+		/// @param gain - The gain of the filter, in Decibels
+		/// @param sampleRate - The sample rate, in Hertz
+		/// @param method - The method to design the coefficients with
+		///
+		/// @return - The coefficients
+		[[nodiscard]] static inline auto calculateCoefficients(FilterType type,
+															   Hertz frequency,
+															   FloatType q,
+															   Decibels gain,
+															   Hertz sampleRate,
+															   DesignMethod method) noexcept
+			-> BiQuadCoefficients<FloatType> {
+			if(method == DesignMethod::MagnitudeMatched) {
+				return calculateMatchedCoefficients(type, frequency, q, gain, sampleRate);
+			}
+
 			auto one = narrow_cast<FloatType>(1.0);
 			auto two = narrow_cast<FloatType>(2.0);
-			auto w0 = narrow_cast<FloatType>(two * Constants<FloatType>::pi * mFrequency
-											 / narrow_cast<FloatType>(mSampleRate));
+			auto w0 = narrow_cast<FloatType>(two * Constants<FloatType>::pi * frequency
+											 / narrow_cast<FloatType>(sampleRate));
 			auto cosw0 = Trig<FloatType>::cos(w0);
 			auto sinw0 = Trig<FloatType>::sin(w0);
-			auto alpha = sinw0 / (two * mQ);
-			auto a = Exponentials<FloatType>::pow10(narrow_cast<FloatType>(mGain)
+			auto alpha = sinw0 / (two * q);
+			auto a = Exponentials<FloatType>::pow10(narrow_cast<FloatType>(gain)
 													/ narrow_cast<FloatType>(40.0));
 			auto twoSqrtAAlpha = narrow_cast<FloatType>(0.0);
-
-			if(mType == FilterType::AnalogBell) {
-				alpha = sinw0 / (two * mQ * a);
+			auto b0 = one;
+			auto b1 = narrow_cast<FloatType>(0.0);
+			auto b2 = narrow_cast<FloatType>(0.0);
+			auto a0 = one;
+			auto a1 = narrow_cast<FloatType>(0.0);
+			auto a2 = narrow_cast<FloatType>(0.0);
+
+			if(type == FilterType::AnalogBell) {
+				alpha = sinw0 / (two * q * a);
 			}
 
-			if(mType == FilterType::LowShelf || mType == FilterType::HighShelf) {
+			if(type == FilterType::LowShelf || type == FilterType::HighShelf) {
 				twoSqrtAAlpha = two * General<FloatType>::sqrt(a) * alpha;
 			}
 
-			switch(mType) {
+			switch(type) {
 				case FilterType::Lowpass:
 					{
-						mB0 = (one - cosw0) / two;
-						mB1 = one - cosw0;
-						mB2 = mB0;
-						mA0 = one + alpha;
-						mA1 = -two * cosw0;
-						mA2 = one - alpha;
+						b0 = (one - cosw0) / two;
+						b1 = one - cosw0;
+						b2 = b0;
+						a0 = one + alpha;
+						a1 = -two * cosw0;
+						a2 = one - alpha;
 					}
 					break;
 				case FilterType::Highpass:
 					{
-						mB0 = (one + cosw0) / two;
-						mB1 = -(one + cosw0);
-						mB2 = mB0;
-						mA0 = one + alpha;
-						mA1 = -two * cosw0;
-						mA2 = one - alpha;
+						b0 = (one + cosw0) / two;
+						b1 = -(one + cosw0);
+						b2 = b0;
+						a0 = one + alpha;
+						a1 = -two * cosw0;
+						a2 = one - alpha;
 					}
 					break;
 				case FilterType::Bandpass:
 					{
-						mB0 = alpha;
-						mB1 = 0.0F;
-						mB2 = -alpha;
-						mA0 = one + alpha;
-						mA1 = -two * cosw0;
-						mA2 = one - alpha;
+						b0 = alpha;
+						b1 = 0.0F;
+						b2 = -alpha;
+						a0 = one + alpha;
+						a1 = -two * cosw0;
+						a2 = one - alpha;
 					}
 					break;
 				case FilterType::Allpass:
 					{
-						mB0 = one - alpha;
-						mB1 = -two * cosw0;
-						mB2 = one + alpha;
-						mA0 = mB2;
-						mA1 = mB1;
-						mA2 = mB0;
+						b0 = one - alpha;
+						b1 = -two * cosw0;
+						b2 = one + alpha;
+						a0 = b2;
+						a1 = b1;
+						a2 = b0;
 					}
 					break;
 				case FilterType::Notch:
 					{
-						mB0 = one;
-						mB1 = -two * cosw0;
-						mB2 = one;
-						mA0 = one + alpha;
-						mA1 = mB1;
-						mA2 = one - alpha;
+						b0 = one;
+						b1 = -two * cosw0;
+						b2 = one;
+						a0 = one + alpha;
+						a1 = b1;
+						a2 = one - alpha;
 					}
 					break;
 				case FilterType::LowShelf:
 					{
-						mB0 = a * ((a + one) - (a - one) * cosw0 + twoSqrtAAlpha);
-						mB1 = two * a * ((a - one) + (a + one) * cosw0);
-						mB2 = a * ((a + one) - (a - one) * cosw0 - twoSqrtAAlpha);
-						mA0 = (a + one) - (a - one) * cosw0 + twoSqrtAAlpha;
-						mA1 = -two * ((a - one) - (a + one) * cosw0);
-						mA2 = (a + one) - (a - one) * cosw0 - twoSqrtAAlpha;
+						b0 = a * ((a + one) - (a - one) * cosw0 + twoSqrtAAlpha);
+						b1 = two * a * ((a - one) + (a + one) * cosw0);
+						b2 = a * ((a + one) - (a - one) * cosw0 - twoSqrtAAlpha);
+						a0 = (a + one) - (a - one) * cosw0 + twoSqrtAAlpha;
+						a1 = -two * ((a - one) - (a + one) * cosw0);
+						a2 = (a + one) - (a - one) * cosw0 - twoSqrtAAlpha;
 					}
 					break;
 				case FilterType::HighShelf:
 					{
-						mB0 = a * ((a + one) - (a - one) * cosw0 + twoSqrtAAlpha);
-						mB1 = -two * a * ((a - one) + (a + one) * cosw0);
-						mB2 = a * ((a + one) - (a - one) * cosw0 - twoSqrtAAlpha);
-						mA0 = (a + one) - (a - one) * cosw0 + twoSqrtAAlpha;
-						mA1 = two * ((a - one) - (a + one) * cosw0);
-						mA2 = (a + one) - (a - one) * cosw0 - twoSqrtAAlpha;
+						b0 = a * ((a + one) - (a - one) * cosw0 + twoSqrtAAlpha);
+						b1 = -two * a * ((a - one) + (a + one) * cosw0);
+						b2 = a * ((a + one) - (a - one) * cosw0 - twoSqrtAAlpha);
+						a0 = (a + one) - (a - one) * cosw0 + twoSqrtAAlpha;
+						a1 = two * ((a - one) - (a + one) * cosw0);
+						a2 = (a + one) - (a - one) * cosw0 - twoSqrtAAlpha;
 					}
 					break;
 				case FilterType::Bell:
 					{
-						mB0 = one + alpha * a;
-						mB1 = -two * cosw0;
-						mB2 = one - alpha * a;
-						mA0 = one + alpha / a;
-						mA1 = mB1;
-						mA2 = one - alpha / a;
+						b0 = one + alpha * a;
+						b1 = -two * cosw0;
+						b2 = one - alpha * a;
+						a0 = one + alpha / a;
+						a1 = b1;
+						a2 = one - alpha / a;
 					}
 					break;
 				case FilterType::AnalogBell:
 					{
-						mB0 = one + alpha * a;
-						mB1 = -two * cosw0;
-						mB2 = one - alpha * a;
-						mA0 = one + alpha / a;
-						mA1 = mB1;
-						mA2 = one - alpha / a;
+						b0 = one + alpha * a;
+						b1 = -two * cosw0;
+						b2 = one - alpha * a;
+						a0 = one + alpha / a;
+						a1 = b1;
+						a2 = one - alpha / a;
 					}
 					break;
 			}
+
+			// normalize once here so processing never has to divide by a0
+			auto a0Inverse = one / a0;
+			return {b0 * a0Inverse, b1 * a0Inverse, b2 * a0Inverse, a1 * a0Inverse, a2 * a0Inverse};
+		}
+
+		/// @brief Calculates the (normalized) magnitude-matched coefficients for a filter with
+		/// the given parameters. The poles are the analog prototype's, mapped exactly with
+		/// z = e^(sT), and the zeros are chosen so the squared magnitude response matches the
+		/// prototype's at DC, at the filter's frequency and at Nyquist (highpasses and notches
+		/// keep their zeros where the prototype has them and only match the level).
+		///
+		/// The design subtracts nearly equal terms at low frequencies, so it is calculated in
+		/// double precision with the standard library's functions: the fast approximations lose
+		/// too much precision for high Q filters at low frequencies
+		///
+		/// @param type - The type of the filter
+		/// @param frequency - The frequency of the filter, in Hertz
+		/// @param q - The Q of the filter
+		/// @param gain - The gain of the filter, in Decibels
+		/// @param sampleRate - The sample rate, in Hertz
+		///
+		/// @return - The coefficients
+		[[nodiscard]] static inline auto
+		calculateMatchedCoefficients(FilterType type,
+									 Hertz frequency,
+									 FloatType q,
+									 Decibels gain,
+									 Hertz sampleRate) noexcept -> BiQuadCoefficients<FloatType> {
+			const auto qd = static_cast<double>(q);
+			const auto a = std::pow(10.0, static_cast<double>(gain) / 40.0);
+			const auto w0 = Constants<double>::twoPi * static_cast<double>(frequency)
+							/ static_cast<double>(sampleRate);
+
+			// every prototype's denominator is s^2 + (wn / poleQ)s + wn^2, with wn relative to
+			// the filter's frequency
+			auto naturalFrequency = 1.0;
+			auto poleQ = qd;
+			switch(type) {
+				case FilterType::LowShelf: naturalFrequency = 1.0 / std::sqrt(a); break;
+				case FilterType::HighShelf: naturalFrequency = std::sqrt(a); break;
+				case FilterType::Bell: poleQ = qd * a; break;
+				case FilterType::AnalogBell: poleQ = qd * a * a; break;
+				default: break;
+			}
+
+			const auto wn = w0 * naturalFrequency;
+			const auto zeta = 1.0 / (2.0 * poleQ);
+			const auto radius = std::exp(-zeta * wn);
+			auto a1 = 0.0;
+			if(zeta < 1.0) {
+				// poles above Nyquist would alias back down, so keep them at Nyquist instead
+				const auto angle
+					= std::min(wn * std::sqrt(1.0 - zeta * zeta), Constants<double>::pi);
+				a1 = -2.0 * radius * std::cos(angle);
+			}
+			else {
+				a1 = -2.0 * radius * std::cosh(wn * std::sqrt(zeta * zeta - 1.0));
+			}
+			const auto a2 = radius * radius;
+
+			if(type == FilterType::Allpass) {
+				// the magnitude is one everywhere, so the zeros are just the poles reflected
+				// about the unit circle
+				return {narrow_cast<FloatType>(a2),
+						narrow_cast<FloatType>(a1),
+						narrow_cast<FloatType>(1.0),
+						narrow_cast<FloatType>(a1),
+						narrow_cast<FloatType>(a2)};
+			}
+
+			// the squared magnitude of b0 + b1z^-1 + b2z^-2 at w is
+			// B0(1 - p) + B1p + B2(4p(1 - p)), with p = sin^2(w / 2), B0 = (b0 + b1 + b2)^2,
+			// B1 = (b0 - b1 + b2)^2 and B2 = -4b0b2, and likewise for the denominator
+			const auto denominatorB0 = (1.0 + a1 + a2) * (1.0 + a1 + a2);
+			const auto denominatorB1 = (1.0 - a1 + a2) * (1.0 - a1 + a2);
+			const auto denominatorB2 = -4.0 * a2;
+
+			// matching at the frequency itself becomes ill-conditioned as it nears Nyquist, so
+			// match slightly below it there instead
+			const auto matchAngle = std::min(w0, MAX_MATCHED_ANGLE);
+			const auto sinHalf = std::sin(matchAngle * 0.5);
+			const auto p1 = sinHalf * sinHalf;
+			const auto p0 = 1.0 - p1;
+			const auto p2 = 4.0 * p0 * p1;
+			const auto denominatorAtMatch
+				= denominatorB0 * p0 + denominatorB1 * p1 + denominatorB2 * p2;
+			const auto atMatch
+				= analogMagnitudeSquared(type, matchAngle / w0, qd, a) * denominatorAtMatch;
+
+			auto b0 = 0.0;
+			auto b1 = 0.0;
+			auto b2 = 0.0;
+			if(type == FilterType::Highpass) {
+				// a double zero at DC: |b0(1 - z^-1)^2|^2 = 16b0^2p^2
+				b0 = std::sqrt(atMatch) / (4.0 * p1);
+				b1 = -2.0 * b0;
+				b2 = b0;
+			}
+			else if(type == FilterType::Notch) {
+				// a pair of zeros on the unit circle at the frequency, scaled for unity gain at DC
+				const auto cosw0 = std::cos(w0);
+				b0 = std::sqrt(denominatorB0) / (2.0 - 2.0 * cosw0);
+				b1 = -2.0 * cosw0 * b0;
+				b2 = b0;
+			}
+			else {
+				const auto b0Squared = analogMagnitudeSquared(type, 0.0, qd, a) * denominatorB0;
+				const auto b1Squared
+					= analogMagnitudeSquared(type, Constants<double>::pi / w0, qd, a)
+					  * denominatorB1;
+				const auto b2Term = (atMatch - b0Squared * p0 - b1Squared * p1) / p2;
+
+				// b0 + b2 and b1 follow from the DC and Nyquist terms, and b0 and b2 are then
+				// the roots of t^2 - (b0 + b2)t + b0b2, taking the larger one for b0 to keep the
+				// zeros minimum-phase
+				const auto sumAtDC = std::sqrt(std::max(b0Squared, 0.0));
+				const auto sumAtNyquist = std::sqrt(std::max(b1Squared, 0.0));
+				const auto outer = 0.5 * (sumAtDC + sumAtNyquist);
+				b1 = 0.5 * (sumAtDC - sumAtNyquist);
+				b0 = 0.5 * (outer + std::sqrt(std::max(outer * outer + b2Term, 0.0)));
+				b2 = b0 > 0.0 ? -b2Term / (4.0 * b0) : 0.0;
+			}
+
+			return {narrow_cast<FloatType>(b0),
+					narrow_cast<FloatType>(b1),
+					narrow_cast<FloatType>(b2),
+					narrow_cast<FloatType>(a1),
+					narrow_cast<FloatType>(a2)};
+		}
+
+		/// @brief Calculates the squared magnitude response of the analog prototype of the given
+		/// filter type, at the given frequency relative to the filter's frequency
+		///
+		/// @param type - The type of the filter
+		/// @param ratio - The frequency to calculate the response at, relative to the filter's
+		/// @param q - The Q of the filter
+		/// @param a - The square root of the filter's linear gain
+		///
+		/// @return - The squared magnitude response
+		[[nodiscard]] static inline auto
+		analogMagnitudeSquared(FilterType type, double ratio, double q, double a) noexcept
+			-> double {
+			const auto x = ratio * ratio;
+			const auto resonance = (1.0 - x) * (1.0 - x) + x / (q * q);
+			switch(type) {
+				case FilterType::Lowpass: return 1.0 / resonance;
+				case FilterType::Highpass: return x * x / resonance;
+				case FilterType::Bandpass: return x / (q * q) / resonance;
+				case FilterType::Notch: return (1.0 - x) * (1.0 - x) / resonance;
+				case FilterType::LowShelf:
+					{
+						const auto shelf = a * x / (q * q);
+						return a * a * ((a - x) * (a - x) + shelf)
+							   / ((1.0 - a * x) * (1.0 - a * x) + shelf);
+					}
+				case FilterType::HighShelf:
+					{
+						const auto shelf = a * x / (q * q);
+						return a * a * ((1.0 - a * x) * (1.0 - a * x) + shelf)
+							   / ((a - x) * (a - x) + shelf);
+					}
+				case FilterType::Bell:
+					{
+						const auto numeratorQ = q / a;
+						const auto denominatorQ = q * a;
+						return ((1.0 - x) * (1.0 - x) + x / (numeratorQ * numeratorQ))
+							   / ((1.0 - x) * (1.0 - x) + x / (denominatorQ * denominatorQ));
+					}
+				case FilterType::AnalogBell:
+					{
+						const auto denominatorQ = q * a * a;
+						return resonance
+							   / ((1.0 - x) * (1.0 - x) + x / (denominatorQ * denominatorQ));
+					}
+				default: return 1.0;
+			}
+		}
+
+		/// @brief Updates the coefficients of this filter
+		inline auto updateCoefficients() noexcept -> void {
+			const auto coefficients
+				= calculateCoefficients(mType, mFrequency, mQ, mGain, mSampleRate, mMethod);
+			mB0 = coefficients.b0;
+			mB1 = coefficients.b1;
+			mB2 = coefficients.b2;
+			mA1 = coefficients.a1;
+			mA2 = coefficients.a2;
+			mCoefficientsDirty = false;
+		}
+
+		/// @brief Marks the coefficients of this filter as out of date, recalculating them
+		/// immediately unless updates are deferred
+		inline auto markCoefficientsDirty() noexcept -> void {
+			mCoefficientsDirty = true;
+			if(!mDeferredUpdates) {
+				updateCoefficients();
+			}
+		}
+
+		/// @brief Applies this filter to `size` samples from `input`, storing the results in
+		/// `output`. `input` and `output` may alias
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of samples to process
+		inline auto
+		processBlock(const FloatType* input, FloatType* output, size_t size) noexcept -> void {
+			// keep the coefficients and state in locals so they stay in registers across the loop
+			const auto b0 = mB0;
+			const auto b1 = mB1;
+			const auto b2 = mB2;
+			const auto a1 = mA1;
+			const auto a2 = mA2;
+			auto s1 = mS1;
+			auto s2 = mS2;
+
+			for(size_t i = 0; i < size; ++i) {
+				const auto xn = input[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto yn = b0 * xn + s1;
+				s1 = b1 * xn - a1 * yn + s2;
+				s2 = b2 * xn - a2 * yn;
+				output[i] = yn; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+
+			mS1 = s1;
+			mS2 = s2;
 		}
 
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiQuadFilter)
@@ -1,12 +1,97 @@
 #pragma once
 
 //(http://www.musicdsp.org/showone.php?id=77)
+#include <array>
 #include <type_traits>
 #include <utility>
 
 #include "../../base/StandardIncludes.h"
 
 namespace apex::dsp {
+	/// @brief The error feedback filters `Dither` and `DitherQuantizer` can shape their noise
+	/// with. The weighted profiles push the noise away from the ear's most sensitive range (2-5kHz)
+	/// and into the top octave. They're designed for 44.1kHz, are still usable at 48kHz, and
+	/// should be avoided at higher rates, where they'd move the noise into an audible band instead
+	/// of above it
+	enum class NoiseShapingProfile
+	{
+		/// `2e[n-1] - e[n-2]`, scaled by the noise shaping amount
+		Simple = 0,
+		/// Wannamaker's 3 tap F-weighted filter
+		FWeighted3,
+		/// Wannamaker's 5 tap F-weighted filter
+		FWeighted5,
+		/// Wannamaker's 9 tap F-weighted filter
+		FWeighted9,
+		/// Wannamaker's 9 tap modified E-weighted filter
+		ModifiedEWeighted9,
+		/// Wannamaker's 9 tap improved E-weighted filter
+		ImprovedEWeighted9
+	};
+
+	/// @brief The taps of a `NoiseShapingProfile`'s error feedback filter, `h`, newest error
+	/// first. The shaped signal is `x[n] + sum(h[k] * e[n - 1 - k])`, where `e` is the shaped
+	/// signal minus its quantized value, so the noise is shaped by `1 - sum(h[k] * z^-(k + 1))`
+	///
+	/// @see Wannamaker, "Psychoacoustically Optimal Noise Shaping"
+	struct NoiseShapingTaps {
+		/// The most taps any profile uses
+		static constexpr size_t MAX_TAPS = 9;
+
+		/// The taps, zero past `numTaps`
+		std::array<double, MAX_TAPS> taps = std::array<double, MAX_TAPS>();
+		/// The number of taps in use
+		size_t numTaps = 0;
+
+		/// @brief Returns the taps of the given profile
+		///
+		/// @param profile - The profile
+		/// @param amount - The noise shaping amount, only used by `NoiseShapingProfile::Simple`
+		///
+		/// @return - The taps
+		[[nodiscard]] static constexpr auto
+		forProfile(NoiseShapingProfile profile, double amount) noexcept -> NoiseShapingTaps {
+			auto result = NoiseShapingTaps();
+			switch(profile) {
+				case NoiseShapingProfile::Simple:
+					result.taps = {amount * 2.0, -amount};
+					result.numTaps = 2;
+					break;
+				case NoiseShapingProfile::FWeighted3:
+					result.taps = {1.623, -0.982, 0.109};
+					result.numTaps = 3;
+					break;
+				case NoiseShapingProfile::FWeighted5:
+					result.taps = {2.033, -2.165, 1.959, -1.590, 0.6149};
+					result.numTaps = 5;
+					break;
+				case NoiseShapingProfile::FWeighted9:
+					result.taps
+						= {2.412, -3.370, 3.937, -4.174, 3.353, -2.205, 1.281, -0.569, 0.0847};
+					result.numTaps = 9;
+					break;
+				case NoiseShapingProfile::ModifiedEWeighted9:
+					result.taps = {1.662,
+								   -1.263,
+								   0.4827,
+								   -0.2913,
+								   0.1268,
+								   -0.1124,
+								   0.03252,
+								   -0.01265,
+								   -0.03524};
+					result.numTaps = 9;
+					break;
+				case NoiseShapingProfile::ImprovedEWeighted9:
+					result.taps
+						= {2.847, -4.685, 6.214, -7.184, 6.639, -5.032, 3.263, -1.632, 0.4191};
+					result.numTaps = 9;
+					break;
+			}
+			return result;
+		}
+	};
+
 	/// @brief Class used to apply dither along with bit-depth reduction (eg 32bit to 24 bit)
 	/// See http://www.musicdsp.org/showone.php?id=77 for more details on the algorithm
 	///
@@ -60,69 +145,234 @@ namespace apex::dsp {
 			updateState();
 		}
 
+		/// @brief Sets the error feedback filter to shape the noise with. The noise shaping amount
+		/// only scales `NoiseShapingProfile::Simple`; the weighted profiles are used as designed
+		///
+		/// @param profile - The noise shaping profile to use
+		inline auto setNoiseShapingProfile(NoiseShapingProfile profile) noexcept -> void {
+			mProfile = profile;
+			updateState();
+		}
+
+		/// @brief Returns the error feedback filter the noise is shaped with
+		///
+		/// @return - The noise shaping profile
+		[[nodiscard]] inline auto getNoiseShapingProfile() const noexcept -> NoiseShapingProfile {
+			return mProfile;
+		}
+
+		/// @brief Sets the seed the dither's random stream is started from. Every `Dither` is
+		/// constructed with a seed of its own, so instances dithering different channels are
+		/// uncorrelated; Setting the same seed on two instances makes them dither identically
+		///
+		/// @param seed - The seed to use
+		inline auto setSeed(uint64_t seed) noexcept -> void {
+			mSeed = seed;
+			updateState();
+		}
+
+		/// @brief Returns the seed the dither's random stream is started from
+		///
+		/// @return - The seed
+		[[nodiscard]] inline auto getSeed() const noexcept -> uint64_t {
+			return mSeed;
+		}
+
 		/// @brief Dithers and bit-depth reduces the input based on this `Dither`'s parameters
 		///
 		/// @param input - The input to dither
 		///
 		/// @return - The dithered, bit-depth reduced result
 		[[nodiscard]] inline auto dither(FloatType input) noexcept -> FloatType {
-			auto output = input + mNoiseShaping * (mFeedbackOne + mFeedbackOne - mFeedbackTwo);
-			auto outputTemp
-				= output + mDCOffset + mAmplitude * narrow_cast<FloatType>(mRandomOne - mRandomTwo);
-			auto outputTruncated = narrow_cast<int>(mWordLength * outputTemp);
-
-			if(outputTemp < narrow_cast<FloatType>(0.0)) {
-				--outputTruncated;
+			if(mDitherIndex == DITHER_BLOCK_SIZE) {
+				mRandom.fill(Span<FloatType>::MakeSpan(mDither.data(), mDither.size()),
+							 math::RandomDistribution::Triangular);
+				mDitherIndex = 0;
+			}
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto* errors = mErrors.data() + mErrorIndex;
+			const auto* taps = mTaps.data();
+			// oldest errors first, so the newest one is only needed by the last multiply-add
+			auto feedback = narrow_cast<FloatType>(0.0);
+			for(auto tap = mNumTaps; tap > 0; --tap) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				feedback += taps[tap - 1] * errors[tap - 1];
 			}
-			mFeedbackTwo = mFeedbackOne;
-			mFeedbackOne = output - mWordLengthInverse * narrow_cast<FloatType>(outputTruncated);
+			const auto scaled = input * mWordLength;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto quantized = quantize(scaled, feedback, mDither.data()[mDitherIndex]);
+			++mDitherIndex;
+
+			// the newest error goes before the others, and is mirrored a window further on, so
+			// the window is always contiguous
+			mErrorIndex = (mErrorIndex == 0 ? NoiseShapingTaps::MAX_TAPS : mErrorIndex) - 1;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			auto* newest = mErrors.data() + mErrorIndex;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			newest[0] = newest[NoiseShapingTaps::MAX_TAPS] = scaled + feedback - quantized;
 
-			return output;
+			return quantized * mWordLengthInverse;
+		}
+
+		/// @brief Dithers and bit-depth reduces a block of samples, with the same results as
+		/// calling `dither` on each of them in turn.
+		///
+		/// Each run of samples up to the next dither refill appends its errors to a linear
+		/// history in locals, after the errors before it, so every sample's window is just the
+		/// errors before it, with nothing shifted along. The filter is unrolled for the
+		/// profile's number of taps, so high order profiles stay cheap
+		///
+		/// @param input - The samples to dither
+		/// @param output - Where to write the dithered, bit-depth reduced results; Must be the
+		/// same size as `input`
+		inline auto dither(Span<const FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			switch(mNumTaps) {
+				case 2: ditherBlock<2>(input, output); break;
+				case 3: ditherBlock<3>(input, output); break;
+				case 5: ditherBlock<5>(input, output); break;
+				default: ditherBlock<NoiseShapingTaps::MAX_TAPS>(input, output); break;
+			}
 		}
 
 	  private:
+		/// The number of dither values drawn at a time
+		static constexpr size_t DITHER_BLOCK_SIZE = 64;
+		/// The seed the random number generator is restarted from, unique to this instance
+		/// unless set with `setSeed`
+		uint64_t mSeed = math::RandomBank<FloatType>::uniqueSeed();
 		/// Random number generator
-		math::Random mRandom = math::Random();
-		/// Runnning Random number one
-		size_t mRandomOne = 0;
-		/// Running Random number two
-		size_t mRandomTwo = 0;
+		math::RandomBank<FloatType> mRandom = math::RandomBank<FloatType>(mSeed);
+		/// The current block of TPDF dither values
+		std::array<FloatType, DITHER_BLOCK_SIZE> mDither
+			= std::array<FloatType, DITHER_BLOCK_SIZE>();
+		/// The index of the next dither value to use
+		size_t mDitherIndex = DITHER_BLOCK_SIZE;
 		/// The bit depth to use
 		size_t mNumBits = 24;
-		/// The first running feedback error value
-		FloatType mFeedbackOne = narrow_cast<FloatType>(0.0);
-		/// The second running feedback error value
-		FloatType mFeedbackTwo = narrow_cast<FloatType>(0.0);
+		/// The running feedback error values, in LSBs, twice over: the window of the newest
+		/// `MAX_TAPS`, newest first, starts at `mErrorIndex`
+		std::array<FloatType, 2 * NoiseShapingTaps::MAX_TAPS> mErrors
+			= std::array<FloatType, 2 * NoiseShapingTaps::MAX_TAPS>();
+		/// The index of the newest error in `mErrors`
+		size_t mErrorIndex = 0;
 		/// Noise shaping amount
 		FloatType mNoiseShaping = narrow_cast<FloatType>(0.5);
+		/// Noise shaping profile
+		NoiseShapingProfile mProfile = NoiseShapingProfile::Simple;
+		/// The error feedback taps of `mProfile`
+		std::array<FloatType, NoiseShapingTaps::MAX_TAPS> mTaps
+			= std::array<FloatType, NoiseShapingTaps::MAX_TAPS>();
+		/// The number of taps in use
+		size_t mNumTaps = 2;
 		/// Resulting word length
 		FloatType mWordLength = Exponentials<FloatType>::pow2(static_cast<FloatType>(mNumBits - 1));
 		/// Inverse of the word length
 		FloatType mWordLengthInverse = narrow_cast<FloatType>(1.0) / mWordLength;
-		/// Dither amplitude
-		FloatType mAmplitude = mWordLengthInverse / static_cast<FloatType>(math::Random::MAX);
-		/// DC Offset adjustment
-		FloatType mDCOffset = mWordLengthInverse * narrow_cast<FloatType>(0.5);
+
+		/// @brief Dithers and quantizes a sample to a whole number of LSBs. Everything is in
+		/// LSBs, which the word length (a power of two) scales to exactly.
+		///
+		/// The error feedback is a recursion, so only the additions after the feedback is known
+		/// hold up the next sample: the dither and the DC offset of half an LSB (which rounds to
+		/// nearest) are added to the input first
+		///
+		/// @param scaled - The input, in LSBs
+		/// @param feedback - The error feedback, in LSBs
+		/// @param dither - The TPDF dither value, in LSBs
+		///
+		/// @return - The quantized sample, in LSBs
+		[[nodiscard]] static inline auto
+		quantize(FloatType scaled, FloatType feedback, FloatType dither) noexcept -> FloatType {
+			const auto value = scaled + (narrow_cast<FloatType>(0.5) + dither) + feedback;
+			auto truncated = narrow_cast<int>(value);
+			// truncation rounds negative values up, so they're moved down, without a branch
+			truncated -= static_cast<int>(value < narrow_cast<FloatType>(0.0));
+			return narrow_cast<FloatType>(truncated);
+		}
+
+		/// @brief Dithers a block of samples with the error history in locals
+		///
+		/// @tparam NumTaps - The number of taps to run; Taps past `mNumTaps` are zero, so any
+		/// number of at least `mNumTaps` gives the same results
+		///
+		/// @param input - The samples to dither
+		/// @param output - Where to write the results
+		template<size_t NumTaps>
+		inline auto ditherBlock(Span<const FloatType> input, Span<FloatType> output) noexcept
+			-> void {
+			// the taps and errors run oldest first, so the window of each sample is the
+			// `NumTaps` errors before its own
+			auto taps = std::array<FloatType, NumTaps>();
+			auto history = std::array<FloatType, NumTaps + DITHER_BLOCK_SIZE>();
+			for(size_t tap = 0; tap < NumTaps; ++tap) {
+				taps.at(NumTaps - 1 - tap) = mTaps.at(tap);
+				history.at(NumTaps - 1 - tap) = mErrors.at(mErrorIndex + tap);
+			}
+			const auto wordLength = mWordLength;
+			const auto wordLengthInverse = mWordLengthInverse;
+			const auto* in = input.data();
+			auto* out = output.data();
+			const auto size = input.size();
+			auto offset = static_cast<size_t>(0);
+			while(offset < size) {
+				if(mDitherIndex == DITHER_BLOCK_SIZE) {
+					mRandom.fill(Span<FloatType>::MakeSpan(mDither.data(), mDither.size()),
+								 math::RandomDistribution::Triangular);
+					mDitherIndex = 0;
+				}
+				// each run ends where the dither values do
+				const auto runSize
+					= General<size_t>::min(size - offset, DITHER_BLOCK_SIZE - mDitherIndex);
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto* dither = mDither.data() + mDitherIndex;
+				for(size_t index = 0; index < runSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					auto* window = history.data() + index;
+					auto feedback = narrow_cast<FloatType>(0.0);
+					for(size_t tap = 0; tap < NumTaps; ++tap) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						feedback += taps.at(tap) * window[tap];
+					}
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto scaled = in[offset + index] * wordLength;
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto quantized = quantize(scaled, feedback, dither[index]);
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					window[NumTaps] = scaled + feedback - quantized;
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					out[offset + index] = quantized * wordLengthInverse;
+				}
+				// the newest errors start the next run's history
+				for(size_t tap = 0; tap < NumTaps; ++tap) {
+					history.at(tap) = history.at(runSize + tap);
+				}
+				offset += runSize;
+				mDitherIndex += runSize;
+			}
+			mErrorIndex = 0;
+			for(size_t tap = 0; tap < NumTaps; ++tap) {
+				const auto error = history.at(NumTaps - 1 - tap);
+				mErrors.at(tap) = error;
+				mErrors.at(tap + NoiseShapingTaps::MAX_TAPS) = error;
+			}
+		}
 
 		inline auto updateState() noexcept -> void {
-			mRandom.srand(10956489098);
-			size_t rand = mRandom.rand();
-			auto seedTemp = narrow_cast<size_t>(mNumBits * mNoiseShaping);
-			size_t seed = rand / seedTemp;
-			mRandom.srand(seed);
-			mRandomOne = mRandom.rand();
-			mRandom.srand(mRandomOne);
-			mRandomTwo = mRandom.rand();
-
-			mFeedbackOne = narrow_cast<FloatType>(0.0);
-			mFeedbackTwo = narrow_cast<FloatType>(0.0);
+			mRandom.srand(mSeed);
+			mDitherIndex = DITHER_BLOCK_SIZE;
+
+			mErrors.fill(narrow_cast<FloatType>(0.0));
+			mErrorIndex = 0;
+			const auto taps
+				= NoiseShapingTaps::forProfile(mProfile, static_cast<double>(mNoiseShaping));
+			for(size_t tap = 0; tap < NoiseShapingTaps::MAX_TAPS; ++tap) {
+				mTaps.at(tap) = narrow_cast<FloatType>(taps.taps.at(tap));
+			}
+			mNumTaps = taps.numTaps;
 
 			mWordLength = Exponentials<FloatType>::pow2(narrow_cast<FloatType>(mNumBits - 1));
 			mWordLengthInverse = narrow_cast<FloatType>(1.0) / mWordLength;
-
-			mAmplitude = mWordLengthInverse / narrow_cast<FloatType>(math::Random::MAX);
-
-			mDCOffset = mWordLengthInverse * narrow_cast<FloatType>(0.5);
 		}
 
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Dither)
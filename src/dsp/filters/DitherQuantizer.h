@@ -0,0 +1,450 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../base/StandardIncludes.h"
+#include "Dither.h"
+
+namespace apex::dsp {
+	/// @brief The integer sample formats a `DitherQuantizer` can write. Every format is signed,
+	/// two's complement and little-endian, and packed (ie 24 bit samples take 3 bytes)
+	enum class PCMFormat
+	{
+		Int16 = 0,
+		Int24,
+		Int32
+	};
+
+	/// @brief How a `DitherQuantizer` lays the channels out in its output
+	enum class PCMLayout
+	{
+		/// The channels of each frame are next to each other (LRLRLR...)
+		Interleaved = 0,
+		/// Each channel is written whole, one after the other (LLL...RRR...)
+		Planar
+	};
+
+	/// @brief Converts blocks of floating point samples to packed integer PCM in a single pass:
+	/// each sample is dithered with TPDF noise, noise shaped with the same error feedback as
+	/// `Dither` (with any `NoiseShapingProfile`), rounded, clipped and written straight into a
+	/// byte buffer.
+	///
+	/// The error feedback is a recursion, so it can't be vectorized across time. Instead, the
+	/// channels are quantized side by side, in groups of `CHANNEL_LANES` independent lanes, over
+	/// chunks of samples with the feedback state kept in locals. Rounding is branch-free, and
+	/// packing a chunk's integers into bytes is a separate loop over the chunk, so the compiler
+	/// can vectorize both. The error feedback filter is unrolled for the profile's number of
+	/// taps, with the error history in locals, so high order profiles stay cheap
+	///
+	/// Each channel draws its dither from its own random stream, so the channels' noise is
+	/// uncorrelated
+	///
+	/// @tparam FloatType - The floating point type used to back operations, either float or
+	/// double
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class DitherQuantizer {
+	  public:
+		/// @brief Constructs a `DitherQuantizer` for one channel, writing 24 bit samples
+		DitherQuantizer() noexcept {
+			setFormat(mFormat);
+			updateTaps();
+			prepare(1);
+		}
+
+		/// @brief Constructs a `DitherQuantizer` for one channel, with the given parameters
+		///
+		/// @param format - The integer format to write
+		/// @param layout - How to lay the channels out
+		/// @param noiseShaping - The noise shaping to use
+		explicit DitherQuantizer(PCMFormat format,
+								 PCMLayout layout = PCMLayout::Interleaved,
+								 FloatType noiseShaping = narrow_cast<FloatType>(0.5)) noexcept
+			: mLayout(layout), mNoiseShaping(noiseShaping) {
+			setFormat(format);
+			updateTaps();
+			prepare(1);
+		}
+
+		/// @brief Move constructs the given `DitherQuantizer`
+		///
+		/// @param quantizer - The `DitherQuantizer` to move
+		DitherQuantizer(DitherQuantizer&& quantizer) noexcept = default;
+		~DitherQuantizer() noexcept = default;
+
+		/// @brief Prepares this for quantizing the given number of channels, and resets it.
+		/// Allocates, so must not be called on the audio thread
+		///
+		/// @param numChannels - The number of channels that will be quantized
+		inline auto prepare(size_t numChannels) noexcept -> void {
+			mNumChannels = General<size_t>::max(numChannels, 1);
+			mGroups.resize((mNumChannels + CHANNEL_LANES - 1) / CHANNEL_LANES);
+			reset();
+		}
+
+		/// @brief Returns the number of channels this has been prepared for
+		///
+		/// @return - The number of channels
+		[[nodiscard]] inline auto getNumChannels() const noexcept -> size_t {
+			return mNumChannels;
+		}
+
+		/// @brief Sets the integer format to write
+		///
+		/// @param format - The new format
+		inline auto setFormat(PCMFormat format) noexcept -> void {
+			mFormat = format;
+			switch(format) {
+				case PCMFormat::Int16: mNumBits = 16; break;
+				case PCMFormat::Int24: mNumBits = 24; break;
+				case PCMFormat::Int32: mNumBits = 32; break;
+			}
+			mWordLength = narrow_cast<FloatType>(static_cast<int64_t>(1) << (mNumBits - 1U));
+		}
+
+		/// @brief Returns the integer format written
+		///
+		/// @return - The format
+		[[nodiscard]] inline auto getFormat() const noexcept -> PCMFormat {
+			return mFormat;
+		}
+
+		/// @brief Returns the bit-depth of the integer format written
+		///
+		/// @return - The bit-depth
+		[[nodiscard]] inline auto getNumBits() const noexcept -> size_t {
+			return mNumBits;
+		}
+
+		/// @brief Returns the number of bytes each sample takes in the output
+		///
+		/// @return - The number of bytes per sample
+		[[nodiscard]] inline auto getBytesPerSample() const noexcept -> size_t {
+			return mNumBits / 8;
+		}
+
+		/// @brief Returns the number of bytes needed to hold the given number of frames (ie
+		/// samples per channel) of output
+		///
+		/// @param numFrames - The number of frames
+		///
+		/// @return - The output size, in bytes
+		[[nodiscard]] inline auto getRequiredBytes(size_t numFrames) const noexcept -> size_t {
+			return numFrames * mNumChannels * getBytesPerSample();
+		}
+
+		/// @brief Sets how the channels are laid out in the output
+		///
+		/// @param layout - The new layout
+		inline auto setLayout(PCMLayout layout) noexcept -> void {
+			mLayout = layout;
+		}
+
+		/// @brief Returns how the channels are laid out in the output
+		///
+		/// @return - The layout
+		[[nodiscard]] inline auto getLayout() const noexcept -> PCMLayout {
+			return mLayout;
+		}
+
+		/// @brief Sets the noise shaping to use
+		///
+		/// @param noiseShaping - The noise shaping to use
+		inline auto setNoiseShaping(FloatType noiseShaping) noexcept -> void {
+			mNoiseShaping = noiseShaping;
+			updateTaps();
+		}
+
+		/// @brief Returns the noise shaping in use
+		///
+		/// @return - The noise shaping
+		[[nodiscard]] inline auto getNoiseShaping() const noexcept -> FloatType {
+			return mNoiseShaping;
+		}
+
+		/// @brief Sets the error feedback filter to shape the noise with, and resets the error
+		/// feedback. The noise shaping amount only scales `NoiseShapingProfile::Simple`; the
+		/// weighted profiles are used as designed
+		///
+		/// @param profile - The noise shaping profile to use
+		inline auto setNoiseShapingProfile(NoiseShapingProfile profile) noexcept -> void {
+			mProfile = profile;
+			updateTaps();
+			reset();
+		}
+
+		/// @brief Returns the error feedback filter the noise is shaped with
+		///
+		/// @return - The noise shaping profile
+		[[nodiscard]] inline auto getNoiseShapingProfile() const noexcept -> NoiseShapingProfile {
+			return mProfile;
+		}
+
+		/// @brief Resets the error feedback of every channel, and restarts their random streams
+		inline auto reset() noexcept -> void {
+			for(size_t group = 0; group < mGroups.size(); ++group) {
+				auto& state = mGroups.at(group);
+				state.errors.fill(FeedbackLanes());
+				for(size_t lane = 0; lane < CHANNEL_LANES; ++lane) {
+					state.random.at(lane).srand(RANDOM_SEED + group * CHANNEL_LANES + lane);
+				}
+			}
+		}
+
+		/// @brief Dithers, noise shapes and quantizes the given channels, writing them to
+		/// `output` as packed integers, in this `DitherQuantizer`'s format and layout. Samples
+		/// outside [-1, 1) are clipped
+		///
+		/// @param input - The channels to quantize; Must be as many as this was prepared for,
+		/// and all the same size
+		/// @param output - The bytes to write to; Must hold at least
+		/// `getRequiredBytes(input[0].size())` bytes
+		inline auto
+		quantize(Span<const Span<const FloatType>> input, Span<std::byte> output) noexcept -> void {
+			jassert(input.size() == mNumChannels);
+			const auto numFrames = input.at(0).size();
+			jassert(output.size() >= getRequiredBytes(numFrames));
+
+			const auto bytesPerSample = getBytesPerSample();
+			const auto interleaved = mLayout == PCMLayout::Interleaved;
+			const auto stride = interleaved ? bytesPerSample * mNumChannels : bytesPerSample;
+			const auto channelOffset = interleaved ? bytesPerSample : bytesPerSample * numFrames;
+			for(size_t first = 0; first < mNumChannels; first += CHANNEL_LANES) {
+				const auto numLanes = General<size_t>::min(mNumChannels - first, CHANNEL_LANES);
+				auto inputs = std::array<const FloatType*, CHANNEL_LANES>();
+				auto outputs = std::array<std::byte*, CHANNEL_LANES>();
+				for(size_t lane = 0; lane < numLanes; ++lane) {
+					jassert(input.at(first + lane).size() == numFrames);
+					inputs.at(lane) = input.at(first + lane).data();
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					outputs.at(lane) = output.data() + (first + lane) * channelOffset;
+				}
+				quantizeLanes(inputs,
+							  outputs,
+							  numLanes,
+							  numFrames,
+							  stride,
+							  mGroups.at(first / CHANNEL_LANES));
+			}
+		}
+
+		auto operator=(DitherQuantizer&& quantizer) noexcept -> DitherQuantizer& = default;
+
+	  private:
+		/// The number of channels quantized side by side
+		static constexpr size_t CHANNEL_LANES = 4;
+		/// The number of samples quantized between packing passes
+		static constexpr size_t CHUNK_SIZE = 64;
+		/// The seed of the first channel's random stream. The other channels use the following
+		/// seeds
+		static constexpr uint64_t RANDOM_SEED = 10956489098;
+
+		/// One value per channel of a `ChannelGroup`
+		using Lanes = std::array<FloatType, CHANNEL_LANES>;
+		/// One value per channel of a `ChannelGroup`, in double precision, which the error
+		/// feedback is kept in for every `FloatType`, so it's exact up to 32 bits
+		using FeedbackLanes = std::array<double, CHANNEL_LANES>;
+		/// One `Lanes` per sample of a chunk
+		using LaneChunk = std::array<Lanes, CHUNK_SIZE>;
+		/// The dither of a chunk, one array per lane
+		using DitherChunk = std::array<std::array<FloatType, CHUNK_SIZE>, CHANNEL_LANES>;
+		/// The quantized integers of a chunk, one array per lane
+		using IntegerChunk = std::array<std::array<int32_t, CHUNK_SIZE>, CHANNEL_LANES>;
+
+		/// The error feedback and random streams of `CHANNEL_LANES` consecutive channels
+		struct ChannelGroup {
+			std::array<math::RandomBank<FloatType>, CHANNEL_LANES> random
+				= std::array<math::RandomBank<FloatType>, CHANNEL_LANES>();
+			/// The running feedback error values, newest first
+			std::array<FeedbackLanes, NoiseShapingTaps::MAX_TAPS> errors
+				= std::array<FeedbackLanes, NoiseShapingTaps::MAX_TAPS>();
+		};
+
+		size_t mNumChannels = 1;
+		std::vector<ChannelGroup> mGroups = std::vector<ChannelGroup>(1);
+		PCMFormat mFormat = PCMFormat::Int24;
+		PCMLayout mLayout = PCMLayout::Interleaved;
+		/// The bit depth of `mFormat`
+		size_t mNumBits = 24;
+		/// Noise shaping amount
+		FloatType mNoiseShaping = narrow_cast<FloatType>(0.5);
+		/// Noise shaping profile
+		NoiseShapingProfile mProfile = NoiseShapingProfile::Simple;
+		/// The error feedback taps of `mProfile`
+		NoiseShapingTaps mTaps = NoiseShapingTaps();
+		/// The scale from [-1, 1) to the integer range, ie the magnitude of the most negative
+		/// integer
+		FloatType mWordLength = narrow_cast<FloatType>(8388608.0);
+
+		/// @brief Quantizes up to `CHANNEL_LANES` channels side by side, writing each to its
+		/// bytes, `stride` bytes apart
+		///
+		/// @param inputs - The samples of each channel
+		/// @param outputs - Where to write the first sample of each channel
+		/// @param numLanes - The number of channels
+		/// @param numFrames - The number of samples per channel
+		/// @param stride - The distance between consecutive samples in the output, in bytes
+		/// @param state - The channels' error feedback and random streams
+		inline auto quantizeLanes(const std::array<const FloatType*, CHANNEL_LANES>& inputs,
+								  const std::array<std::byte*, CHANNEL_LANES>& outputs,
+								  size_t numLanes,
+								  size_t numFrames,
+								  size_t stride,
+								  ChannelGroup& state) noexcept -> void {
+			// unused lanes quantize silence, and are never written out
+			auto samples = LaneChunk();
+			auto dither = DitherChunk();
+			auto quantized = IntegerChunk();
+			for(size_t offset = 0; offset < numFrames; offset += CHUNK_SIZE) {
+				const auto size = General<size_t>::min(CHUNK_SIZE, numFrames - offset);
+				for(size_t lane = 0; lane < numLanes; ++lane) {
+					for(size_t index = 0; index < size; ++index) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						samples.at(index).at(lane) = inputs.at(lane)[offset + index];
+					}
+					auto& laneDither = dither.at(lane);
+					state.random.at(lane).fill(Span<FloatType>::MakeSpan(laneDither.data(), size),
+											   math::RandomDistribution::Triangular);
+				}
+				switch(mTaps.numTaps) {
+					case 2: quantizeChunk<2>(samples, dither, quantized, size, state); break;
+					case 3: quantizeChunk<3>(samples, dither, quantized, size, state); break;
+					case 5: quantizeChunk<5>(samples, dither, quantized, size, state); break;
+					default:
+						quantizeChunk<NoiseShapingTaps::MAX_TAPS>(samples,
+																  dither,
+																  quantized,
+																  size,
+																  state);
+						break;
+				}
+				for(size_t lane = 0; lane < numLanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					pack(quantized.at(lane), size, outputs.at(lane) + offset * stride, stride);
+				}
+			}
+		}
+
+		/// @brief Recalculates the error feedback taps from the noise shaping amount and profile
+		inline auto updateTaps() noexcept -> void {
+			mTaps = NoiseShapingTaps::forProfile(mProfile, static_cast<double>(mNoiseShaping));
+		}
+
+		/// @brief Dithers, noise shapes and rounds a chunk of samples of every lane
+		///
+		/// @tparam NumTaps - The number of error feedback taps to run; Taps past the profile's
+		/// are zero, so any number of at least the profile's gives the same results
+		///
+		/// @param samples - The samples to quantize
+		/// @param dither - The dither for each sample, in LSBs
+		/// @param quantized - Where to write the (clipped) integer samples
+		/// @param size - The number of samples in the chunk
+		/// @param state - The lanes' error feedback
+		template<size_t NumTaps>
+		inline auto quantizeChunk(const LaneChunk& samples,
+								  const DitherChunk& dither,
+								  IntegerChunk& quantized,
+								  size_t size,
+								  ChannelGroup& state) const noexcept -> void {
+			const auto wordLength = static_cast<double>(mWordLength);
+			// everything is in LSBs, offset to be positive, so truncating rounds down. This
+			// keeps a single integer round trip, and no branches, in the feedback loop
+			const auto offset = wordLength * 4.0;
+			// the taps and errors run oldest first, and the chunk's errors are appended after
+			// the ones before it, so the window of each sample is the `NumTaps` errors before
+			// its own, with nothing shifted along
+			auto taps = std::array<double, NumTaps>();
+			auto history = std::array<FeedbackLanes, NumTaps + CHUNK_SIZE>();
+			for(size_t tap = 0; tap < NumTaps; ++tap) {
+				taps.at(NumTaps - 1 - tap) = mTaps.taps.at(tap);
+				history.at(NumTaps - 1 - tap) = state.errors.at(tap);
+			}
+			const auto lowest = -static_cast<int64_t>(mWordLength);
+			const auto highest = static_cast<int64_t>(mWordLength) - 1;
+			for(size_t index = 0; index < size; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto* window = history.data() + index;
+				for(size_t lane = 0; lane < CHANNEL_LANES; ++lane) {
+					// anything this far out clips anyway, and the offset has to cover it
+					const auto input = General<double>::max(
+						-wordLength * 2.0,
+						General<double>::min(static_cast<double>(samples.at(index).at(lane))
+												 * wordLength,
+											 wordLength * 2.0));
+					// oldest errors first, so only the last multiply-add waits on the newest
+					auto feedback = 0.0;
+					for(size_t tap = 0; tap < NumTaps; ++tap) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						feedback += taps.at(tap) * window[tap].at(lane);
+					}
+					const auto shaped = input + offset + feedback;
+					// the DC offset `Dither` adds is half an LSB, to round to nearest
+					const auto value
+						= (input + offset + static_cast<double>(dither.at(lane).at(index)) + 0.5)
+						  + feedback;
+					const auto truncated = static_cast<int64_t>(value);
+					// the error is taken before clipping, so a clipped sample doesn't feed its
+					// overshoot back into the next ones
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					window[NumTaps].at(lane) = shaped - static_cast<double>(truncated);
+					const auto rounded = truncated - static_cast<int64_t>(offset);
+					quantized.at(lane).at(index) = static_cast<int32_t>(
+						General<int64_t>::max(lowest, General<int64_t>::min(rounded, highest)));
+				}
+			}
+			for(size_t tap = 0; tap < NumTaps; ++tap) {
+				state.errors.at(tap) = history.at(size + NumTaps - 1 - tap);
+			}
+		}
+
+		/// @brief Writes a chunk of integer samples as packed little-endian bytes, in this
+		/// `DitherQuantizer`'s format
+		///
+		/// @param quantized - The integer samples
+		/// @param size - The number of samples to write
+		/// @param output - Where to write the first sample
+		/// @param stride - The distance between consecutive samples in the output, in bytes
+		inline auto pack(const std::array<int32_t, CHUNK_SIZE>& quantized,
+						 size_t size,
+						 std::byte* output,
+						 size_t stride) const noexcept -> void {
+			switch(mFormat) {
+				case PCMFormat::Int16: packBytes<2>(quantized, size, output, stride); break;
+				case PCMFormat::Int24: packBytes<3>(quantized, size, output, stride); break;
+				case PCMFormat::Int32: packBytes<4>(quantized, size, output, stride); break;
+			}
+		}
+
+		/// @brief Writes the lowest `BytesPerSample` bytes of each integer sample, least
+		/// significant first
+		///
+		/// @tparam BytesPerSample - The number of bytes per output sample
+		///
+		/// @param quantized - The integer samples
+		/// @param size - The number of samples to write
+		/// @param output - Where to write the first sample
+		/// @param stride - The distance between consecutive samples in the output, in bytes
+		template<size_t BytesPerSample>
+		static inline auto packBytes(const std::array<int32_t, CHUNK_SIZE>& quantized,
+									 size_t size,
+									 std::byte* output,
+									 size_t stride) noexcept -> void {
+			for(size_t index = 0; index < size; ++index) {
+				const auto value = static_cast<uint32_t>(quantized.at(index));
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto* sample = output + index * stride;
+				for(size_t byte = 0; byte < BytesPerSample; ++byte) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					sample[byte] = static_cast<std::byte>((value >> (8U * byte)) & 0xFFU);
+				}
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DitherQuantizer)
+	};
+} // namespace apex::dsp
@@ -0,0 +1,395 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../base/StandardIncludes.h"
+
+namespace apex::dsp {
+	/// @brief Linear-phase half-band FIR filter for 2x up- and downsampling, in polyphase form
+	///
+	/// Every other coefficient of a half-band filter is zero, apart from the center one (0.5).
+	/// When upsampling, the inserted zeros are never multiplied: the even output phase is the
+	/// inner product of the non-zero coefficients with the input history, and the odd phase is
+	/// just the input, delayed. When downsampling, only the samples that are kept are calculated,
+	/// the same way. The coefficients are symmetric, so each inner product adds the pairs of
+	/// samples that share a coefficient first, halving the multiplies. The input is processed in
+	/// chunks, and each coefficient is applied to a register-sized tile of outputs at once, so
+	/// the inner products vectorize across outputs, without padding the coefficients or summing
+	/// lanes back together for every output.
+	///
+	/// The coefficients are a Kaiser-windowed sinc, so they only depend on the transition width
+	/// and stopband attenuation, never on the sample rate. One design is shared by every channel
+	/// the filter is prepared for; each channel only adds its own histories. The channels are
+	/// processed one at a time: the inner products already fill the vector lanes, so running
+	/// channels side by side would gain nothing
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class HalfBandFIR {
+	  public:
+		/// The maximum number of non-zero coefficients, excluding the center one
+		static constexpr size_t MAX_TAPS = 128;
+
+		/// @brief Constructs a default `HalfBandFIR`, steep enough for a single 2x stage
+		/// (passband up to 0.45 of the lower sample rate) with 100dB of stopband attenuation
+		HalfBandFIR() noexcept {
+			design(narrow_cast<FloatType>(0.05), 100.0_dB);
+		}
+
+		/// @brief Constructs a `HalfBandFIR` with the given transition width and stopband
+		/// attenuation
+		///
+		/// @param transitionWidth - The width of the transition band, centered on a quarter of
+		/// the higher sample rate, as a fraction of the higher sample rate
+		/// @param attenuation - How far below the passband the stopband is, in Decibels
+		HalfBandFIR(FloatType transitionWidth, Decibels attenuation) noexcept {
+			design(transitionWidth, attenuation);
+		}
+
+		/// @brief Move constructs a `HalfBandFIR` from the given one
+		///
+		/// @param filter - The `HalfBandFIR` to move
+		HalfBandFIR(HalfBandFIR&& filter) noexcept = default;
+		~HalfBandFIR() noexcept = default;
+
+		/// @brief Prepares this filter to process the given number of channels, resetting it.
+		/// Allocates, so must not be called on the audio thread
+		///
+		/// @param numChannels - The number of channels
+		inline auto prepare(size_t numChannels) noexcept -> void {
+			mChannels.resize(General<size_t>::max(numChannels, 1));
+			reset();
+		}
+
+		/// @brief Returns the number of channels this filter is prepared for
+		///
+		/// @return - The number of channels
+		[[nodiscard]] inline auto getNumChannels() const noexcept -> size_t {
+			return mChannels.size();
+		}
+
+		/// @brief Redesigns this filter with the given transition width and stopband
+		/// attenuation, resetting it. Doesn't allocate
+		///
+		/// @param transitionWidth - The width of the transition band, centered on a quarter of
+		/// the higher sample rate, as a fraction of the higher sample rate
+		/// @param attenuation - How far below the passband the stopband is, in Decibels
+		inline auto setDesign(FloatType transitionWidth, Decibels attenuation) noexcept -> void {
+			design(transitionWidth, attenuation);
+		}
+
+		/// @brief Returns the number of bytes used by this filter, including its per-channel
+		/// state
+		///
+		/// @return - The memory footprint, in bytes
+		[[nodiscard]] inline auto getMemoryFootprint() const noexcept -> size_t {
+			return sizeof(*this) + mChannels.capacity() * sizeof(ChannelState);
+		}
+
+		/// @brief Returns the number of non-zero coefficients (excluding the center one) of this
+		/// filter, ie the number of multiplies per calculated output sample
+		///
+		/// @return - The number of taps
+		[[nodiscard]] inline auto getNumTaps() const noexcept -> size_t {
+			return mNumTaps;
+		}
+
+		/// @brief Returns the delay of upsampling and then downsampling through this filter, in
+		/// samples at the lower sample rate
+		///
+		/// @return - The round-trip latency
+		[[nodiscard]] inline auto getLatency() const noexcept -> size_t {
+			// each direction delays by half the filter's length, at the higher sample rate
+			return mNumTaps - 1;
+		}
+
+		/// @brief Upsamples the given input by 2, storing the result in `output`.
+		/// `output` may overlap `input` as long as it starts at least `input.size()` samples
+		/// before it (eg. when `input` is the upper half of `output`)
+		///
+		/// @param input - The input values to upsample
+		/// @param output - The array to store the upsampled values in, twice the size of `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto upSample(Span<const FloatType> input,
+							 Span<FloatType> output,
+							 size_t channel = 0) noexcept -> void {
+			jassert(output.size() == input.size() * 2);
+			upSampleBlock(input.data(), output.data(), input.size(), mChannels.at(channel));
+		}
+
+		/// @brief Upsamples the given input by 2, storing the result in `output`.
+		/// `output` may overlap `input` as long as it starts at least `input.size()` samples
+		/// before it (eg. when `input` is the upper half of `output`)
+		///
+		/// @param input - The input values to upsample
+		/// @param output - The array to store the upsampled values in, twice the size of `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto
+		upSample(Span<FloatType> input, Span<FloatType> output, size_t channel = 0) noexcept
+			-> void {
+			jassert(output.size() == input.size() * 2);
+			upSampleBlock(input.data(), output.data(), input.size(), mChannels.at(channel));
+		}
+
+		/// @brief Downsamples the given input by 2, storing the result in `output`. `output` may
+		/// overlap `input` as long as it doesn't start after it
+		///
+		/// @param input - The input values to downsample
+		/// @param output - The array to store the downsampled values in, half the size of
+		/// `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto downSample(Span<const FloatType> input,
+							   Span<FloatType> output,
+							   size_t channel = 0) noexcept -> void {
+			jassert(input.size() == output.size() * 2);
+			downSampleBlock(input.data(), output.data(), output.size(), mChannels.at(channel));
+		}
+
+		/// @brief Downsamples the given input by 2, storing the result in `output`. `output` may
+		/// overlap `input` as long as it doesn't start after it
+		///
+		/// @param input - The input values to downsample
+		/// @param output - The array to store the downsampled values in, half the size of
+		/// `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto
+		downSample(Span<FloatType> input, Span<FloatType> output, size_t channel = 0) noexcept
+			-> void {
+			jassert(input.size() == output.size() * 2);
+			downSampleBlock(input.data(), output.data(), output.size(), mChannels.at(channel));
+		}
+
+		/// @brief Resets this filter to an initial state
+		inline auto reset() noexcept -> void {
+			for(auto& state : mChannels) {
+				state.upHistory.fill(narrow_cast<FloatType>(0.0));
+				state.downHistory.fill(narrow_cast<FloatType>(0.0));
+				state.oddHistory.fill(narrow_cast<FloatType>(0.0));
+			}
+		}
+
+		auto operator=(HalfBandFIR&& filter) noexcept -> HalfBandFIR& = default;
+
+	  private:
+		/// The number of samples (at the lower sample rate) processed per chunk
+		static constexpr size_t CHUNK_SIZE = 64;
+		/// The number of outputs of a chunk convolved at once
+		static constexpr size_t TILE_SIZE = 32;
+
+		/// The non-zero coefficients, in time order, for downsampling
+		std::array<FloatType, MAX_TAPS> mCoefficients = std::array<FloatType, MAX_TAPS>();
+		/// `mCoefficients`, scaled by 2 to make up for the energy lost to the inserted zeros
+		std::array<FloatType, MAX_TAPS> mUpCoefficients = std::array<FloatType, MAX_TAPS>();
+		size_t mNumTaps = 2;
+		/// The delay of the odd phase when upsampling, ie the distance from the newest sample
+		/// in a window to the one lined up with the center coefficient
+		size_t mCenterDelay = 0;
+
+		/// The state of one channel
+		struct ChannelState {
+			/// Input histories, `mNumTaps - 1` samples followed by the chunk being processed
+			std::array<FloatType, MAX_TAPS + CHUNK_SIZE> upHistory
+				= std::array<FloatType, MAX_TAPS + CHUNK_SIZE>();
+			std::array<FloatType, MAX_TAPS + CHUNK_SIZE> downHistory
+				= std::array<FloatType, MAX_TAPS + CHUNK_SIZE>();
+			/// The odd phase when downsampling, which only meets the center coefficient:
+			/// `mNumTaps / 2` samples followed by the chunk being processed
+			std::array<FloatType, MAX_TAPS / 2 + CHUNK_SIZE> oddHistory
+				= std::array<FloatType, MAX_TAPS / 2 + CHUNK_SIZE>();
+		};
+
+		std::vector<ChannelState> mChannels = std::vector<ChannelState>(1);
+
+		/// @brief Designs the coefficients of this filter
+		///
+		/// @param transitionWidth - The width of the transition band, as a fraction of the
+		/// higher sample rate
+		/// @param attenuation - How far below the passband the stopband is, in Decibels
+		inline auto design(FloatType transitionWidth, Decibels attenuation) noexcept -> void {
+			jassert(transitionWidth > narrow_cast<FloatType>(0.0)
+					&& transitionWidth < narrow_cast<FloatType>(0.5));
+			const auto stopband = std::abs(static_cast<double>(attenuation));
+			const auto width = static_cast<double>(transitionWidth);
+
+			// Kaiser's estimates for the window's shape and the filter's length
+			auto beta = 0.0;
+			if(stopband > 50.0) {
+				beta = 0.1102 * (stopband - 8.7);
+			}
+			else if(stopband > 21.0) {
+				beta = 0.5842 * std::pow(stopband - 21.0, 0.4) + 0.07886 * (stopband - 21.0);
+			}
+			// the filter is 2 * halfLength + 1 long, and only a half-band filter whose half
+			// length is odd has non-zero outermost coefficients
+			auto halfLength = static_cast<size_t>(
+				std::ceil((stopband - 7.95) / (28.72 * width)));
+			halfLength |= 1U;
+			halfLength = std::clamp(halfLength, static_cast<size_t>(1), MAX_TAPS - 1);
+
+			mNumTaps = halfLength + 1;
+			mCenterDelay = mNumTaps / 2 - 1;
+
+			mCoefficients.fill(narrow_cast<FloatType>(0.0));
+			mUpCoefficients.fill(narrow_cast<FloatType>(0.0));
+			const auto besselOfBeta = besselI0(beta);
+			const auto half = static_cast<double>(halfLength);
+			for(size_t tap = 0; tap < mNumTaps; ++tap) {
+				// the non-zero taps sit at odd offsets from the center
+				const auto offset = static_cast<double>(2 * tap) - half;
+				const auto sinc = std::sin(Constants<double>::piOver2 * offset)
+								  / (Constants<double>::pi * offset);
+				const auto position = offset / half;
+				const auto window
+					= besselI0(beta * std::sqrt(std::max(1.0 - position * position, 0.0)))
+					  / besselOfBeta;
+				mCoefficients.at(tap) = narrow_cast<FloatType>(sinc * window);
+				mUpCoefficients.at(tap) = narrow_cast<FloatType>(2.0 * sinc * window);
+			}
+			reset();
+		}
+
+		/// @brief Calculates the zeroth order modified Bessel function of the first kind
+		///
+		/// @param x - The input
+		///
+		/// @return - I0(x)
+		[[nodiscard]] static inline auto besselI0(double x) noexcept -> double {
+			auto sum = 1.0;
+			auto term = 1.0;
+			const auto halfX = x * 0.5;
+			for(auto k = 1; k < 64; ++k) {
+				const auto factor = halfX / static_cast<double>(k);
+				term *= factor * factor;
+				sum += term;
+				if(term < sum * 1.0e-17) {
+					break;
+				}
+			}
+			return sum;
+		}
+
+		/// @brief Convolves `history` with the coefficients, for a whole chunk. The coefficients
+		/// are symmetric, so each one is applied once, to the sum of the two samples it meets.
+		/// The chunk is split into tiles small enough for their sums to stay in registers, and
+		/// each coefficient is applied to a whole tile before the next one, so the inner loop is
+		/// over consecutive outputs and vectorizes for any number of taps. Outputs past the end
+		/// of a short chunk are calculated from whatever `history` holds there
+		///
+		/// @param coefficients - Pointer to the coefficients
+		/// @param history - Pointer to the oldest sample of the first output's window
+		/// @param outputs - The array to store the outputs in
+		inline auto convolve(const FloatType* coefficients,
+							 const FloatType* history,
+							 std::array<FloatType, CHUNK_SIZE>& outputs) const noexcept -> void {
+			// a half-band filter's number of non-zero taps is always even
+			const auto numPairs = mNumTaps / 2;
+			const auto lastTap = mNumTaps - 1;
+			for(size_t tile = 0; tile < CHUNK_SIZE; tile += TILE_SIZE) {
+				auto sums = std::array<FloatType, TILE_SIZE>();
+				for(size_t tap = 0; tap < numPairs; ++tap) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto coefficient = coefficients[tap];
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto* early = history + tile + tap;
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto* late = history + tile + lastTap - tap;
+					for(size_t index = 0; index < TILE_SIZE; ++index) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						sums.at(index) += coefficient * (early[index] + late[index]);
+					}
+				}
+				for(size_t index = 0; index < TILE_SIZE; ++index) {
+					outputs.at(tile + index) = sums.at(index);
+				}
+			}
+		}
+
+		/// @brief Moves the newest `length` samples of a history, which ends `size` samples
+		/// after them, to its start, ready for the next chunk
+		///
+		/// @param history - The history
+		/// @param length - The number of samples kept
+		/// @param size - The number of samples in the chunk just processed
+		template<size_t Size>
+		static inline auto
+		keepNewest(std::array<FloatType, Size>& history, size_t length, size_t size) noexcept
+			-> void {
+			for(size_t index = 0; index < length; ++index) {
+				history.at(index) = history.at(index + size);
+			}
+		}
+
+		/// @brief Upsamples `size` samples from `input` by 2, storing the results in `output`
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the `2 * size` output samples in
+		/// @param size - The number of input samples
+		/// @param state - The state of the channel being upsampled
+		inline auto upSampleBlock(const FloatType* input,
+								  FloatType* output,
+								  size_t size,
+								  ChannelState& state) noexcept -> void {
+			const auto historySize = mNumTaps - 1;
+			auto even = std::array<FloatType, CHUNK_SIZE>();
+			for(size_t offset = 0; offset < size; offset += CHUNK_SIZE) {
+				const auto chunkSize = General<size_t>::min(size - offset, CHUNK_SIZE);
+				// the chunk is read before any of it is written, the output may overlap the
+				// input
+				for(size_t index = 0; index < chunkSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					state.upHistory.at(historySize + index) = input[offset + index];
+				}
+				convolve(mUpCoefficients.data(), state.upHistory.data(), even);
+				const auto oddStart = historySize - mCenterDelay;
+				for(size_t index = 0; index < chunkSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					output[2 * (offset + index)] = even.at(index);
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					output[2 * (offset + index) + 1] = state.upHistory.at(oddStart + index);
+				}
+				keepNewest(state.upHistory, historySize, chunkSize);
+			}
+		}
+
+		/// @brief Downsamples `2 * size` samples from `input` by 2, storing the results in
+		/// `output`
+		///
+		/// @param input - Pointer to the `2 * size` input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of output samples
+		/// @param state - The state of the channel being downsampled
+		inline auto downSampleBlock(const FloatType* input,
+									FloatType* output,
+									size_t size,
+									ChannelState& state) noexcept -> void {
+			const auto half = narrow_cast<FloatType>(0.5);
+			const auto historySize = mNumTaps - 1;
+			const auto oddDelay = mNumTaps / 2;
+			auto even = std::array<FloatType, CHUNK_SIZE>();
+			for(size_t offset = 0; offset < size; offset += CHUNK_SIZE) {
+				const auto chunkSize = General<size_t>::min(size - offset, CHUNK_SIZE);
+				for(size_t index = 0; index < chunkSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					state.downHistory.at(historySize + index) = input[2 * (offset + index)];
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					state.oddHistory.at(oddDelay + index) = input[2 * (offset + index) + 1];
+				}
+				convolve(mCoefficients.data(), state.downHistory.data(), even);
+				for(size_t index = 0; index < chunkSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					output[offset + index] = even.at(index) + half * state.oddHistory.at(index);
+				}
+				keepNewest(state.downHistory, historySize, chunkSize);
+				keepNewest(state.oddHistory, oddDelay, chunkSize);
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HalfBandFIR)
+	};
+} // namespace apex::dsp
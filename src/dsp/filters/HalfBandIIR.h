@@ -0,0 +1,595 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../base/StandardIncludes.h"
+
+namespace apex::dsp {
+	/// @brief Polyphase IIR half-band filter for 2x up- and downsampling, built from two parallel
+	/// chains of first-order allpass sections running at the lower sample rate
+	///
+	/// The two chains are the two polyphase branches of an elliptic half-band lowpass, so every
+	/// section runs once per lower-rate sample and the zeros inserted when upsampling (or the
+	/// samples dropped when downsampling) are never calculated. The phase response isn't linear,
+	/// but the delay is only a few samples, far less than a `HalfBandFIR` of the same steepness,
+	/// for a fraction of the multiplies.
+	///
+	/// The coefficients only depend on the transition width and stopband attenuation, never on
+	/// the sample rate. One design is shared by every channel the filter is prepared for. The
+	/// allpass recursions can't be vectorized across time, so when several channels (at least
+	/// `MIN_SHARED_LANES`) are processed at once they run side by side in `CHANNEL_LANES`
+	/// independent lanes instead
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	///
+	/// @see Valenzuela and Constantinides, "Digital signal processing schemes for efficient
+	/// interpolation and decimation"
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class HalfBandIIR {
+	  public:
+		/// The maximum number of allpass coefficients, across both branches
+		static constexpr size_t MAX_COEFFICIENTS = 16;
+		/// The number of channels processed side by side when processing several at once
+		static constexpr size_t CHANNEL_LANES = 4;
+		/// The fewest channels worth processing side by side. Fewer (eg. stereo) leave most of
+		/// the lanes running on silence, and are faster processed one at a time
+		static constexpr size_t MIN_SHARED_LANES = 3;
+
+		/// @brief Constructs a default `HalfBandIIR`, steep enough for a single 2x stage
+		/// (passband up to 0.45 of the lower sample rate) with 100dB of stopband attenuation
+		HalfBandIIR() noexcept {
+			design(narrow_cast<FloatType>(0.05), 100.0_dB);
+		}
+
+		/// @brief Constructs a `HalfBandIIR` with the given transition width and stopband
+		/// attenuation
+		///
+		/// @param transitionWidth - The width of the transition band, centered on a quarter of
+		/// the higher sample rate, as a fraction of the higher sample rate
+		/// @param attenuation - How far below the passband the stopband is, in Decibels
+		HalfBandIIR(FloatType transitionWidth, Decibels attenuation) noexcept {
+			design(transitionWidth, attenuation);
+		}
+
+		/// @brief Move constructs a `HalfBandIIR` from the given one
+		///
+		/// @param filter - The `HalfBandIIR` to move
+		HalfBandIIR(HalfBandIIR&& filter) noexcept = default;
+		~HalfBandIIR() noexcept = default;
+
+		/// @brief Prepares this filter to process the given number of channels, resetting it.
+		/// Allocates, so must not be called on the audio thread
+		///
+		/// @param numChannels - The number of channels
+		inline auto prepare(size_t numChannels) noexcept -> void {
+			mNumChannels = General<size_t>::max(numChannels, 1);
+			mGroups.resize((mNumChannels + CHANNEL_LANES - 1) / CHANNEL_LANES);
+			reset();
+		}
+
+		/// @brief Returns the number of channels this filter is prepared for
+		///
+		/// @return - The number of channels
+		[[nodiscard]] inline auto getNumChannels() const noexcept -> size_t {
+			return mNumChannels;
+		}
+
+		/// @brief Redesigns this filter with the given transition width and stopband
+		/// attenuation, resetting it. Doesn't allocate
+		///
+		/// @param transitionWidth - The width of the transition band, centered on a quarter of
+		/// the higher sample rate, as a fraction of the higher sample rate
+		/// @param attenuation - How far below the passband the stopband is, in Decibels
+		inline auto setDesign(FloatType transitionWidth, Decibels attenuation) noexcept -> void {
+			design(transitionWidth, attenuation);
+		}
+
+		/// @brief Returns the number of bytes used by this filter, including its per-channel
+		/// state
+		///
+		/// @return - The memory footprint, in bytes
+		[[nodiscard]] inline auto getMemoryFootprint() const noexcept -> size_t {
+			return sizeof(*this) + mGroups.capacity() * sizeof(ChannelGroup);
+		}
+
+		/// @brief Returns the number of allpass coefficients of this filter, ie the number of
+		/// multiplies per lower-rate sample
+		///
+		/// @return - The number of coefficients
+		[[nodiscard]] inline auto getNumCoefficients() const noexcept -> size_t {
+			return mNumCoefficients;
+		}
+
+		/// @brief Returns the delay of upsampling and then downsampling through this filter at
+		/// low frequencies, in samples at the lower sample rate. The delay rises towards the
+		/// transition band
+		///
+		/// @return - The round-trip latency
+		[[nodiscard]] inline auto getLatency() const noexcept -> FloatType {
+			return mLatency;
+		}
+
+		/// @brief Upsamples the given input by 2, storing the result in `output`.
+		/// `output` may overlap `input` as long as it starts at least `input.size()` samples
+		/// before it (eg. when `input` is the upper half of `output`)
+		///
+		/// @param input - The input values to upsample
+		/// @param output - The array to store the upsampled values in, twice the size of `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto upSample(Span<const FloatType> input,
+							 Span<FloatType> output,
+							 size_t channel = 0) noexcept -> void {
+			jassert(output.size() == input.size() * 2 && channel < mNumChannels);
+			upSampleBlock(input.data(), output.data(), input.size(), channel);
+		}
+
+		/// @brief Upsamples the given input by 2, storing the result in `output`.
+		/// `output` may overlap `input` as long as it starts at least `input.size()` samples
+		/// before it (eg. when `input` is the upper half of `output`)
+		///
+		/// @param input - The input values to upsample
+		/// @param output - The array to store the upsampled values in, twice the size of `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto
+		upSample(Span<FloatType> input, Span<FloatType> output, size_t channel = 0) noexcept
+			-> void {
+			jassert(output.size() == input.size() * 2 && channel < mNumChannels);
+			upSampleBlock(input.data(), output.data(), input.size(), channel);
+		}
+
+		/// @brief Upsamples every channel of `input` by 2, storing the results in the matching
+		/// channels of `output`. The channels run side by side, so they must all be the same
+		/// size. Each output channel may overlap its input channel the same way as for a single
+		/// channel. Prepared channels after the last one given, up to the next multiple of
+		/// `CHANNEL_LANES`, are run on silence, unless fewer than `MIN_SHARED_LANES` are left,
+		/// which are processed one at a time instead
+		///
+		/// @param input - The channels to upsample, at most the number this is prepared for
+		/// @param output - The channels to store the upsampled values in, each twice the size of
+		/// its input channel
+		inline auto
+		upSample(Span<const Span<FloatType>> input, Span<const Span<FloatType>> output) noexcept
+			-> void {
+			jassert(input.size() == output.size() && input.size() <= mNumChannels);
+			for(size_t first = 0; first < input.size(); first += CHANNEL_LANES) {
+				const auto numLanes = General<size_t>::min(input.size() - first, CHANNEL_LANES);
+				auto inputs = std::array<const FloatType*, CHANNEL_LANES>();
+				auto outputs = std::array<FloatType*, CHANNEL_LANES>();
+				for(size_t lane = 0; lane < numLanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto& from = input.data()[first + lane];
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto& to = output.data()[first + lane];
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					jassert(from.size() == input.data()[first].size()
+							&& to.size() == from.size() * 2);
+					inputs.at(lane) = from.data();
+					outputs.at(lane) = to.data();
+				}
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto size = input.data()[first].size();
+				if(numLanes < MIN_SHARED_LANES) {
+					for(size_t lane = 0; lane < numLanes; ++lane) {
+						upSampleBlock(inputs.at(lane), outputs.at(lane), size, first + lane);
+					}
+					continue;
+				}
+				upSampleLanes(inputs, outputs, numLanes, size, mGroups.at(first / CHANNEL_LANES));
+			}
+		}
+
+		/// @brief Downsamples the given input by 2, storing the result in `output`. `output` may
+		/// overlap `input` as long as it doesn't start after it
+		///
+		/// @param input - The input values to downsample
+		/// @param output - The array to store the downsampled values in, half the size of
+		/// `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto downSample(Span<const FloatType> input,
+							   Span<FloatType> output,
+							   size_t channel = 0) noexcept -> void {
+			jassert(input.size() == output.size() * 2 && channel < mNumChannels);
+			downSampleBlock(input.data(), output.data(), output.size(), channel);
+		}
+
+		/// @brief Downsamples the given input by 2, storing the result in `output`. `output` may
+		/// overlap `input` as long as it doesn't start after it
+		///
+		/// @param input - The input values to downsample
+		/// @param output - The array to store the downsampled values in, half the size of
+		/// `input`
+		/// @param channel - The channel `input` belongs to
+		inline auto
+		downSample(Span<FloatType> input, Span<FloatType> output, size_t channel = 0) noexcept
+			-> void {
+			jassert(input.size() == output.size() * 2 && channel < mNumChannels);
+			downSampleBlock(input.data(), output.data(), output.size(), channel);
+		}
+
+		/// @brief Downsamples every channel of `input` by 2, storing the results in the matching
+		/// channels of `output`. The channels run side by side, so they must all be the same
+		/// size. Each output channel may overlap its input channel the same way as for a single
+		/// channel. Prepared channels after the last one given, up to the next multiple of
+		/// `CHANNEL_LANES`, are run on silence, unless fewer than `MIN_SHARED_LANES` are left,
+		/// which are processed one at a time instead
+		///
+		/// @param input - The channels to downsample, at most the number this is prepared for
+		/// @param output - The channels to store the downsampled values in, each half the size
+		/// of its input channel
+		inline auto
+		downSample(Span<const Span<FloatType>> input, Span<const Span<FloatType>> output) noexcept
+			-> void {
+			jassert(input.size() == output.size() && input.size() <= mNumChannels);
+			for(size_t first = 0; first < input.size(); first += CHANNEL_LANES) {
+				const auto numLanes = General<size_t>::min(input.size() - first, CHANNEL_LANES);
+				auto inputs = std::array<const FloatType*, CHANNEL_LANES>();
+				auto outputs = std::array<FloatType*, CHANNEL_LANES>();
+				for(size_t lane = 0; lane < numLanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto& from = input.data()[first + lane];
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto& to = output.data()[first + lane];
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					jassert(to.size() == output.data()[first].size()
+							&& from.size() == to.size() * 2);
+					inputs.at(lane) = from.data();
+					outputs.at(lane) = to.data();
+				}
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto size = output.data()[first].size();
+				if(numLanes < MIN_SHARED_LANES) {
+					for(size_t lane = 0; lane < numLanes; ++lane) {
+						downSampleBlock(inputs.at(lane), outputs.at(lane), size, first + lane);
+					}
+					continue;
+				}
+				downSampleLanes(inputs, outputs, numLanes, size, mGroups.at(first / CHANNEL_LANES));
+			}
+		}
+
+		/// @brief Resets this filter to an initial state
+		inline auto reset() noexcept -> void {
+			for(auto& group : mGroups) {
+				group = ChannelGroup();
+			}
+		}
+
+		auto operator=(HalfBandIIR&& filter) noexcept -> HalfBandIIR& = default;
+
+	  private:
+		/// The allpass coefficients. Even indices belong to the first branch, odd indices to the
+		/// second
+		std::array<FloatType, MAX_COEFFICIENTS> mCoefficients
+			= std::array<FloatType, MAX_COEFFICIENTS>();
+		size_t mNumCoefficients = 2;
+		FloatType mLatency = narrow_cast<FloatType>(0.0);
+
+		/// One value per channel of a `ChannelGroup`
+		using Lanes = std::array<FloatType, CHANNEL_LANES>;
+		/// One `Lanes` per allpass section
+		using SectionLanes = std::array<Lanes, MAX_COEFFICIENTS>;
+		/// The number of samples run through each allpass section at a time, when processing
+		/// several channels at once
+		static constexpr size_t CHUNK_SIZE = 32;
+		/// One `Lanes` per sample of a chunk
+		using LaneChunk = std::array<Lanes, CHUNK_SIZE>;
+
+		/// The previous input and output of each allpass section, for each direction, for
+		/// `CHANNEL_LANES` consecutive channels
+		struct ChannelGroup {
+			SectionLanes upInputs = SectionLanes();
+			SectionLanes upOutputs = SectionLanes();
+			SectionLanes downInputs = SectionLanes();
+			SectionLanes downOutputs = SectionLanes();
+		};
+
+		size_t mNumChannels = 1;
+		std::vector<ChannelGroup> mGroups = std::vector<ChannelGroup>(1);
+
+		/// @brief Designs the coefficients of this filter
+		///
+		/// @param transitionWidth - The width of the transition band, as a fraction of the
+		/// higher sample rate
+		/// @param attenuation - How far below the passband the stopband is, in Decibels
+		inline auto design(FloatType transitionWidth, Decibels attenuation) noexcept -> void {
+			jassert(transitionWidth > narrow_cast<FloatType>(0.0)
+					&& transitionWidth < narrow_cast<FloatType>(0.5));
+			const auto stopband = std::abs(static_cast<double>(attenuation));
+			const auto width = static_cast<double>(transitionWidth);
+			const auto pi = Constants<double>::pi;
+
+			// the elliptic modulus and nome of the transition band
+			auto k = std::tan((1.0 - width * 2.0) * pi / 4.0);
+			k *= k;
+			const auto kRoot = std::pow(1.0 - k * k, 0.25);
+			const auto e = 0.5 * (1.0 - kRoot) / (1.0 + kRoot);
+			const auto e4 = e * e * e * e;
+			const auto q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+
+			// the order needed for the attenuation, rounded up so both branches are the same
+			// length
+			const auto power = std::pow(10.0, -stopband / 10.0);
+			const auto ratio = power / (1.0 - power);
+			const auto order = std::ceil(std::log(ratio * ratio / 16.0) / std::log(q));
+			auto numCoefficients = static_cast<size_t>(std::max((order - 1.0) / 2.0, 2.0));
+			numCoefficients += numCoefficients & 1U;
+			mNumCoefficients = std::min(numCoefficients, MAX_COEFFICIENTS);
+
+			const auto filterOrder = static_cast<double>(2 * mNumCoefficients + 1);
+			auto firstBranchDelay = 0.0;
+			auto secondBranchDelay = 0.0;
+			mCoefficients.fill(narrow_cast<FloatType>(0.0));
+			for(size_t index = 0; index < mNumCoefficients; ++index) {
+				const auto c = static_cast<double>(index + 1);
+
+				auto numerator = 0.0;
+				auto term = 1.0;
+				auto sign = 1.0;
+				for(auto i = 0; std::abs(term) > 1.0e-100; ++i) {
+					term = std::pow(q, i * (i + 1))
+						   * std::sin(static_cast<double>(i * 2 + 1) * c * pi / filterOrder)
+						   * sign;
+					numerator += term;
+					sign = -sign;
+				}
+				numerator *= std::pow(q, 0.25);
+
+				auto denominator = 0.0;
+				term = 1.0;
+				sign = -1.0;
+				for(auto i = 1; std::abs(term) > 1.0e-100; ++i) {
+					term = std::pow(q, i * i)
+						   * std::cos(static_cast<double>(i * 2) * c * pi / filterOrder) * sign;
+					denominator += term;
+					sign = -sign;
+				}
+
+				const auto w = numerator / (denominator + 0.5);
+				const auto wSquared = w * w;
+				const auto x = std::sqrt((1.0 - wSquared * k) * (1.0 - wSquared / k))
+							   / (1.0 + wSquared);
+				const auto coefficient = (1.0 - x) / (1.0 + x);
+				mCoefficients.at(index) = narrow_cast<FloatType>(coefficient);
+
+				// each section delays low frequencies by (1 - a) / (1 + a) lower-rate samples,
+				// ie twice that at the higher rate
+				const auto delay = 2.0 * (1.0 - coefficient) / (1.0 + coefficient);
+				if((index & 1U) == 0) {
+					firstBranchDelay += delay;
+				}
+				else {
+					secondBranchDelay += delay;
+				}
+			}
+			// the branches are in phase at DC, so the filter's delay there is their average, in
+			// higher-rate samples. Upsampling delays the second branch by a further higher-rate
+			// sample and downsampling feeds it a higher-rate sample early, so the round trip
+			// takes the sum of the branches' delays in higher-rate samples, or their average in
+			// lower-rate ones
+			mLatency = narrow_cast<FloatType>((firstBranchDelay + secondBranchDelay) / 2.0);
+			reset();
+		}
+
+		/// @brief Runs one sample of one channel through each branch
+		///
+		/// @param first - The sample to run through the first branch, replaced by its output
+		/// @param second - The sample to run through the second branch, replaced by its output
+		/// @param inputs - The previous inputs of the allpass sections
+		/// @param outputs - The previous outputs of the allpass sections
+		/// @param lane - The lane of the channel in `inputs` and `outputs`
+		inline auto processBranches(FloatType& first,
+									FloatType& second,
+									SectionLanes& inputs,
+									SectionLanes& outputs,
+									size_t lane) const noexcept -> void {
+			// the branches are independent, so they're interleaved to overlap their latencies
+			for(size_t index = 0; index < mNumCoefficients; index += 2) {
+				auto& firstInput = inputs.at(index).at(lane);
+				auto& secondInput = inputs.at(index + 1).at(lane);
+				auto& firstPrevious = outputs.at(index).at(lane);
+				auto& secondPrevious = outputs.at(index + 1).at(lane);
+				const auto firstOutput
+					= (first - firstPrevious) * mCoefficients.at(index) + firstInput;
+				const auto secondOutput
+					= (second - secondPrevious) * mCoefficients.at(index + 1) + secondInput;
+				firstInput = first;
+				secondInput = second;
+				firstPrevious = firstOutput;
+				secondPrevious = secondOutput;
+				first = firstOutput;
+				second = secondOutput;
+			}
+		}
+
+		/// @brief Runs `size` samples of every channel of a `ChannelGroup` through each branch.
+		/// Each allpass section runs over the whole chunk before the next one, so its state
+		/// stays in registers and the lanes vectorize
+		///
+		/// @param first - The samples to run through the first branch, replaced by its outputs
+		/// @param second - The samples to run through the second branch, replaced by its
+		/// outputs
+		/// @param size - The number of samples
+		/// @param inputs - The previous inputs of the allpass sections
+		/// @param outputs - The previous outputs of the allpass sections
+		inline auto processBranchLanes(LaneChunk& first,
+									   LaneChunk& second,
+									   size_t size,
+									   SectionLanes& inputs,
+									   SectionLanes& outputs) const noexcept -> void {
+			for(size_t index = 0; index < mNumCoefficients; index += 2) {
+				const auto firstCoefficient = mCoefficients.at(index);
+				const auto secondCoefficient = mCoefficients.at(index + 1);
+				auto firstInput = inputs.at(index);
+				auto secondInput = inputs.at(index + 1);
+				auto firstOutput = outputs.at(index);
+				auto secondOutput = outputs.at(index + 1);
+				for(size_t sample = 0; sample < size; ++sample) {
+					// the lanes only touch locals, so they vectorize without checking whether
+					// `first` and `second` overlap
+					const auto firstValue = first.at(sample);
+					const auto secondValue = second.at(sample);
+					for(size_t lane = 0; lane < CHANNEL_LANES; ++lane) {
+						firstOutput.at(lane)
+							= (firstValue.at(lane) - firstOutput.at(lane)) * firstCoefficient
+							  + firstInput.at(lane);
+						secondOutput.at(lane)
+							= (secondValue.at(lane) - secondOutput.at(lane)) * secondCoefficient
+							  + secondInput.at(lane);
+					}
+					firstInput = firstValue;
+					secondInput = secondValue;
+					first.at(sample) = firstOutput;
+					second.at(sample) = secondOutput;
+				}
+				inputs.at(index) = firstInput;
+				inputs.at(index + 1) = secondInput;
+				outputs.at(index) = firstOutput;
+				outputs.at(index + 1) = secondOutput;
+			}
+		}
+
+		/// @brief Upsamples `size` samples from `input` by 2, storing the results in `output`
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the `2 * size` output samples in
+		/// @param size - The number of input samples
+		/// @param channel - The channel being upsampled
+		inline auto upSampleBlock(const FloatType* input,
+								  FloatType* output,
+								  size_t size,
+								  size_t channel) noexcept -> void {
+			auto& group = mGroups.at(channel / CHANNEL_LANES);
+			const auto lane = channel % CHANNEL_LANES;
+			for(size_t index = 0; index < size; ++index) {
+				// read before writing, the output may overlap the input
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto first = input[index];
+				auto second = first;
+				processBranches(first, second, group.upInputs, group.upOutputs, lane);
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				output[2 * index] = first;
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				output[2 * index + 1] = second;
+			}
+		}
+
+		/// @brief Downsamples `2 * size` samples from `input` by 2, storing the results in
+		/// `output`
+		///
+		/// @param input - Pointer to the `2 * size` input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of output samples
+		/// @param channel - The channel being downsampled
+		inline auto downSampleBlock(const FloatType* input,
+									FloatType* output,
+									size_t size,
+									size_t channel) noexcept -> void {
+			auto& group = mGroups.at(channel / CHANNEL_LANES);
+			const auto lane = channel % CHANNEL_LANES;
+			const auto half = narrow_cast<FloatType>(0.5);
+			for(size_t index = 0; index < size; ++index) {
+				// the odd samples go through the first branch, the even (a sample earlier)
+				// through the second
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto first = input[2 * index + 1];
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto second = input[2 * index];
+				processBranches(first, second, group.downInputs, group.downOutputs, lane);
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				output[index] = half * (first + second);
+			}
+		}
+
+		/// @brief Upsamples `size` samples from each of the `numLanes` channels of `group` at
+		/// once, the same way as `upSampleBlock`
+		///
+		/// @param inputs - Pointers to the input samples of each channel
+		/// @param outputs - Pointers to store the `2 * size` output samples of each channel in
+		/// @param numLanes - The number of channels
+		/// @param size - The number of input samples of each channel
+		/// @param group - The state of the channels
+		inline auto upSampleLanes(const std::array<const FloatType*, CHANNEL_LANES>& inputs,
+								  const std::array<FloatType*, CHANNEL_LANES>& outputs,
+								  size_t numLanes,
+								  size_t size,
+								  ChannelGroup& group) noexcept -> void {
+			auto first = LaneChunk();
+			auto second = LaneChunk();
+			for(size_t offset = 0; offset < size; offset += CHUNK_SIZE) {
+				const auto chunkSize = General<size_t>::min(size - offset, CHUNK_SIZE);
+				// unused lanes run on silence
+				first.fill(Lanes());
+				second.fill(Lanes());
+				// read the whole chunk before writing any of it, the output may overlap the input
+				for(size_t sample = 0; sample < chunkSize; ++sample) {
+					for(size_t lane = 0; lane < numLanes; ++lane) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						first.at(sample).at(lane) = inputs.at(lane)[offset + sample];
+					}
+					second.at(sample) = first.at(sample);
+				}
+				processBranchLanes(first, second, chunkSize, group.upInputs, group.upOutputs);
+				for(size_t lane = 0; lane < numLanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					auto* output = outputs.at(lane) + 2 * offset;
+					for(size_t sample = 0; sample < chunkSize; ++sample) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						output[2 * sample] = first.at(sample).at(lane);
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						output[2 * sample + 1] = second.at(sample).at(lane);
+					}
+				}
+			}
+		}
+
+		/// @brief Downsamples `2 * size` samples from each of the `numLanes` channels of `group`
+		/// at once, the same way as `downSampleBlock`
+		///
+		/// @param inputs - Pointers to the `2 * size` input samples of each channel
+		/// @param outputs - Pointers to store the output samples of each channel in
+		/// @param numLanes - The number of channels
+		/// @param size - The number of output samples of each channel
+		/// @param group - The state of the channels
+		inline auto downSampleLanes(const std::array<const FloatType*, CHANNEL_LANES>& inputs,
+									const std::array<FloatType*, CHANNEL_LANES>& outputs,
+									size_t numLanes,
+									size_t size,
+									ChannelGroup& group) noexcept -> void {
+			const auto half = narrow_cast<FloatType>(0.5);
+			auto first = LaneChunk();
+			auto second = LaneChunk();
+			for(size_t offset = 0; offset < size; offset += CHUNK_SIZE) {
+				const auto chunkSize = General<size_t>::min(size - offset, CHUNK_SIZE);
+				// unused lanes run on silence
+				first.fill(Lanes());
+				second.fill(Lanes());
+				for(size_t lane = 0; lane < numLanes; ++lane) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					const auto* input = inputs.at(lane) + 2 * offset;
+					for(size_t sample = 0; sample < chunkSize; ++sample) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						first.at(sample).at(lane) = input[2 * sample + 1];
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						second.at(sample).at(lane) = input[2 * sample];
+					}
+				}
+				processBranchLanes(first, second, chunkSize, group.downInputs, group.downOutputs);
+				for(size_t sample = 0; sample < chunkSize; ++sample) {
+					for(size_t lane = 0; lane < numLanes; ++lane) {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						outputs.at(lane)[offset + sample]
+							= half * (first.at(sample).at(lane) + second.at(sample).at(lane));
+					}
+				}
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(HalfBandIIR)
+	};
+} // namespace apex::dsp
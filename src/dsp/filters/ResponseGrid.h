@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../base/StandardIncludes.h"
+#include "BiQuadFilter.h"
+
+namespace apex::dsp {
+	/// @brief A grid of frequencies to evaluate filter responses at (eg. the points of an EQ
+	/// curve display), with the trig terms of every point precomputed for the grid's sample rate
+	///
+	/// With the trig done once per grid, evaluating a BiQuad Filter over the whole grid is only
+	/// a few multiply-adds per point, laid out in separate arrays so the loops vectorize.
+	/// Magnitudes are evaluated as polynomials in `phi = sin^2(w / 2)` rather than from
+	/// `e^{-jw}`, which avoids the cancellation `1 - cos(w)` suffers at low frequencies in
+	/// single precision
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class ResponseGrid {
+	  public:
+		/// @brief Constructs an empty `ResponseGrid`
+		ResponseGrid() noexcept = default;
+
+		/// @brief Constructs a `ResponseGrid` for the given frequencies and sample rate
+		///
+		/// @param frequencies - The frequencies of the grid, in Hertz
+		/// @param sampleRate - The sample rate responses will be evaluated at, in Hertz
+		ResponseGrid(Span<const Hertz> frequencies, Hertz sampleRate) noexcept {
+			setFrequencies(frequencies, sampleRate);
+		}
+
+		/// @brief Move constructs a `ResponseGrid` from the given one
+		///
+		/// @param grid - The `ResponseGrid` to move
+		ResponseGrid(ResponseGrid&& grid) noexcept = default;
+		~ResponseGrid() noexcept = default;
+
+		/// @brief Sets the frequencies and sample rate of this grid, recomputing its tables.
+		/// Allocates if the grid grows, so this should not be called on the audio thread
+		///
+		/// @param frequencies - The frequencies of the grid, in Hertz
+		/// @param sampleRate - The sample rate responses will be evaluated at, in Hertz
+		inline auto setFrequencies(Span<const Hertz> frequencies, Hertz sampleRate) noexcept
+			-> void {
+			const auto size = frequencies.size();
+			mSampleRate = sampleRate;
+			mFrequencies.resize(size);
+			mPhi.resize(size);
+			mCos1.resize(size);
+			mSin1.resize(size);
+			mCos2.resize(size);
+			mSin2.resize(size);
+
+			const auto two = narrow_cast<FloatType>(2.0);
+			const auto half = narrow_cast<FloatType>(0.5);
+			const auto wScale = Constants<FloatType>::twoPi
+								/ narrow_cast<FloatType>(static_cast<double>(sampleRate));
+			for(size_t i = 0; i < size; ++i) {
+				jassert(frequencies.at(i) >= 0.0_Hz
+						&& frequencies.at(i) <= static_cast<double>(sampleRate) * 0.5);
+				mFrequencies.at(i) = frequencies.at(i);
+				const auto w
+					= wScale * narrow_cast<FloatType>(static_cast<double>(frequencies.at(i)));
+				const auto sinHalf = std::sin(half * w);
+				mPhi.at(i) = sinHalf * sinHalf;
+				mCos1.at(i) = std::cos(w);
+				mSin1.at(i) = std::sin(w);
+				mCos2.at(i) = std::cos(two * w);
+				mSin2.at(i) = std::sin(two * w);
+			}
+		}
+
+		/// @brief Returns the number of points in this grid
+		///
+		/// @return - The number of frequencies
+		[[nodiscard]] inline auto size() const noexcept -> size_t {
+			return mFrequencies.size();
+		}
+
+		/// @brief Returns the frequency of the given point of this grid
+		///
+		/// @param index - The index of the point
+		///
+		/// @return - The frequency, in Hertz
+		[[nodiscard]] inline auto getFrequency(size_t index) const noexcept -> Hertz {
+			return mFrequencies.at(index);
+		}
+
+		/// @brief Returns the sample rate this grid was computed for
+		///
+		/// @return - The sample rate, in Hertz
+		[[nodiscard]] inline auto getSampleRate() const noexcept -> Hertz {
+			return mSampleRate;
+		}
+
+		/// @brief Calculates the linear magnitude response of the given filter at every point of
+		/// this grid
+		///
+		/// @param coefficients - The coefficients of the filter
+		/// @param magnitudes - The array to store the magnitudes in
+		inline auto getMagnitudes(const BiQuadCoefficients<FloatType>& coefficients,
+								  Span<FloatType> magnitudes) const noexcept -> void {
+			getMagnitudes(Span<const BiQuadCoefficients<FloatType>>::MakeSpan(&coefficients, 1),
+						  magnitudes);
+		}
+
+		/// @brief Calculates the linear magnitude response of the given cascade of filters at
+		/// every point of this grid
+		///
+		/// @param stages - The coefficients of each filter in the cascade
+		/// @param magnitudes - The array to store the magnitudes in
+		inline auto getMagnitudes(Span<const BiQuadCoefficients<FloatType>> stages,
+								  Span<FloatType> magnitudes) const noexcept -> void {
+			jassert(magnitudes.size() == size());
+			const auto numPoints = size();
+			const auto one = narrow_cast<FloatType>(1.0);
+			auto* out = magnitudes.data();
+
+			for(size_t i = 0; i < numPoints; ++i) {
+				out[i] = one; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+
+			// accumulate the squared magnitude of every stage, so only one square root is
+			// needed per point. For b0 + b1z^-1 + b2z^-2, |N|^2 at phi = sin^2(w / 2) is
+			// (b0 + b1 + b2)^2 - 4(b0b1 + 4b0b2 + b1b2)phi + 16b0b2phi^2, and likewise for |D|^2
+			const auto four = narrow_cast<FloatType>(4.0);
+			const auto sixteen = narrow_cast<FloatType>(16.0);
+			for(const auto& stage : stages) {
+				const auto numeratorSum = stage.b0 + stage.b1 + stage.b2;
+				const auto numerator0 = numeratorSum * numeratorSum;
+				const auto numerator1 = -four
+										* (stage.b0 * stage.b1 + four * stage.b0 * stage.b2
+										   + stage.b1 * stage.b2);
+				const auto numerator2 = sixteen * stage.b0 * stage.b2;
+				const auto denominatorSum = one + stage.a1 + stage.a2;
+				const auto denominator0 = denominatorSum * denominatorSum;
+				const auto denominator1
+					= -four * (stage.a1 + four * stage.a2 + stage.a1 * stage.a2);
+				const auto denominator2 = sixteen * stage.a2;
+				for(size_t i = 0; i < numPoints; ++i) {
+					const auto phi = mPhi[i];
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					out[i] *= (numerator0 + (numerator1 + numerator2 * phi) * phi)
+							  / (denominator0 + (denominator1 + denominator2 * phi) * phi);
+				}
+			}
+
+			for(size_t i = 0; i < numPoints; ++i) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[i] = std::sqrt(out[i]);
+			}
+		}
+
+		/// @brief Calculates the phase response of the given filter at every point of this grid
+		///
+		/// @param coefficients - The coefficients of the filter
+		/// @param phases - The array to store the phases in
+		inline auto getPhases(const BiQuadCoefficients<FloatType>& coefficients,
+							  Span<Radians> phases) const noexcept -> void {
+			getPhases(Span<const BiQuadCoefficients<FloatType>>::MakeSpan(&coefficients, 1),
+					  phases);
+		}
+
+		/// @brief Calculates the phase response of the given cascade of filters, as the sum of
+		/// the phase of each stage, at every point of this grid
+		///
+		/// @param stages - The coefficients of each filter in the cascade
+		/// @param phases - The array to store the phases in
+		inline auto getPhases(Span<const BiQuadCoefficients<FloatType>> stages,
+							  Span<Radians> phases) const noexcept -> void {
+			jassert(phases.size() == size());
+			const auto numPoints = size();
+			for(size_t i = 0; i < numPoints; ++i) {
+				phases.at(i) = 0.0_rad;
+			}
+
+			for(const auto& stage : stages) {
+				for(size_t i = 0; i < numPoints; ++i) {
+					const auto cos1 = mCos1[i];
+					const auto sin1 = mSin1[i];
+					const auto cos2 = mCos2[i];
+					const auto sin2 = mSin2[i];
+					const auto numeratorReal = stage.b0 + stage.b1 * cos1 + stage.b2 * cos2;
+					const auto numeratorImag = -(stage.b1 * sin1 + stage.b2 * sin2);
+					const auto denominatorReal
+						= narrow_cast<FloatType>(1.0) + stage.a1 * cos1 + stage.a2 * cos2;
+					const auto denominatorImag = -(stage.a1 * sin1 + stage.a2 * sin2);
+					// arg(N / D) == arg(N * conj(D))
+					phases.at(i) += std::atan2(numeratorImag * denominatorReal
+												   - numeratorReal * denominatorImag,
+											   numeratorReal * denominatorReal
+												   + numeratorImag * denominatorImag);
+				}
+			}
+		}
+
+		auto operator=(ResponseGrid&& grid) noexcept -> ResponseGrid& = default;
+
+	  private:
+		std::vector<Hertz> mFrequencies = std::vector<Hertz>();
+		Hertz mSampleRate = 44.1_kHz;
+		/// sin^2(w / 2) for every point
+		std::vector<FloatType> mPhi = std::vector<FloatType>();
+		/// The real and (negated) imaginary parts of e^{-jw} and e^{-2jw} for every point
+		std::vector<FloatType> mCos1 = std::vector<FloatType>();
+		std::vector<FloatType> mSin1 = std::vector<FloatType>();
+		std::vector<FloatType> mCos2 = std::vector<FloatType>();
+		std::vector<FloatType> mSin2 = std::vector<FloatType>();
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ResponseGrid)
+	};
+} // namespace apex::dsp
@@ -0,0 +1,512 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "../../base/StandardIncludes.h"
+#include "BiQuadFilter.h"
+#include "ResponseGrid.h"
+
+namespace apex::dsp {
+	/// @brief Topology-preserving (zero-delay-feedback) State Variable Filter, supporting the
+	/// same `FilterType`s as `BiQuadFilter`
+	///
+	/// Unlike a `BiQuadFilter`, whose coefficients cost a `sin`, `cos` and `pow10` to
+	/// recalculate and which misbehaves when they change quickly, a change in frequency here
+	/// only costs a single `tan`, and the filter stays well-behaved when the frequency is
+	/// modulated at audio rate. Q and gain only affect the output mix and damping, so they are
+	/// calculated once per change and not per sample
+	///
+	/// @see https://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class StateVariableFilter {
+	  public:
+		/// @brief Constructs a default `StateVariableFilter`
+		StateVariableFilter() noexcept {
+			updateCoefficients();
+		}
+
+		/// @brief Constructs a `StateVariableFilter` with the given parameters
+		///
+		/// @param type - The type of filter
+		/// @param frequency - The frequency to use, in Hertz
+		/// @param q - The Q to use
+		/// @param gain - The gain to use, in Decibels
+		/// @param sampleRate - The sample rate to use, in Hertz
+		StateVariableFilter(FilterType type,
+							Hertz frequency,
+							FloatType q = narrow_cast<FloatType>(0.7),
+							Decibels gain = 0.0_dB,
+							Hertz sampleRate = 44.1_kHz) noexcept
+			: mType(type), mFrequency(frequency), mQ(q), mGain(gain), mSampleRate(sampleRate) {
+			updateCoefficients();
+		}
+
+		/// @brief Move constructs a `StateVariableFilter` from the given one
+		///
+		/// @param filt - The `StateVariableFilter` to move
+		StateVariableFilter(StateVariableFilter&& filt) noexcept = default;
+		~StateVariableFilter() noexcept = default;
+
+		/// @brief Sets every parameter of this filter at once, recalculating its coefficients only
+		/// once
+		///
+		/// @param type - The new filter type
+		/// @param frequency - The new frequency, in Hertz
+		/// @param q - The new Q
+		/// @param gain - The new gain, in Decibels
+		/// @param sampleRate - The new sample rate, in Hertz
+		inline auto setParameters(FilterType type,
+								  Hertz frequency,
+								  FloatType q,
+								  Decibels gain,
+								  Hertz sampleRate) noexcept -> void {
+			jassert(q > narrow_cast<FloatType>(0.0));
+			mType = type;
+			mFrequency = frequency;
+			mQ = q;
+			mGain = gain;
+			mSampleRate = sampleRate;
+			updateCoefficients();
+		}
+
+		/// @brief Sets the type of this filter to the given value
+		///
+		/// @param type - The new filter type
+		inline auto setFilterType(FilterType type) noexcept -> void {
+			mType = type;
+			updateCoefficients();
+		}
+
+		/// @brief Returns the type of this filter
+		///
+		/// @return - The filter type
+		[[nodiscard]] inline auto getFilterType() const noexcept -> FilterType {
+			return mType;
+		}
+
+		/// @brief Sets the frequency of this filter to the given value. Only costs a single
+		/// `tan`, so this is safe to call every sample
+		///
+		/// @param frequency - The new frequency, in Hertz
+		inline auto setFrequency(Hertz frequency) noexcept -> void {
+			jassert(frequency >= 0.0_Hz && frequency < static_cast<double>(mSampleRate) * 0.5);
+			mFrequency = frequency;
+			updateFrequencyCoefficients(narrow_cast<FloatType>(static_cast<double>(frequency)));
+		}
+
+		/// @brief Returns the frequency of this filter
+		///
+		/// @return - The frequency, in Hertz
+		[[nodiscard]] inline auto getFrequency() const noexcept -> Hertz {
+			return mFrequency;
+		}
+
+		/// @brief Sets the Q of this filter to the given value
+		///
+		/// @param q - The new Q
+		inline auto setQ(FloatType q) noexcept -> void {
+			jassert(q > narrow_cast<FloatType>(0.0));
+			mQ = q;
+			updateCoefficients();
+		}
+
+		/// @brief Returns the Q of this filter
+		///
+		/// @return - The Q
+		[[nodiscard]] inline auto getQ() const noexcept -> FloatType {
+			return mQ;
+		}
+
+		/// @brief Sets the gain of this filter to the given value
+		///
+		/// @param gain - The new gain, in Decibels
+		inline auto setGainDB(Decibels gain) noexcept -> void {
+			mGain = gain;
+			updateCoefficients();
+		}
+
+		/// @brief Returns the gain of this filter
+		///
+		/// @return - The gain, in Decibels
+		[[nodiscard]] inline auto getGainDB() const noexcept -> Decibels {
+			return mGain;
+		}
+
+		/// @brief Sets the sample rate of this filter to the given value
+		///
+		/// @param sampleRate - The new sample rate, in Hertz
+		inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
+			mSampleRate = sampleRate;
+			updateCoefficients();
+		}
+
+		/// @brief Returns the sample rate of this filter
+		///
+		/// @return - The sample rate, in Hertz
+		[[nodiscard]] inline auto getSampleRate() const noexcept -> Hertz {
+			return mSampleRate;
+		}
+
+		/// @brief Returns the coefficients of the BiQuad Filter equivalent to this filter at its
+		/// current frequency. Both are the bilinear transform of the same analog prototype, so
+		/// their responses are identical
+		///
+		/// @return - The equivalent (normalized) coefficients
+		[[nodiscard]] inline auto
+		getCoefficients() const noexcept -> BiQuadCoefficients<FloatType> {
+			const auto one = narrow_cast<FloatType>(1.0);
+			const auto two = narrow_cast<FloatType>(2.0);
+			const auto g = mG;
+			const auto gSquared = g * g;
+			const auto kg = mK * g;
+			// the analog prototype is (m0(s^2 + ks + 1) + m1s + m2) / (s^2 + ks + 1)
+			const auto s1 = (mM0 * mK + mM1) * g;
+			const auto s0 = (mM0 + mM2) * gSquared;
+			const auto a0Inverse = one / (one + kg + gSquared);
+			return {(mM0 + s1 + s0) * a0Inverse,
+					two * (s0 - mM0) * a0Inverse,
+					(mM0 - s1 + s0) * a0Inverse,
+					two * (gSquared - one) * a0Inverse,
+					(one - kg + gSquared) * a0Inverse};
+		}
+
+		/// @brief Calculates the linear magnitude response of this filter at every point of the
+		/// given grid
+		///
+		/// @param grid - The frequencies to calculate the magnitude response for
+		/// @param magnitudes - The array to store the magnitudes in
+		inline auto getMagnitudesForFrequencies(const ResponseGrid<FloatType>& grid,
+												Span<FloatType> magnitudes) const noexcept
+			-> void {
+			grid.getMagnitudes(getCoefficients(), magnitudes);
+		}
+
+		/// @brief Calculates the phase response of this filter at every point of the given grid
+		///
+		/// @param grid - The frequencies to calculate the phase response for
+		/// @param phases - The array to store the phases in
+		inline auto getPhasesForFrequencies(const ResponseGrid<FloatType>& grid,
+											Span<Radians> phases) const noexcept -> void {
+			grid.getPhases(getCoefficients(), phases);
+		}
+
+		/// @brief Applies this filter to the given input value
+		///
+		/// @param input - The input value to apply filtering to
+		///
+		/// @return - The filtered value
+		[[nodiscard]] inline auto process(FloatType input) noexcept -> FloatType {
+			const auto two = narrow_cast<FloatType>(2.0);
+			const auto v3 = input - mIc2;
+			const auto v1 = mA1 * mIc1 + mA2 * v3;
+			const auto v2 = mIc2 + mA2 * mIc1 + mA3 * v3;
+			mIc1 = two * v1 - mIc1;
+			mIc2 = two * v2 - mIc2;
+
+			return mM0 * input + mM1 * v1 + mM2 * v2;
+		}
+
+		/// @brief Applies this filter to the array of given input values
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto process(Span<FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			processBlock(input.data(), output.data(), input.size());
+		}
+
+		/// @brief Applies this filter to the array of given input values
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		inline auto process(Span<const FloatType> input, Span<FloatType> output) noexcept -> void {
+			jassert(input.size() == output.size());
+			processBlock(input.data(), output.data(), input.size());
+		}
+
+		/// @brief Applies this filter to the array of given input values, with its frequency
+		/// modulated per sample. The frequency of this filter is left at the last modulated value
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		/// @param frequencies - The frequency to use for each sample, in Hertz. Values are
+		/// clamped to just below Nyquist
+		/// @param frequencyScale - A constant multiplier applied to every frequency (eg. to
+		/// offset the stages of a cascade from each other)
+		inline auto process(Span<FloatType> input,
+							Span<FloatType> output,
+							Span<const FloatType> frequencies,
+							FloatType frequencyScale = narrow_cast<FloatType>(1.0)) noexcept
+			-> void {
+			jassert(input.size() == output.size() && input.size() == frequencies.size());
+			processModulatedBlock(input.data(),
+								  output.data(),
+								  frequencies.data(),
+								  frequencyScale,
+								  input.size());
+		}
+
+		/// @brief Applies this filter to the array of given input values, with its frequency
+		/// modulated per sample. The frequency of this filter is left at the last modulated value
+		///
+		/// @param input - The array of input values to filter
+		/// @param output - The array to store the output values in
+		/// @param frequencies - The frequency to use for each sample, in Hertz. Values are
+		/// clamped to just below Nyquist
+		/// @param frequencyScale - A constant multiplier applied to every frequency (eg. to
+		/// offset the stages of a cascade from each other)
+		inline auto process(Span<const FloatType> input,
+							Span<FloatType> output,
+							Span<const FloatType> frequencies,
+							FloatType frequencyScale = narrow_cast<FloatType>(1.0)) noexcept
+			-> void {
+			jassert(input.size() == output.size() && input.size() == frequencies.size());
+			processModulatedBlock(input.data(),
+								  output.data(),
+								  frequencies.data(),
+								  frequencyScale,
+								  input.size());
+		}
+
+		/// @brief Resets this filter to an initial state
+		inline auto reset() noexcept -> void {
+			mIc1 = narrow_cast<FloatType>(0.0);
+			mIc2 = narrow_cast<FloatType>(0.0);
+		}
+
+		auto operator=(StateVariableFilter&& filt) noexcept -> StateVariableFilter& = default;
+
+	  private:
+		/// Prewarped frequency, scaled for shelves
+		FloatType mG = narrow_cast<FloatType>(0.0);
+		/// Damping (1 / Q, scaled by the gain for bells)
+		FloatType mK = narrow_cast<FloatType>(0.0);
+		/// Per-sample coefficients, derived from `mG` and `mK`
+		FloatType mA1 = narrow_cast<FloatType>(0.0);
+		FloatType mA2 = narrow_cast<FloatType>(0.0);
+		FloatType mA3 = narrow_cast<FloatType>(0.0);
+		/// Output mix of the input, bandpass and lowpass signals
+		FloatType mM0 = narrow_cast<FloatType>(0.0);
+		FloatType mM1 = narrow_cast<FloatType>(0.0);
+		FloatType mM2 = narrow_cast<FloatType>(0.0);
+		/// Converts a frequency in Hertz to the argument of `tan` (pi / sampleRate)
+		FloatType mFrequencyToAngle = narrow_cast<FloatType>(0.0);
+		/// Multiplier on `g` used by the shelves to place their midpoint at the frequency
+		FloatType mGScale = narrow_cast<FloatType>(1.0);
+		/// The highest frequency modulation may reach, just below Nyquist
+		FloatType mMaxFrequency = narrow_cast<FloatType>(0.0);
+
+		/// Integrator states
+		FloatType mIc1 = narrow_cast<FloatType>(0.0);
+		FloatType mIc2 = narrow_cast<FloatType>(0.0);
+
+		FilterType mType = FilterType::Bell;
+		Hertz mFrequency = 1.0_kHz;
+		FloatType mQ = narrow_cast<FloatType>(0.7);
+		Decibels mGain = 0.0_dB;
+		Hertz mSampleRate = 44.1_kHz;
+
+		/// @brief Recalculates the damping and output mix for the current type, Q, gain and
+		/// sample rate, followed by the frequency-dependent coefficients
+		inline auto updateCoefficients() noexcept -> void {
+			const auto zero = narrow_cast<FloatType>(0.0);
+			const auto one = narrow_cast<FloatType>(1.0);
+			const auto two = narrow_cast<FloatType>(2.0);
+			const auto sampleRate = narrow_cast<FloatType>(static_cast<double>(mSampleRate));
+			const auto a = Exponentials<FloatType>::pow10(narrow_cast<FloatType>(mGain)
+														  / narrow_cast<FloatType>(40.0));
+			const auto aSquared = a * a;
+			const auto k = one / mQ;
+
+			mFrequencyToAngle = Constants<FloatType>::pi / sampleRate;
+			mMaxFrequency = sampleRate * narrow_cast<FloatType>(0.49);
+			mGScale = one;
+			mK = k;
+
+			switch(mType) {
+				case FilterType::Lowpass:
+					{
+						mM0 = zero;
+						mM1 = zero;
+						mM2 = one;
+					}
+					break;
+				case FilterType::Highpass:
+					{
+						mM0 = one;
+						mM1 = -k;
+						mM2 = -one;
+					}
+					break;
+				case FilterType::Bandpass:
+					{
+						mM0 = zero;
+						mM1 = k;
+						mM2 = zero;
+					}
+					break;
+				case FilterType::Allpass:
+					{
+						mM0 = one;
+						mM1 = -two * k;
+						mM2 = zero;
+					}
+					break;
+				case FilterType::Notch:
+					{
+						mM0 = one;
+						mM1 = -k;
+						mM2 = zero;
+					}
+					break;
+				case FilterType::LowShelf:
+					{
+						mGScale = one / General<FloatType>::sqrt(a);
+						mM0 = one;
+						mM1 = k * (a - one);
+						mM2 = aSquared - one;
+					}
+					break;
+				case FilterType::HighShelf:
+					{
+						mGScale = General<FloatType>::sqrt(a);
+						mM0 = aSquared;
+						mM1 = k * (one - a) * a;
+						mM2 = one - aSquared;
+					}
+					break;
+				case FilterType::Bell:
+					{
+						mK = k / a;
+						mM0 = one;
+						mM1 = mK * (aSquared - one);
+						mM2 = zero;
+					}
+					break;
+				case FilterType::AnalogBell:
+					{
+						// like `BiQuadFilter`, the Q widens with the gain
+						mK = k / aSquared;
+						mM0 = one;
+						mM1 = mK * (aSquared - one);
+						mM2 = zero;
+					}
+					break;
+			}
+
+			updateFrequencyCoefficients(narrow_cast<FloatType>(static_cast<double>(mFrequency)));
+		}
+
+		/// @brief Recalculates the frequency-dependent coefficients for the given frequency
+		///
+		/// @param frequency - The frequency, in Hertz
+		inline auto updateFrequencyCoefficients(FloatType frequency) noexcept -> void {
+			mG = Trig<FloatType>::tan(frequency * mFrequencyToAngle) * mGScale;
+			mA1 = narrow_cast<FloatType>(1.0) / (narrow_cast<FloatType>(1.0) + mG * (mG + mK));
+			mA2 = mG * mA1;
+			mA3 = mG * mA2;
+		}
+
+		/// @brief Applies this filter to `size` samples from `input`, storing the results in
+		/// `output`. `input` and `output` may alias
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param size - The number of samples to process
+		inline auto
+		processBlock(const FloatType* input, FloatType* output, size_t size) noexcept -> void {
+			// keep the coefficients and state in locals so they stay in registers across the loop
+			const auto two = narrow_cast<FloatType>(2.0);
+			const auto a1 = mA1;
+			const auto a2 = mA2;
+			const auto a3 = mA3;
+			const auto m0 = mM0;
+			const auto m1 = mM1;
+			const auto m2 = mM2;
+			auto ic1 = mIc1;
+			auto ic2 = mIc2;
+
+			for(size_t i = 0; i < size; ++i) {
+				const auto v0 = input[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto v3 = v0 - ic2;
+				const auto v1 = a1 * ic1 + a2 * v3;
+				const auto v2 = ic2 + a2 * ic1 + a3 * v3;
+				ic1 = two * v1 - ic1;
+				ic2 = two * v2 - ic2;
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				output[i] = m0 * v0 + m1 * v1 + m2 * v2;
+			}
+
+			mIc1 = ic1;
+			mIc2 = ic2;
+		}
+
+		/// @brief Applies this filter to `size` samples from `input`, recalculating the
+		/// frequency-dependent coefficients for every sample, and storing the results in
+		/// `output`. `input` and `output` may alias
+		///
+		/// @param input - Pointer to the input samples
+		/// @param output - Pointer to store the output samples in
+		/// @param frequencies - Pointer to the frequency of each sample, in Hertz
+		/// @param frequencyScale - A constant multiplier applied to every frequency
+		/// @param size - The number of samples to process
+		inline auto processModulatedBlock(const FloatType* input,
+										  FloatType* output,
+										  const FloatType* frequencies,
+										  FloatType frequencyScale,
+										  size_t size) noexcept -> void {
+			const auto zero = narrow_cast<FloatType>(0.0);
+			const auto one = narrow_cast<FloatType>(1.0);
+			const auto two = narrow_cast<FloatType>(2.0);
+			const auto angleScale = mFrequencyToAngle * frequencyScale;
+			const auto maxAngle = mMaxFrequency * mFrequencyToAngle;
+			const auto gScale = mGScale;
+			const auto k = mK;
+			const auto m0 = mM0;
+			const auto m1 = mM1;
+			const auto m2 = mM2;
+			auto ic1 = mIc1;
+			auto ic2 = mIc2;
+			auto g = mG;
+
+			for(size_t i = 0; i < size; ++i) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto angle = std::clamp(frequencies[i] * angleScale, zero, maxAngle);
+				g = Trig<FloatType>::tan(angle) * gScale;
+				const auto a1 = one / (one + g * (g + k));
+				const auto a2 = g * a1;
+				const auto a3 = g * a2;
+
+				const auto v0 = input[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto v3 = v0 - ic2;
+				const auto v1 = a1 * ic1 + a2 * v3;
+				const auto v2 = ic2 + a2 * ic1 + a3 * v3;
+				ic1 = two * v1 - ic1;
+				ic2 = two * v2 - ic2;
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				output[i] = m0 * v0 + m1 * v1 + m2 * v2;
+			}
+
+			mIc1 = ic1;
+			mIc2 = ic2;
+			if(size > 0) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto last = std::clamp(frequencies[size - 1] * frequencyScale,
+											 zero,
+											 mMaxFrequency);
+				mFrequency = Hertz(static_cast<double>(last));
+				mG = g;
+				mA1 = one / (one + g * (g + k));
+				mA2 = g * mA1;
+				mA3 = g * mA2;
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StateVariableFilter)
+	};
+} // namespace apex::dsp
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../BiQuadBank.h"
+#include "BiQuadFilterBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	template<typename FloatType, size_t Lanes>
+	inline auto benchmarkBiQuadBank(const std::string& typeName) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE * Lanes);
+		auto referenceOutput = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE * Lanes);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE * Lanes);
+		fillWithNoise(input);
+
+		auto inputs = std::array<Span<const FloatType>, Lanes>();
+		auto referenceOutputs = std::array<Span<FloatType>, Lanes>();
+		auto outputs = std::array<Span<FloatType>, Lanes>();
+		for(auto lane = 0U; lane < Lanes; ++lane) {
+			auto offset = lane * BENCHMARK_BLOCK_SIZE;
+			inputs.at(lane)
+				= Span<const FloatType>::MakeSpan(&input.at(offset), BENCHMARK_BLOCK_SIZE);
+			referenceOutputs.at(lane)
+				= Span<FloatType>::MakeSpan(&referenceOutput.at(offset), BENCHMARK_BLOCK_SIZE);
+			outputs.at(lane) = Span<FloatType>::MakeSpan(&output.at(offset), BENCHMARK_BLOCK_SIZE);
+		}
+
+		auto filters = std::array<BiQuadFilter<FloatType>, Lanes>();
+		for(auto& filter : filters) {
+			filter = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+													   narrow_cast<FloatType>(0.7),
+													   6.0_dB,
+													   44.1_kHz);
+		}
+		auto bank = BiQuadBank<FloatType, Lanes>(BiQuadFilter<FloatType>::MakeBell(
+			1.0_kHz,
+			narrow_cast<FloatType>(0.7),
+			6.0_dB,
+			44.1_kHz));
+
+		auto filterNanos = benchmarkNanoseconds([&]() {
+			for(auto lane = 0U; lane < Lanes; ++lane) {
+				filters.at(lane).process(inputs.at(lane), referenceOutputs.at(lane));
+			}
+			doNotOptimize(referenceOutput.back());
+		});
+		auto bankNanos = benchmarkNanoseconds([&]() {
+			bank.process(inputs, outputs);
+			doNotOptimize(output.back());
+		});
+
+		auto numSamples = static_cast<double>(BENCHMARK_BLOCK_SIZE * Lanes);
+		auto lanes = std::to_string(Lanes);
+		reportBenchmark("BiQuadFilter<" + typeName + "> x " + lanes + " channels",
+						filterNanos / numSamples);
+		reportBenchmark("BiQuadBank<" + typeName + ", " + lanes + ">",
+						bankNanos / numSamples);
+	}
+
+	TEST(BiQuadBankBench, processFloatStereo) {
+		benchmarkBiQuadBank<float, 2>("float");
+	}
+
+	TEST(BiQuadBankBench, processFloatSurround) {
+		benchmarkBiQuadBank<float, 8>("float");
+	}
+
+	TEST(BiQuadBankBench, processDoubleStereo) {
+		benchmarkBiQuadBank<double, 2>("double");
+	}
+
+	TEST(BiQuadBankBench, processDoubleSurround) {
+		benchmarkBiQuadBank<double, 8>("double");
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "../BiQuadBank.h"
+#include "FilterTestSignals.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Checks every lane of a `BiQuadBank` matches an independent `BiQuadFilter` fed the
+	/// same input
+	template<typename FloatType, size_t Lanes>
+	inline auto checkBiQuadBank() -> void {
+		constexpr size_t size = 512;
+		auto input = std::vector<FloatType>(size * Lanes);
+		auto referenceOutput = std::vector<FloatType>(size * Lanes);
+		auto output = std::vector<FloatType>(size * Lanes);
+		fillWithNoise(input);
+
+		auto inputs = std::array<Span<const FloatType>, Lanes>();
+		auto outputs = std::array<Span<FloatType>, Lanes>();
+		auto filters = std::array<BiQuadFilter<FloatType>, Lanes>();
+		for(auto lane = 0U; lane < Lanes; ++lane) {
+			auto offset = lane * size;
+			inputs.at(lane) = Span<const FloatType>::MakeSpan(&input.at(offset), size);
+			outputs.at(lane) = Span<FloatType>::MakeSpan(&output.at(offset), size);
+			filters.at(lane) = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+																 narrow_cast<FloatType>(0.7),
+																 6.0_dB,
+																 44.1_kHz);
+			filters.at(lane).process(inputs.at(lane),
+									 Span<FloatType>::MakeSpan(&referenceOutput.at(offset), size));
+		}
+		auto bank = BiQuadBank<FloatType, Lanes>(BiQuadFilter<FloatType>::MakeBell(
+			1.0_kHz,
+			narrow_cast<FloatType>(0.7),
+			6.0_dB,
+			44.1_kHz));
+
+		bank.process(inputs, outputs);
+		for(auto i = 0U; i < output.size(); ++i) {
+			ASSERT_NEAR(output.at(i), referenceOutput.at(i), 0.00001);
+		}
+	}
+
+	TEST(BiQuadBankTest, matchesFiltersFloatStereo) {
+		checkBiQuadBank<float, 2>();
+	}
+
+	TEST(BiQuadBankTest, matchesFiltersFloatSurround) {
+		checkBiQuadBank<float, 8>();
+	}
+
+	TEST(BiQuadBankTest, matchesFiltersDoubleStereo) {
+		checkBiQuadBank<double, 2>();
+	}
+
+	TEST(BiQuadBankTest, matchesFiltersDoubleSurround) {
+		checkBiQuadBank<double, 8>();
+	}
+} // namespace apex::dsp::test
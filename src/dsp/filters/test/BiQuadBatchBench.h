@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../BiQuadBatch.h"
+#include "BiQuadFilterBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	template<typename FloatType, size_t Tracks>
+	inline auto benchmarkBiQuadBatch(const std::string& typeName) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE * Tracks);
+		auto referenceOutput = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE * Tracks);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE * Tracks);
+		fillWithNoise(input);
+
+		auto inputs = std::array<Span<const FloatType>, Tracks>();
+		auto referenceOutputs = std::array<Span<FloatType>, Tracks>();
+		auto outputs = std::array<Span<FloatType>, Tracks>();
+		for(auto track = 0U; track < Tracks; ++track) {
+			auto offset = track * BENCHMARK_BLOCK_SIZE;
+			inputs.at(track)
+				= Span<const FloatType>::MakeSpan(&input.at(offset), BENCHMARK_BLOCK_SIZE);
+			referenceOutputs.at(track)
+				= Span<FloatType>::MakeSpan(&referenceOutput.at(offset), BENCHMARK_BLOCK_SIZE);
+			outputs.at(track)
+				= Span<FloatType>::MakeSpan(&output.at(offset), BENCHMARK_BLOCK_SIZE);
+		}
+
+		// every track uses the same band, but with its own settings
+		auto filters = std::array<BiQuadFilter<FloatType>, Tracks>();
+		auto batch = BiQuadBatch<FloatType, Tracks>();
+		auto lanes = std::array<size_t, Tracks>();
+		for(auto track = 0U; track < Tracks; ++track) {
+			filters.at(track) = BiQuadFilter<FloatType>::MakeBell(
+				Hertz(500.0 + 250.0 * static_cast<double>(track)),
+				narrow_cast<FloatType>(0.7),
+				Decibels(static_cast<double>(track) - 4.0),
+				44.1_kHz);
+			lanes.at(track) = batch.registerFilter(filters.at(track)).unwrap();
+		}
+
+		auto filterNanos = benchmarkNanoseconds([&]() {
+			for(auto track = 0U; track < Tracks; ++track) {
+				filters.at(track).process(inputs.at(track), referenceOutputs.at(track));
+			}
+			doNotOptimize(referenceOutput.back());
+		});
+		auto batchNanos = benchmarkNanoseconds([&]() {
+			for(auto track = 0U; track < Tracks; ++track) {
+				batch.bind(lanes.at(track), inputs.at(track), outputs.at(track));
+			}
+			batch.process(BENCHMARK_BLOCK_SIZE);
+			doNotOptimize(output.back());
+		});
+
+		auto numSamples = static_cast<double>(BENCHMARK_BLOCK_SIZE * Tracks);
+		auto tracks = std::to_string(Tracks);
+		reportBenchmark("BiQuadFilter<" + typeName + "> x " + tracks + " tracks, serial",
+						filterNanos / numSamples);
+		reportBenchmark("BiQuadBatch<" + typeName + ", " + tracks + ">",
+						batchNanos / numSamples);
+	}
+
+	TEST(BiQuadBatchBench, processFloat) {
+		benchmarkBiQuadBatch<float, 8>("float");
+	}
+
+	TEST(BiQuadBatchBench, processDouble) {
+		benchmarkBiQuadBatch<double, 4>("double");
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "../BiQuadBatch.h"
+#include "FilterTestSignals.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Checks a full `BiQuadBatch` refuses further filters, and that every lane of it
+	/// matches the track's own `BiQuadFilter` fed the same input
+	template<typename FloatType, size_t Tracks>
+	inline auto checkBiQuadBatch() -> void {
+		constexpr size_t size = 512;
+		auto input = std::vector<FloatType>(size * Tracks);
+		auto referenceOutput = std::vector<FloatType>(size * Tracks);
+		auto output = std::vector<FloatType>(size * Tracks);
+		fillWithNoise(input);
+
+		// every track uses the same band, but with its own settings
+		auto filters = std::array<BiQuadFilter<FloatType>, Tracks>();
+		auto batch = BiQuadBatch<FloatType, Tracks>();
+		auto lanes = std::array<size_t, Tracks>();
+		for(auto track = 0U; track < Tracks; ++track) {
+			filters.at(track) = BiQuadFilter<FloatType>::MakeBell(
+				Hertz(500.0 + 250.0 * static_cast<double>(track)),
+				narrow_cast<FloatType>(0.7),
+				Decibels(static_cast<double>(track) - 4.0),
+				44.1_kHz);
+			auto lane = batch.registerFilter(filters.at(track));
+			ASSERT_TRUE(lane.isSome());
+			lanes.at(track) = lane.unwrap();
+		}
+		ASSERT_FALSE(batch.registerFilter(filters.at(0)).isSome());
+
+		for(auto track = 0U; track < Tracks; ++track) {
+			auto offset = track * size;
+			auto trackInput = Span<const FloatType>::MakeSpan(&input.at(offset), size);
+			filters.at(track).process(trackInput,
+									  Span<FloatType>::MakeSpan(&referenceOutput.at(offset), size));
+			batch.bind(lanes.at(track),
+					   trackInput,
+					   Span<FloatType>::MakeSpan(&output.at(offset), size));
+		}
+		batch.process(size);
+		for(auto i = 0U; i < output.size(); ++i) {
+			ASSERT_NEAR(output.at(i), referenceOutput.at(i), 0.00001);
+		}
+	}
+
+	TEST(BiQuadBatchTest, matchesFiltersFloat) {
+		checkBiQuadBatch<float, 8>();
+	}
+
+	TEST(BiQuadBatchTest, matchesFiltersDouble) {
+		checkBiQuadBatch<double, 4>();
+	}
+} // namespace apex::dsp::test
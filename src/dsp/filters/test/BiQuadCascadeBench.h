@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../BiQuadCascade.h"
+#include "BiQuadFilterBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	template<typename FloatType>
+	inline auto benchmarkBiQuadCascade(const std::string& typeName) -> void {
+		constexpr size_t numStages = 8;
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto referenceOutput = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+
+		// the previous EQBand layout: a heap-allocated vector of stages, walked once per sample
+		auto stages = std::vector<BiQuadFilter<FloatType>>(numStages);
+		auto cascade = BiQuadCascade<FloatType, numStages>();
+		cascade.setNumStages(numStages);
+		for(auto stage = 0U; stage < numStages; ++stage) {
+			auto frequency = Hertz(1000.0 + 250.0 * static_cast<double>(stage));
+			stages.at(stage) = BiQuadFilter<FloatType>::MakeLowpass(frequency,
+																	narrow_cast<FloatType>(0.7),
+																	44.1_kHz);
+			cascade.setStage(stage,
+							 BiQuadFilter<FloatType>::MakeLowpass(frequency,
+																  narrow_cast<FloatType>(0.7),
+																  44.1_kHz));
+		}
+
+		auto processReference = [&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				auto x = input.at(i);
+				for(auto& stage : stages) {
+					x = stage.process(x);
+				}
+				referenceOutput.at(i) = x;
+			}
+		};
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+
+		auto referenceNanos = benchmarkNanoseconds([&]() {
+			processReference();
+			doNotOptimize(referenceOutput.back());
+		});
+		auto cascadeNanos = benchmarkNanoseconds([&]() {
+			cascade.process(inputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+
+		auto blockSize = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("std::vector<BiQuadFilter<" + typeName + ">> x 8, per-sample walk",
+						referenceNanos / blockSize);
+		reportBenchmark("BiQuadCascade<" + typeName + ", 8>", cascadeNanos / blockSize);
+	}
+
+	TEST(BiQuadCascadeBench, processFloat) {
+		benchmarkBiQuadCascade<float>("float");
+	}
+
+	TEST(BiQuadCascadeBench, processDouble) {
+		benchmarkBiQuadCascade<double>("double");
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "../BiQuadCascade.h"
+#include "FilterTestSignals.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Checks a `BiQuadCascade` matches its stages applied one after another, per sample
+	template<typename FloatType>
+	inline auto checkBiQuadCascade() -> void {
+		constexpr size_t size = 512;
+		constexpr size_t numStages = 8;
+		auto input = std::vector<FloatType>(size);
+		auto output = std::vector<FloatType>(size);
+		fillWithNoise(input);
+
+		auto stages = std::vector<BiQuadFilter<FloatType>>(numStages);
+		auto cascade = BiQuadCascade<FloatType, numStages>();
+		cascade.setNumStages(numStages);
+		for(auto stage = 0U; stage < numStages; ++stage) {
+			auto frequency = Hertz(1000.0 + 250.0 * static_cast<double>(stage));
+			stages.at(stage) = BiQuadFilter<FloatType>::MakeLowpass(frequency,
+																	narrow_cast<FloatType>(0.7),
+																	44.1_kHz);
+			cascade.setStage(stage,
+							 BiQuadFilter<FloatType>::MakeLowpass(frequency,
+																  narrow_cast<FloatType>(0.7),
+																  44.1_kHz));
+		}
+
+		cascade.process(Span<const FloatType>::MakeSpan(input.data(), input.size()),
+						Span<FloatType>::MakeSpan(output.data(), output.size()));
+		for(auto i = 0U; i < size; ++i) {
+			auto x = input.at(i);
+			for(auto& stage : stages) {
+				x = stage.process(x);
+			}
+			ASSERT_NEAR(output.at(i), x, 0.00001);
+		}
+	}
+
+	TEST(BiQuadCascadeTest, matchesStagesFloat) {
+		checkBiQuadCascade<float>();
+	}
+
+	TEST(BiQuadCascadeTest, matchesStagesDouble) {
+		checkBiQuadCascade<double>();
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../BiQuadChunked.h"
+#include "../BiQuadFilter.h"
+#include "BiQuadFilterBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	template<typename FloatType>
+	inline auto benchmarkBiQuadChunked(const std::string& typeName) -> void {
+		// a few seconds of audio, not a multiple of the chunk count
+		constexpr size_t numSamples = 131072 + 37;
+		constexpr size_t bufferSize = 16384;
+		auto input = std::vector<FloatType>(numSamples);
+		auto referenceOutput = std::vector<FloatType>(numSamples);
+		auto output = std::vector<FloatType>(numSamples);
+		fillWithNoise(input);
+
+		auto serial = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+														narrow_cast<FloatType>(0.7),
+														6.0_dB,
+														44.1_kHz);
+		auto chunked = BiQuadChunked<FloatType>(BiQuadFilter<FloatType>::MakeBell(
+			1.0_kHz,
+			narrow_cast<FloatType>(0.7),
+			6.0_dB,
+			44.1_kHz));
+		chunked.setBufferSize(bufferSize);
+
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto referenceSpan
+			= Span<FloatType>::MakeSpan(referenceOutput.data(), referenceOutput.size());
+		auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+
+		auto serialNanos = benchmarkNanoseconds(
+			[&]() {
+				serial.process(inputSpan, referenceSpan);
+				doNotOptimize(referenceOutput.back());
+			},
+			256);
+		auto chunkedNanos = benchmarkNanoseconds(
+			[&]() {
+				chunked.process(inputSpan, outputSpan);
+				doNotOptimize(output.back());
+			},
+			256);
+
+		auto size = static_cast<double>(numSamples);
+		reportBenchmark("BiQuadFilter<" + typeName + "> serial, offline buffer",
+						serialNanos / size);
+		reportBenchmark("BiQuadChunked<" + typeName + ", 8>, offline buffer",
+						chunkedNanos / size);
+	}
+
+	TEST(BiQuadChunkedBench, processFloat) {
+		benchmarkBiQuadChunked<float>("float");
+	}
+
+	TEST(BiQuadChunkedBench, processDouble) {
+		benchmarkBiQuadChunked<double>("double");
+	}
+} // namespace apex::dsp::test
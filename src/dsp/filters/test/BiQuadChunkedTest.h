@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../BiQuadChunked.h"
+#include "../BiQuadFilter.h"
+#include "FilterTestSignals.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Checks a `BiQuadChunked` stays within its tolerance of a serial `BiQuadFilter`
+	/// over a long buffer, processed in two calls
+	template<typename FloatType>
+	inline auto checkBiQuadChunked() -> void {
+		// a few seconds of audio, not a multiple of the chunk count, processed in two calls
+		constexpr size_t numSamples = 131072 + 37;
+		constexpr size_t firstCall = 50000;
+		constexpr size_t bufferSize = 16384;
+		auto input = std::vector<FloatType>(numSamples);
+		auto referenceOutput = std::vector<FloatType>(numSamples);
+		auto output = std::vector<FloatType>(numSamples);
+		fillWithNoise(input);
+
+		auto serial = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+														narrow_cast<FloatType>(0.7),
+														6.0_dB,
+														44.1_kHz);
+		auto chunked = BiQuadChunked<FloatType>(BiQuadFilter<FloatType>::MakeBell(
+			1.0_kHz,
+			narrow_cast<FloatType>(0.7),
+			6.0_dB,
+			44.1_kHz));
+		chunked.setBufferSize(bufferSize);
+
+		serial.process(Span<const FloatType>::MakeSpan(input.data(), input.size()),
+					   Span<FloatType>::MakeSpan(referenceOutput.data(), referenceOutput.size()));
+		chunked.process(Span<const FloatType>::MakeSpan(input.data(), firstCall),
+						Span<FloatType>::MakeSpan(output.data(), firstCall));
+		chunked.process(
+			Span<const FloatType>::MakeSpan(&input.at(firstCall), numSamples - firstCall),
+			Span<FloatType>::MakeSpan(&output.at(firstCall), numSamples - firstCall));
+
+		auto peak = narrow_cast<FloatType>(0.0);
+		for(auto sample : referenceOutput) {
+			peak = std::max(peak, std::abs(sample));
+		}
+		const auto tolerance = BiQuadChunked<FloatType>::TOLERANCE * peak;
+		for(auto i = 0U; i < numSamples; ++i) {
+			ASSERT_NEAR(output.at(i), referenceOutput.at(i), tolerance);
+		}
+	}
+
+	TEST(BiQuadChunkedTest, matchesSerialFloat) {
+		checkBiQuadChunked<float>();
+	}
+
+	TEST(BiQuadChunkedTest, matchesSerialDouble) {
+		checkBiQuadChunked<double>();
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../BiQuadFilter.h"
+#include "FilterTestSignals.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+	using apex::test::BENCHMARK_BLOCK_SIZE;
+	using apex::test::benchmarkNanoseconds;
+	using apex::test::doNotOptimize;
+	using apex::test::reportBenchmark;
+
+	/// @brief Reproduces the previous `BiQuadFilter` processing path: Direct Form I, dividing
+	/// every coefficient by a0 on every sample, walking the block through `Span::at`
+	template<typename FloatType>
+	class DirectFormOneReference {
+	  public:
+		DirectFormOneReference(double frequency, double q, double gainDB, double sampleRate) {
+			auto w0 = 2.0 * 3.14159265358979323846 * frequency / sampleRate;
+			auto a = std::pow(10.0, gainDB / 40.0);
+			auto alpha = std::sin(w0) / (2.0 * q);
+			mB0 = static_cast<FloatType>(1.0 + alpha * a);
+			mB1 = static_cast<FloatType>(-2.0 * std::cos(w0));
+			mB2 = static_cast<FloatType>(1.0 - alpha * a);
+			mA0 = static_cast<FloatType>(1.0 + alpha / a);
+			mA1 = mB1;
+			mA2 = static_cast<FloatType>(1.0 - alpha / a);
+		}
+
+		[[nodiscard]] inline auto process(FloatType input) noexcept -> FloatType {
+			auto yn = input * mB0 / mA0 + mX1 * mB1 / mA0 + mX2 * mB2 / mA0 - mY1 * mA1 / mA0
+					  - mY2 * mA2 / mA0;
+
+			mX2 = mX1;
+			mX1 = input;
+			mY2 = mY1;
+			mY1 = yn;
+
+			return yn;
+		}
+
+		inline auto process(Span<FloatType> input, Span<FloatType> output) noexcept -> void {
+			auto size = input.size();
+			for(auto i = 0U; i < size; ++i) {
+				output.at(i) = process(input.at(i));
+			}
+		}
+
+	  private:
+		FloatType mB0 = static_cast<FloatType>(0.0);
+		FloatType mB1 = static_cast<FloatType>(0.0);
+		FloatType mB2 = static_cast<FloatType>(0.0);
+		FloatType mA0 = static_cast<FloatType>(0.0);
+		FloatType mA1 = static_cast<FloatType>(0.0);
+		FloatType mA2 = static_cast<FloatType>(0.0);
+		FloatType mX1 = static_cast<FloatType>(0.0);
+		FloatType mX2 = static_cast<FloatType>(0.0);
+		FloatType mY1 = static_cast<FloatType>(0.0);
+		FloatType mY2 = static_cast<FloatType>(0.0);
+	};
+
+	template<typename FloatType>
+	inline auto benchmarkBiQuadFilter(const std::string& typeName) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto referenceOutput = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+
+		auto reference = DirectFormOneReference<FloatType>(1000.0, 0.7, 6.0, 44100.0);
+		auto filter = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+														narrow_cast<FloatType>(0.7),
+														6.0_dB,
+														44.1_kHz);
+
+		// the two paths should produce the same response before we compare their speed
+		auto inputSpan = Span<FloatType>::MakeSpan(input.data(), input.size());
+		auto constInputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto referenceSpan
+			= Span<FloatType>::MakeSpan(referenceOutput.data(), referenceOutput.size());
+		auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+		reference.process(inputSpan, referenceSpan);
+		filter.process(constInputSpan, outputSpan);
+		for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+			ASSERT_NEAR(output.at(i), referenceOutput.at(i), 0.001);
+		}
+
+		auto referenceNanos = benchmarkNanoseconds([&]() {
+			reference.process(inputSpan, referenceSpan);
+			doNotOptimize(referenceOutput.back());
+		});
+		auto scalarNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				output.at(i) = filter.process(input.at(i));
+			}
+			doNotOptimize(output.back());
+		});
+		auto blockNanos = benchmarkNanoseconds([&]() {
+			filter.process(constInputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+
+		auto blockSize = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("BiQuadFilter<" + typeName + "> before: DF-I, per-sample a0 divide",
+						referenceNanos / blockSize);
+		reportBenchmark("BiQuadFilter<" + typeName + "> after: scalar TDF-II",
+						scalarNanos / blockSize);
+		reportBenchmark("BiQuadFilter<" + typeName + "> after: block TDF-II",
+						blockNanos / blockSize);
+	}
+
+	template<typename FloatType>
+	inline auto benchmarkBiQuadFilterAutomation(const std::string& typeName) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto referenceOutput = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+
+		auto immediate = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+														   narrow_cast<FloatType>(0.7),
+														   6.0_dB,
+														   44.1_kHz);
+		auto deferred = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+														  narrow_cast<FloatType>(0.7),
+														  6.0_dB,
+														  44.1_kHz);
+		deferred.setDeferredUpdates(true);
+
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto referenceSpan
+			= Span<FloatType>::MakeSpan(referenceOutput.data(), referenceOutput.size());
+		auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+
+		// a host automating frequency, Q and gain together, once per block
+		auto block = 0U;
+		auto automate = [&](BiQuadFilter<FloatType>& filter, Span<FloatType> out) {
+			auto step = static_cast<double>(block % 64U);
+			filter.setFrequency(Hertz(1000.0 + 10.0 * step));
+			filter.setQ(narrow_cast<FloatType>(0.7 + 0.01 * step));
+			filter.setGainDB(Decibels(6.0 - 0.1 * step));
+			filter.process(inputSpan, out);
+		};
+
+		for(block = 0U; block < 4U; ++block) {
+			automate(immediate, referenceSpan);
+			automate(deferred, outputSpan);
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				ASSERT_EQ(output.at(i), referenceOutput.at(i));
+			}
+		}
+
+		auto immediateNanos = benchmarkNanoseconds([&]() {
+			automate(immediate, referenceSpan);
+			++block;
+			doNotOptimize(referenceOutput.back());
+		});
+		auto deferredNanos = benchmarkNanoseconds([&]() {
+			automate(deferred, outputSpan);
+			++block;
+			doNotOptimize(output.back());
+		});
+
+		auto blockSize = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("BiQuadFilter<" + typeName + "> automated, immediate updates",
+						immediateNanos / blockSize);
+		reportBenchmark("BiQuadFilter<" + typeName + "> automated, deferred updates",
+						deferredNanos / blockSize);
+	}
+
+	/// @brief Compares the cost of calculating the bilinear and magnitude-matched designs
+	template<typename FloatType>
+	inline auto benchmarkMatchedDesigns(const std::string& typeName) -> void {
+		auto design = 0U;
+		auto designWith = [&](DesignMethod method) {
+			++design;
+			const auto frequency = Hertz(1000.0 + static_cast<double>(design % 64U) * 100.0);
+			doNotOptimize(BiQuadFilter<FloatType>::calculateDesign(FilterType::Bell,
+																   frequency,
+																   narrow_cast<FloatType>(0.7),
+																   9.0_dB,
+																   44.1_kHz,
+																   method)
+							  .coefficients.b0);
+		};
+		auto bilinearNanos = benchmarkNanoseconds([&]() { designWith(DesignMethod::Bilinear); });
+		auto matchedNanos
+			= benchmarkNanoseconds([&]() { designWith(DesignMethod::MagnitudeMatched); });
+
+		auto unit = std::string("design");
+		reportBenchmark("BiQuadFilter<" + typeName + "> bilinear bell design", bilinearNanos, unit);
+		reportBenchmark("BiQuadFilter<" + typeName + "> magnitude-matched bell design",
+						matchedNanos,
+						unit);
+	}
+
+	TEST(BiQuadFilterBench, processFloat) {
+		benchmarkBiQuadFilter<float>("float");
+	}
+
+	TEST(BiQuadFilterBench, processDouble) {
+		benchmarkBiQuadFilter<double>("double");
+	}
+
+	TEST(BiQuadFilterBench, automationFloat) {
+		benchmarkBiQuadFilterAutomation<float>("float");
+	}
+
+	TEST(BiQuadFilterBench, automationDouble) {
+		benchmarkBiQuadFilterAutomation<double>("double");
+	}
+
+	TEST(BiQuadFilterBench, matchedDesignsFloat) {
+		benchmarkMatchedDesigns<float>("float");
+	}
+
+	TEST(BiQuadFilterBench, matchedDesignsDouble) {
+		benchmarkMatchedDesigns<double>("double");
+	}
+} // namespace apex::dsp::test
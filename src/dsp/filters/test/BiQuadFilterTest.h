@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+
+#include "../BiQuadFilter.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// The largest deviation, in Decibels, from the analog prototype allowed for the
+	/// magnitude-matched bell designs, anywhere up to Nyquist
+	constexpr double MAX_MATCHED_BELL_DEVIATION = 1.25;
+
+	/// @brief Returns the magnitude response of the analog prototype (as given by the RBJ
+	/// cookbook) of a filter with the given parameters
+	inline auto analogMagnitude(FilterType type,
+								double frequency,
+								double filterFrequency,
+								double q,
+								double gainDB) -> double {
+		const auto a = std::pow(10.0, gainDB / 40.0);
+		const auto alpha = std::sqrt(a) / q;
+		const auto s = std::complex<double>(0.0, frequency / filterFrequency);
+		const auto s2 = s * s;
+		auto response = std::complex<double>(1.0, 0.0);
+		switch(type) {
+			case FilterType::Lowpass: response = 1.0 / (s2 + s / q + 1.0); break;
+			case FilterType::Highpass: response = s2 / (s2 + s / q + 1.0); break;
+			case FilterType::Bandpass: response = (s / q) / (s2 + s / q + 1.0); break;
+			case FilterType::Notch: response = (s2 + 1.0) / (s2 + s / q + 1.0); break;
+			case FilterType::LowShelf:
+				response = a * (s2 + alpha * s + a) / (a * s2 + alpha * s + 1.0);
+				break;
+			case FilterType::HighShelf:
+				response = a * (a * s2 + alpha * s + 1.0) / (s2 + alpha * s + a);
+				break;
+			case FilterType::Bell:
+				response = (s2 + s * a / q + 1.0) / (s2 + s / (a * q) + 1.0);
+				break;
+			case FilterType::AnalogBell:
+				response = (s2 + s / q + 1.0) / (s2 + s / (a * a * q) + 1.0);
+				break;
+			default: break;
+		}
+		return std::abs(response);
+	}
+
+	/// @brief Returns the magnitude response of the given coefficients at the given frequency
+	template<typename FloatType>
+	inline auto digitalMagnitude(const BiQuadCoefficients<FloatType>& coefficients,
+								 double frequency,
+								 double sampleRate) -> double {
+		const auto z = std::polar(1.0, -2.0 * 3.14159265358979323846 * frequency / sampleRate);
+		const auto numerator = static_cast<double>(coefficients.b0)
+							   + static_cast<double>(coefficients.b1) * z
+							   + static_cast<double>(coefficients.b2) * z * z;
+		const auto denominator = 1.0 + static_cast<double>(coefficients.a1) * z
+								 + static_cast<double>(coefficients.a2) * z * z;
+		return std::abs(numerator / denominator);
+	}
+
+	/// @brief Returns the largest deviation, in Decibels, of the given design from its analog
+	/// prototype between 20Hz and just below Nyquist. Where the prototype is close to silent
+	/// (the bottom of a notch, the stopband of a lowpass) the deviation is measured linearly
+	template<typename FloatType>
+	inline auto maxAnalogDeviation(const BiQuadDesign<FloatType>& design) -> double {
+		constexpr size_t numPoints = 512;
+		const auto sampleRate = static_cast<double>(design.sampleRate);
+		const auto highest = sampleRate * 0.499;
+		auto deviation = 0.0;
+		for(auto i = 0U; i < numPoints; ++i) {
+			const auto position = static_cast<double>(i) / static_cast<double>(numPoints - 1);
+			const auto frequency = 20.0 * std::pow(highest / 20.0, position);
+			const auto analog = analogMagnitude(design.type,
+												frequency,
+												static_cast<double>(design.frequency),
+												static_cast<double>(design.q),
+												static_cast<double>(design.gain));
+			const auto digital = digitalMagnitude(design.coefficients, frequency, sampleRate);
+			if(analog > 0.05) {
+				deviation = std::max(deviation, std::abs(20.0 * std::log10(digital / analog)));
+			}
+			else {
+				deviation = std::max(deviation, std::abs(digital - analog) * 20.0);
+			}
+		}
+		return deviation;
+	}
+
+	/// @brief Checks that the magnitude-matched designs follow their analog prototypes up to
+	/// Nyquist at least as closely as the bilinear ones, which cramp
+	template<typename FloatType>
+	inline auto checkMatchedDesigns() -> void {
+		constexpr auto types = std::array<FilterType, 8>{FilterType::Lowpass,
+														 FilterType::Highpass,
+														 FilterType::Bandpass,
+														 FilterType::Notch,
+														 FilterType::LowShelf,
+														 FilterType::HighShelf,
+														 FilterType::Bell,
+														 FilterType::AnalogBell};
+		constexpr auto frequencies = std::array<double, 4>{100.0, 1000.0, 10000.0, 16000.0};
+		constexpr auto qs = std::array<double, 3>{0.5, 0.7, 2.0};
+		for(auto type : types) {
+			for(auto frequency : frequencies) {
+				for(auto q : qs) {
+					const auto bilinear
+						= BiQuadFilter<FloatType>::calculateDesign(type,
+																   Hertz(frequency),
+																   narrow_cast<FloatType>(q),
+																   9.0_dB,
+																   44.1_kHz);
+					const auto matched
+						= BiQuadFilter<FloatType>::calculateDesign(type,
+																   Hertz(frequency),
+																   narrow_cast<FloatType>(q),
+																   9.0_dB,
+																   44.1_kHz,
+																   DesignMethod::MagnitudeMatched);
+					const auto matchedDeviation = maxAnalogDeviation(matched);
+					// at low frequencies both are only limited by the precision of the
+					// coefficients
+					ASSERT_LE(matchedDeviation, maxAnalogDeviation(bilinear) + 0.05)
+						<< "type " << static_cast<int>(type) << ", " << frequency << "Hz, Q " << q;
+					// bells are what EQs spend most of their time near Nyquist with
+					if(type == FilterType::Bell || type == FilterType::AnalogBell) {
+						ASSERT_LT(matchedDeviation, MAX_MATCHED_BELL_DEVIATION)
+							<< frequency << "Hz, Q " << q;
+					}
+				}
+			}
+		}
+	}
+
+	TEST(BiQuadFilterTest, matchedDesignsFloat) {
+		checkMatchedDesigns<float>();
+	}
+
+	TEST(BiQuadFilterTest, matchedDesignsDouble) {
+		checkMatchedDesigns<double>();
+	}
+} // namespace apex::dsp::test
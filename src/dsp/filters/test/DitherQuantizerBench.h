@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../Dither.h"
+#include "../DitherQuantizer.h"
+#include "BiQuadFilterBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Times `DitherQuantizer` and `Dither`'s block path with each noise shaping profile
+	inline auto benchmarkNoiseShapingProfiles() -> void {
+		auto left = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		auto right = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(left);
+		fillWithNoise(right);
+		const auto inputs = std::array<Span<const float>, 2>{
+			Span<const float>::MakeSpan(left.data(), left.size()),
+			Span<const float>::MakeSpan(right.data(), right.size())};
+		const auto inputSpan = Span<const Span<const float>>::MakeSpan(inputs.data(), 2);
+		auto quantizer = DitherQuantizer<float>(PCMFormat::Int24);
+		quantizer.prepare(2);
+		auto output = std::vector<std::byte>(quantizer.getRequiredBytes(BENCHMARK_BLOCK_SIZE));
+		auto outputSpan = Span<std::byte>::MakeSpan(output.data(), output.size());
+		auto dither = Dither<float>(24);
+		auto dithered = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		auto ditheredSpan = Span<float>::MakeSpan(dithered.data(), dithered.size());
+
+		const auto profiles = std::array<std::pair<NoiseShapingProfile, std::string>, 6>{
+			std::pair<NoiseShapingProfile, std::string>{NoiseShapingProfile::Simple, "simple"},
+			{NoiseShapingProfile::FWeighted3, "F-weighted 3"},
+			{NoiseShapingProfile::FWeighted5, "F-weighted 5"},
+			{NoiseShapingProfile::FWeighted9, "F-weighted 9"},
+			{NoiseShapingProfile::ModifiedEWeighted9, "modified E-weighted 9"},
+			{NoiseShapingProfile::ImprovedEWeighted9, "improved E-weighted 9"}};
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		for(const auto& [profile, name] : profiles) {
+			quantizer.setNoiseShapingProfile(profile);
+			dither.setNoiseShapingProfile(profile);
+			auto quantizerNanos = benchmarkNanoseconds([&]() {
+				quantizer.quantize(inputSpan, outputSpan);
+				doNotOptimize(output.back());
+			});
+			auto singleNanos = benchmarkNanoseconds([&]() {
+				for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+					dithered.at(i) = dither.dither(left.at(i));
+				}
+				doNotOptimize(dithered.back());
+			});
+			auto blockNanos = benchmarkNanoseconds([&]() {
+				dither.dither(inputs.at(0), ditheredSpan);
+				doNotOptimize(dithered.back());
+			});
+			reportBenchmark("DitherQuantizer<float> " + name + ", stereo", quantizerNanos / size);
+			reportBenchmark("Dither<float> " + name + ", per sample", singleNanos / size);
+			reportBenchmark("Dither<float> " + name + ", block", blockNanos / size);
+		}
+	}
+
+	template<typename FloatType>
+	inline auto benchmarkDitherQuantizer(const std::string& typeName) -> void {
+		auto left = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto right = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(left);
+		fillWithNoise(right);
+		for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+			left.at(i) *= static_cast<FloatType>(0.5);
+			right.at(i) *= static_cast<FloatType>(0.5);
+		}
+		const auto inputs = std::array<Span<const FloatType>, 2>{
+			Span<const FloatType>::MakeSpan(left.data(), left.size()),
+			Span<const FloatType>::MakeSpan(right.data(), right.size())};
+		const auto inputSpan
+			= Span<const Span<const FloatType>>::MakeSpan(inputs.data(), inputs.size());
+
+		auto quantizer = DitherQuantizer<FloatType>(PCMFormat::Int24);
+		quantizer.prepare(2);
+		auto output = std::vector<std::byte>(quantizer.getRequiredBytes(BENCHMARK_BLOCK_SIZE));
+		auto outputSpan = Span<std::byte>::MakeSpan(output.data(), output.size());
+
+		// the previous way: `Dither` one sample at a time, then a second pass converting the
+		// dithered floats to packed integers
+		auto dithers = std::array<Dither<FloatType>, 2>{Dither<FloatType>(24),
+														Dither<FloatType>(24)};
+		auto dithered = std::array<std::vector<FloatType>, 2>{
+			std::vector<FloatType>(BENCHMARK_BLOCK_SIZE),
+			std::vector<FloatType>(BENCHMARK_BLOCK_SIZE)};
+		const auto sources = std::array<const std::vector<FloatType>*, 2>{&left, &right};
+		auto referenceNanos = benchmarkNanoseconds([&]() {
+			for(auto channel = 0U; channel < 2; ++channel) {
+				for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+					dithered.at(channel).at(i)
+						= dithers.at(channel).dither(sources.at(channel)->at(i));
+				}
+			}
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				for(auto channel = 0U; channel < 2; ++channel) {
+					const auto scaled = std::round(static_cast<double>(dithered.at(channel).at(i))
+												   * 8388608.0);
+					const auto value = static_cast<uint32_t>(
+						static_cast<int32_t>(std::clamp(scaled, -8388608.0, 8388607.0)));
+					for(auto byte = 0U; byte < 3; ++byte) {
+						output.at((i * 2 + channel) * 3 + byte)
+							= static_cast<std::byte>((value >> (8U * byte)) & 0xFFU);
+					}
+				}
+			}
+			doNotOptimize(output.back());
+		});
+		auto quantizerNanos = benchmarkNanoseconds([&]() {
+			quantizer.quantize(inputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("Dither<" + typeName + "> + convert, stereo 24 bit", referenceNanos / size);
+		reportBenchmark("DitherQuantizer<" + typeName + ">, stereo 24 bit", quantizerNanos / size);
+	}
+
+	TEST(DitherQuantizerBench, noiseShapingProfiles) {
+		benchmarkNoiseShapingProfiles();
+	}
+
+	TEST(DitherQuantizerBench, stereoFloat) {
+		benchmarkDitherQuantizer<float>("float");
+	}
+
+	TEST(DitherQuantizerBench, stereoDouble) {
+		benchmarkDitherQuantizer<double>("double");
+	}
+} // namespace apex::dsp::test
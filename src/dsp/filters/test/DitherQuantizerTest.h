@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../Dither.h"
+#include "../DitherQuantizer.h"
+#include "FilterTestSignals.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// The number of samples making up a block in the checks below
+	constexpr size_t DITHER_TEST_BLOCK_SIZE = 512;
+
+	/// @brief Reads the packed little-endian signed integer sample starting at `offset`
+	inline auto decodeSample(const std::vector<std::byte>& bytes,
+							 size_t offset,
+							 size_t bytesPerSample) noexcept -> int64_t {
+		auto value = static_cast<uint64_t>(0);
+		for(auto byte = 0U; byte < bytesPerSample; ++byte) {
+			value |= static_cast<uint64_t>(bytes.at(offset + byte)) << (8U * byte);
+		}
+		// sign extend from the top bit of the sample
+		const auto signBit = static_cast<uint64_t>(1) << (8U * bytesPerSample - 1U);
+		return static_cast<int64_t>(value ^ signBit) - static_cast<int64_t>(signBit);
+	}
+
+	template<typename FloatType>
+	inline auto checkDitherQuantizer(PCMFormat format) -> void {
+		constexpr size_t length = 4 * DITHER_TEST_BLOCK_SIZE;
+		constexpr auto pi = 3.14159265358979323846;
+		auto left = std::vector<FloatType>(length);
+		auto right = std::vector<FloatType>(length);
+		for(auto i = 0U; i < length; ++i) {
+			left.at(i) = static_cast<FloatType>(0.7 * std::sin(2.0 * pi * 1000.0 * i / 44100.0));
+			right.at(i) = static_cast<FloatType>(0.3 * std::sin(2.0 * pi * 700.0 * i / 44100.0));
+		}
+		// clipping in both directions, and the extremes of the range
+		left.at(0) = static_cast<FloatType>(1.5);
+		left.at(1) = static_cast<FloatType>(-1.5);
+		right.at(0) = static_cast<FloatType>(1.0);
+		right.at(1) = static_cast<FloatType>(-1.0);
+		const auto inputs = std::array<Span<const FloatType>, 2>{
+			Span<const FloatType>::MakeSpan(left.data(), length),
+			Span<const FloatType>::MakeSpan(right.data(), length)};
+		const auto inputSpan
+			= Span<const Span<const FloatType>>::MakeSpan(inputs.data(), inputs.size());
+
+		auto quantizer = DitherQuantizer<FloatType>(format, PCMLayout::Interleaved);
+		quantizer.prepare(2);
+		const auto bytesPerSample = quantizer.getBytesPerSample();
+		auto interleaved = std::vector<std::byte>(quantizer.getRequiredBytes(length));
+		auto planar = std::vector<std::byte>(quantizer.getRequiredBytes(length));
+		ASSERT_EQ(interleaved.size(), length * 2 * bytesPerSample);
+
+		// quantize in uneven blocks, to cross the chunk boundaries at different places
+		for(size_t offset = 0; offset < length;) {
+			const auto size = General<size_t>::min(offset % 3 == 0 ? 100 : 37, length - offset);
+			const auto blockInputs = std::array<Span<const FloatType>, 2>{
+				Span<const FloatType>::MakeSpan(&left.at(offset), size),
+				Span<const FloatType>::MakeSpan(&right.at(offset), size)};
+			quantizer.quantize(
+				Span<const Span<const FloatType>>::MakeSpan(blockInputs.data(), blockInputs.size()),
+				Span<std::byte>::MakeSpan(&interleaved.at(offset * 2 * bytesPerSample),
+										  size * 2 * bytesPerSample));
+			offset += size;
+		}
+		quantizer.reset();
+		quantizer.setLayout(PCMLayout::Planar);
+		quantizer.quantize(inputSpan, Span<std::byte>::MakeSpan(planar.data(), planar.size()));
+
+		const auto wordLength = std::pow(2.0, static_cast<double>(quantizer.getNumBits() - 1));
+		const auto highest = static_cast<int64_t>(wordLength) - 1;
+		const auto lowest = -static_cast<int64_t>(wordLength);
+		ASSERT_EQ(decodeSample(interleaved, 0, bytesPerSample), highest);
+		ASSERT_EQ(decodeSample(interleaved, bytesPerSample * 2, bytesPerSample), lowest);
+		// full scale is in range, but can be dithered a step or two towards zero
+		ASSERT_NEAR(static_cast<double>(decodeSample(interleaved, bytesPerSample, bytesPerSample)),
+					static_cast<double>(highest),
+					2.0);
+		ASSERT_NEAR(
+			static_cast<double>(decodeSample(interleaved, bytesPerSample * 3, bytesPerSample)),
+			static_cast<double>(lowest),
+			2.0);
+		// little-endian, so the most significant byte of the clipped maximum comes last
+		ASSERT_EQ(interleaved.at(bytesPerSample - 1), std::byte{0x7F});
+		ASSERT_EQ(interleaved.at(0), std::byte{0xFF});
+
+		for(auto i = 2U; i < length; ++i) {
+			const auto leftValue
+				= decodeSample(interleaved, i * 2 * bytesPerSample, bytesPerSample);
+			const auto rightValue
+				= decodeSample(interleaved, (i * 2 + 1) * bytesPerSample, bytesPerSample);
+			// the layout doesn't change the values
+			ASSERT_EQ(leftValue, decodeSample(planar, i * bytesPerSample, bytesPerSample));
+			ASSERT_EQ(rightValue,
+					  decodeSample(planar, (length + i) * bytesPerSample, bytesPerSample));
+			// the dither and the shaped error add a few LSBs at most (or a few of the input's
+			// own, when they're bigger)
+			const auto tolerance = std::max(
+				4.0,
+				wordLength * static_cast<double>(std::numeric_limits<FloatType>::epsilon()) * 4.0);
+			ASSERT_NEAR(static_cast<double>(leftValue),
+						static_cast<double>(left.at(i)) * wordLength,
+						tolerance);
+			ASSERT_NEAR(static_cast<double>(rightValue),
+						static_cast<double>(right.at(i)) * wordLength,
+						tolerance);
+		}
+	}
+
+	/// @brief Checks that the dither is unbiased TPDF noise: without noise shaping, the total
+	/// error of TPDF dithered rounding has zero mean and a variance of 1/4 LSB^2
+	template<typename FloatType>
+	inline auto checkDitherQuantizerNoise() -> void {
+		constexpr size_t length = 64 * DITHER_TEST_BLOCK_SIZE;
+		auto input = std::vector<FloatType>(length);
+		fillWithNoise(input);
+		for(auto& sample : input) {
+			sample *= static_cast<FloatType>(0.01);
+		}
+		const auto inputs = std::array<Span<const FloatType>, 1>{
+			Span<const FloatType>::MakeSpan(input.data(), input.size())};
+		auto quantizer = DitherQuantizer<FloatType>(PCMFormat::Int16,
+													PCMLayout::Interleaved,
+													narrow_cast<FloatType>(0.0));
+		auto output = std::vector<std::byte>(quantizer.getRequiredBytes(length));
+		quantizer.quantize(Span<const Span<const FloatType>>::MakeSpan(inputs.data(), 1),
+						   Span<std::byte>::MakeSpan(output.data(), output.size()));
+
+		auto mean = 0.0;
+		auto meanSquare = 0.0;
+		for(auto i = 0U; i < length; ++i) {
+			const auto error = static_cast<double>(decodeSample(output, i * 2, 2))
+							   - static_cast<double>(input.at(i)) * 32768.0;
+			mean += error;
+			meanSquare += error * error;
+		}
+		mean /= static_cast<double>(length);
+		meanSquare /= static_cast<double>(length);
+		ASSERT_NEAR(mean, 0.0, 0.02);
+		ASSERT_NEAR(meanSquare - mean * mean, 0.25, 0.02);
+	}
+
+	/// @brief Checks that the error of a `DitherQuantizer` with the given profile has the spectrum
+	/// the profile's filter predicts: TPDF dithered rounding adds white noise of 1/4 LSB^2, which
+	/// the error feedback shapes by `1 - sum(h[k] * z^-(k + 1))`. Also checks that `Dither`'s
+	/// block and single-sample paths agree with the profile
+	inline auto checkNoiseShapingSpectrum(NoiseShapingProfile profile) -> void {
+		constexpr size_t segmentSize = 1024;
+		constexpr size_t numSegments = 128;
+		constexpr size_t length = segmentSize * numSegments;
+		constexpr auto pi = 3.14159265358979323846;
+		auto input = std::vector<float>(length);
+		fillWithNoise(input);
+		for(auto& sample : input) {
+			sample *= 0.01F;
+		}
+		const auto inputs
+			= std::array<Span<const float>, 1>{Span<const float>::MakeSpan(input.data(), length)};
+		auto quantizer = DitherQuantizer<float>(PCMFormat::Int16);
+		quantizer.setNoiseShapingProfile(profile);
+		ASSERT_EQ(quantizer.getNoiseShapingProfile(), profile);
+		auto output = std::vector<std::byte>(quantizer.getRequiredBytes(length));
+		quantizer.quantize(Span<const Span<const float>>::MakeSpan(inputs.data(), 1),
+						   Span<std::byte>::MakeSpan(output.data(), output.size()));
+		auto error = std::vector<double>(length);
+		for(auto i = 0U; i < length; ++i) {
+			error.at(i) = static_cast<double>(decodeSample(output, i * 2, 2))
+						  - static_cast<double>(input.at(i)) * 32768.0;
+		}
+
+		auto window = std::vector<double>(segmentSize);
+		auto windowPower = 0.0;
+		for(auto i = 0U; i < segmentSize; ++i) {
+			window.at(i) = 0.5 - 0.5 * std::cos(2.0 * pi * i / segmentSize);
+			windowPower += window.at(i) * window.at(i);
+		}
+		const auto taps = NoiseShapingTaps::forProfile(profile, 0.5);
+		// the notch the weighted profiles put around 4kHz, and the rise towards Nyquist
+		for(auto frequency : {1000.0, 4000.0, 10000.0, 16000.0, 20000.0}) {
+			const auto centre = static_cast<size_t>(frequency * segmentSize / 44100.0 + 0.5);
+			auto measured = 0.0;
+			auto expected = 0.0;
+			for(auto bin = centre - 4; bin <= centre + 4; ++bin) {
+				const auto omega = 2.0 * pi * static_cast<double>(bin) / segmentSize;
+				auto response = std::complex<double>(1.0, 0.0);
+				for(auto tap = 0U; tap < taps.numTaps; ++tap) {
+					response -= taps.taps.at(tap) * std::polar(1.0, -omega * (tap + 1.0));
+				}
+				expected += 0.25 * std::norm(response);
+				for(auto segment = 0U; segment < numSegments; ++segment) {
+					auto value = std::complex<double>(0.0, 0.0);
+					for(auto i = 0U; i < segmentSize; ++i) {
+						value += error.at(segment * segmentSize + i) * window.at(i)
+								 * std::polar(1.0, -omega * i);
+					}
+					measured += std::norm(value) / (windowPower * numSegments);
+				}
+			}
+			ASSERT_NEAR(10.0 * std::log10(measured / expected), 0.0, 1.0);
+		}
+
+		auto dither = Dither<float>(16);
+		dither.setNoiseShapingProfile(profile);
+		auto single = std::vector<float>(DITHER_TEST_BLOCK_SIZE);
+		for(auto i = 0U; i < DITHER_TEST_BLOCK_SIZE; ++i) {
+			single.at(i) = dither.dither(input.at(i));
+		}
+		dither.setNoiseShapingProfile(profile);
+		auto block = std::vector<float>(DITHER_TEST_BLOCK_SIZE);
+		// split unevenly, across the dither refills
+		dither.dither(Span<const float>::MakeSpan(input.data(), 100),
+					  Span<float>::MakeSpan(block.data(), 100));
+		dither.dither(Span<const float>::MakeSpan(&input.at(100), DITHER_TEST_BLOCK_SIZE - 100),
+					  Span<float>::MakeSpan(&block.at(100), DITHER_TEST_BLOCK_SIZE - 100));
+		ASSERT_EQ(single, block);
+	}
+
+	TEST(DitherQuantizerTest, int16Float) {
+		checkDitherQuantizer<float>(PCMFormat::Int16);
+	}
+
+	TEST(DitherQuantizerTest, int24Float) {
+		checkDitherQuantizer<float>(PCMFormat::Int24);
+	}
+
+	TEST(DitherQuantizerTest, int32Double) {
+		checkDitherQuantizer<double>(PCMFormat::Int32);
+	}
+
+	TEST(DitherQuantizerTest, tpdfNoise) {
+		checkDitherQuantizerNoise<float>();
+	}
+
+	TEST(DitherQuantizerTest, simpleSpectrum) {
+		checkNoiseShapingSpectrum(NoiseShapingProfile::Simple);
+	}
+
+	TEST(DitherQuantizerTest, fWeighted3Spectrum) {
+		checkNoiseShapingSpectrum(NoiseShapingProfile::FWeighted3);
+	}
+
+	TEST(DitherQuantizerTest, fWeighted5Spectrum) {
+		checkNoiseShapingSpectrum(NoiseShapingProfile::FWeighted5);
+	}
+
+	TEST(DitherQuantizerTest, fWeighted9Spectrum) {
+		checkNoiseShapingSpectrum(NoiseShapingProfile::FWeighted9);
+	}
+
+	TEST(DitherQuantizerTest, modifiedEWeighted9Spectrum) {
+		checkNoiseShapingSpectrum(NoiseShapingProfile::ModifiedEWeighted9);
+	}
+
+	TEST(DitherQuantizerTest, improvedEWeighted9Spectrum) {
+		checkNoiseShapingSpectrum(NoiseShapingProfile::ImprovedEWeighted9);
+	}
+} // namespace apex::dsp::test
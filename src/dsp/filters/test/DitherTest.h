@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "../Dither.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Dithers `size` samples of silence to 16 bits, returning the results
+	template<typename FloatType>
+	inline auto ditherSilence(Dither<FloatType>& dither, size_t size) -> std::vector<FloatType> {
+		auto output = std::vector<FloatType>(size);
+		for(auto& sample : output) {
+			sample = dither.dither(static_cast<FloatType>(0.0));
+		}
+		return output;
+	}
+
+	/// @brief Returns the correlation of the deviations from their means of `first` and `second`
+	template<typename FloatType>
+	inline auto
+	ditherCorrelation(const std::vector<FloatType>& first, const std::vector<FloatType>& second)
+		-> double {
+		const auto size = static_cast<double>(first.size());
+		auto firstMean = 0.0;
+		auto secondMean = 0.0;
+		for(auto i = 0U; i < first.size(); ++i) {
+			firstMean += static_cast<double>(first.at(i)) / size;
+			secondMean += static_cast<double>(second.at(i)) / size;
+		}
+		auto sum = 0.0;
+		auto firstSquares = 0.0;
+		auto secondSquares = 0.0;
+		for(auto i = 0U; i < first.size(); ++i) {
+			const auto x = static_cast<double>(first.at(i)) - firstMean;
+			const auto y = static_cast<double>(second.at(i)) - secondMean;
+			sum += x * y;
+			firstSquares += x * x;
+			secondSquares += y * y;
+		}
+		return sum / std::sqrt(firstSquares * secondSquares);
+	}
+
+	template<typename FloatType>
+	inline auto checkIndependentInstances() -> void {
+		constexpr size_t size = 1U << 14U;
+		auto left = Dither<FloatType>(16);
+		auto right = Dither<FloatType>(16);
+		ASSERT_NE(left.getSeed(), right.getSeed());
+
+		const auto leftOutput = ditherSilence(left, size);
+		const auto rightOutput = ditherSilence(right, size);
+		ASSERT_NE(leftOutput, rightOutput);
+		ASSERT_LT(std::abs(ditherCorrelation(leftOutput, rightOutput)), 0.05);
+
+		// changing a parameter restarts an instance's own stream, not a shared one
+		const auto seed = left.getSeed();
+		left.setNoiseShaping(static_cast<FloatType>(0.5));
+		ASSERT_EQ(left.getSeed(), seed);
+		ASSERT_EQ(ditherSilence(left, size), leftOutput);
+
+		// and instances given the same seed dither identically
+		right.setSeed(seed);
+		ASSERT_EQ(ditherSilence(right, size), leftOutput);
+	}
+
+	TEST(DitherTest, independentInstancesFloat) {
+		checkIndependentInstances<float>();
+	}
+
+	TEST(DitherTest, independentInstancesDouble) {
+		checkIndependentInstances<double>();
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+
+#include "../../../base/StandardIncludes.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Fills `buffer` with deterministic, full-scale pseudo-random noise
+	template<typename FloatType>
+	inline auto fillWithNoise(std::vector<FloatType>& buffer) noexcept -> void {
+		auto random = math::Random(1234);
+		for(auto& sample : buffer) {
+			sample = static_cast<FloatType>(
+				(static_cast<double>(random.rand()) / static_cast<double>(math::Random::MAX))
+					* 2.0
+				- 1.0);
+		}
+	}
+} // namespace apex::dsp::test
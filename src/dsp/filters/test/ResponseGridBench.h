@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../../processors/EQCurve.h"
+#include "../ResponseGrid.h"
+#include "BiQuadFilterBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	template<typename FloatType>
+	inline auto benchmarkResponseGrid(const std::string& typeName) -> void {
+		constexpr size_t numPoints = 512;
+		constexpr size_t numBands = 8;
+
+		// log-spaced display points from 20Hz to 20kHz
+		auto frequencies = std::vector<Hertz>(numPoints);
+		for(auto i = 0U; i < numPoints; ++i) {
+			const auto position = static_cast<double>(i) / static_cast<double>(numPoints - 1);
+			frequencies.at(i) = Hertz(20.0 * std::pow(1000.0, position));
+		}
+		auto frequencySpan = Span<const Hertz>::MakeSpan(frequencies.data(), frequencies.size());
+
+		constexpr auto types = std::array<BandType, numBands>{BandType::Highpass24DB,
+															  BandType::LowShelf,
+															  BandType::Bell,
+															  BandType::Bell,
+															  BandType::AnalogBell,
+															  BandType::Notch,
+															  BandType::HighShelf,
+															  BandType::Lowpass48DB};
+		auto bands = std::array<EQBand<FloatType>, numBands>();
+		// the per-point evaluation loses too much precision in single precision at low
+		// frequencies to check against, so the accuracy check uses double precision bands
+		auto precise = std::array<EQBand<double>, numBands>();
+		for(auto band = 0U; band < numBands; ++band) {
+			const auto frequency = Hertz(40.0 * std::pow(2.0, static_cast<double>(band)));
+			const auto gain = Decibels(static_cast<double>(band) - 3.0);
+			bands.at(band).setBandType(types.at(band));
+			bands.at(band).setFrequency(frequency);
+			bands.at(band).setQ(narrow_cast<FloatType>(0.9));
+			bands.at(band).setGainDB(gain);
+			precise.at(band).setBandType(types.at(band));
+			precise.at(band).setFrequency(frequency);
+			precise.at(band).setQ(0.9);
+			precise.at(band).setGainDB(gain);
+		}
+
+		auto referenceCurve = std::vector<FloatType>(numPoints);
+		auto bandMagnitudes = std::vector<FloatType>(numPoints);
+		auto referenceSpan = Span<FloatType>::MakeSpan(bandMagnitudes.data(), numPoints);
+		auto curve = EQCurve<FloatType, numBands>(frequencySpan, 44.1_kHz);
+
+		// the previous way: each band evaluated point by point, then multiplied together
+		auto evaluateReference = [&]() {
+			std::fill(referenceCurve.begin(), referenceCurve.end(), narrow_cast<FloatType>(1.0));
+			for(auto& band : bands) {
+				band.getMagnitudesForFrequencies(frequencySpan, referenceSpan);
+				for(auto i = 0U; i < numPoints; ++i) {
+					referenceCurve.at(i) *= bandMagnitudes.at(i);
+				}
+			}
+		};
+
+		auto preciseCurve = std::vector<double>(numPoints, 1.0);
+		auto preciseMagnitudes = std::vector<double>(numPoints);
+		for(auto& band : precise) {
+			band.getMagnitudesForFrequencies(
+				frequencySpan,
+				Span<double>::MakeSpan(preciseMagnitudes.data(), numPoints));
+			for(auto i = 0U; i < numPoints; ++i) {
+				preciseCurve.at(i) *= preciseMagnitudes.at(i);
+			}
+		}
+		for(auto band = 0U; band < numBands; ++band) {
+			curve.updateBand(band, bands.at(band));
+		}
+		auto magnitudes = curve.getMagnitudes();
+		// within 0.05dB, well below what a curve display can resolve, except at the bottom of
+		// the notch, where the single precision coefficients put the zero slightly elsewhere
+		for(auto i = 0U; i < numPoints; ++i) {
+			if(preciseCurve.at(i) > 0.05) {
+				ASSERT_NEAR(
+					20.0 * std::log10(static_cast<double>(magnitudes.at(i)) / preciseCurve.at(i)),
+					0.0,
+					0.05);
+			}
+			else {
+				ASSERT_NEAR(static_cast<double>(magnitudes.at(i)), preciseCurve.at(i), 0.001);
+			}
+		}
+
+		auto referenceNanos = benchmarkNanoseconds(
+			[&]() {
+				evaluateReference();
+				doNotOptimize(referenceCurve.back());
+			},
+			256);
+		// every band changes every frame
+		auto frame = 0U;
+		auto allBandsNanos = benchmarkNanoseconds(
+			[&]() {
+				++frame;
+				for(auto band = 0U; band < numBands; ++band) {
+					bands.at(band).setGainDB(Decibels(static_cast<double>(frame % 12U) - 6.0));
+					curve.updateBand(band, bands.at(band));
+				}
+				doNotOptimize(curve.getMagnitudes().at(numPoints - 1));
+			},
+			256);
+		// one band is being dragged
+		auto oneBandNanos = benchmarkNanoseconds(
+			[&]() {
+				++frame;
+				bands.at(2).setGainDB(Decibels(static_cast<double>(frame % 12U) - 6.0));
+				for(auto band = 0U; band < numBands; ++band) {
+					curve.updateBand(band, bands.at(band));
+				}
+				doNotOptimize(curve.getMagnitudes().at(numPoints - 1));
+			},
+			256);
+
+		auto frameUnit = std::string("frame");
+		reportBenchmark("EQBand<" + typeName + "> x 8 curve, per-point response",
+						referenceNanos,
+						frameUnit);
+		reportBenchmark("EQCurve<" + typeName + ">, every band changed", allBandsNanos, frameUnit);
+		reportBenchmark("EQCurve<" + typeName + ">, one band changed", oneBandNanos, frameUnit);
+	}
+
+	TEST(ResponseGridBench, eqCurveFloat) {
+		benchmarkResponseGrid<float>("float");
+	}
+
+	TEST(ResponseGridBench, eqCurveDouble) {
+		benchmarkResponseGrid<double>("double");
+	}
+} // namespace apex::dsp::test
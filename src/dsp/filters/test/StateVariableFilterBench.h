@@ -0,0 +1,199 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../../processors/EQBand.h"
+#include "../BiQuadFilter.h"
+#include "../ResponseGrid.h"
+#include "../StateVariableFilter.h"
+#include "BiQuadFilterBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Checks that `StateVariableFilter` has the same response as `BiQuadFilter` for
+	/// every filter type they share a design for
+	inline auto checkStateVariableFilterResponses() -> void {
+		constexpr size_t numPoints = 64;
+		auto frequencies = std::vector<Hertz>(numPoints);
+		for(auto i = 0U; i < numPoints; ++i) {
+			const auto position = static_cast<double>(i) / static_cast<double>(numPoints - 1);
+			frequencies.at(i) = Hertz(20.0 * std::pow(1000.0, position));
+		}
+		auto grid = ResponseGrid<double>(
+			Span<const Hertz>::MakeSpan(frequencies.data(), frequencies.size()),
+			44.1_kHz);
+		auto biquadMagnitudes = std::vector<double>(numPoints);
+		auto svfMagnitudes = std::vector<double>(numPoints);
+		auto biquadSpan = Span<double>::MakeSpan(biquadMagnitudes.data(), numPoints);
+		auto svfSpan = Span<double>::MakeSpan(svfMagnitudes.data(), numPoints);
+
+		constexpr auto types = std::array<FilterType, 7>{FilterType::Lowpass,
+														 FilterType::Highpass,
+														 FilterType::Bandpass,
+														 FilterType::Allpass,
+														 FilterType::Notch,
+														 FilterType::Bell,
+														 FilterType::AnalogBell};
+		for(auto type : types) {
+			const auto design
+				= BiQuadFilter<double>::calculateDesign(type, 1.0_kHz, 0.9, 6.0_dB, 44.1_kHz);
+			const auto svf = StateVariableFilter<double>(type, 1.0_kHz, 0.9, 6.0_dB, 44.1_kHz);
+			grid.getMagnitudes(design.coefficients, biquadSpan);
+			svf.getMagnitudesForFrequencies(grid, svfSpan);
+			for(auto i = 0U; i < numPoints; ++i) {
+				ASSERT_NEAR(svfMagnitudes.at(i), biquadMagnitudes.at(i), 1.0e-6);
+			}
+		}
+
+		// shelves are checked against their plateaus: +6dB below (above) the frequency and
+		// unity gain above (below) it
+		const auto plateau = std::pow(10.0, 6.0 / 20.0);
+		const auto lowShelf
+			= StateVariableFilter<double>(FilterType::LowShelf, 1.0_kHz, 0.7, 6.0_dB, 44.1_kHz);
+		const auto highShelf
+			= StateVariableFilter<double>(FilterType::HighShelf, 1.0_kHz, 0.7, 6.0_dB, 44.1_kHz);
+		lowShelf.getMagnitudesForFrequencies(grid, svfSpan);
+		ASSERT_NEAR(svfMagnitudes.front(), plateau, 0.01);
+		ASSERT_NEAR(svfMagnitudes.back(), 1.0, 0.01);
+		highShelf.getMagnitudesForFrequencies(grid, svfSpan);
+		ASSERT_NEAR(svfMagnitudes.front(), 1.0, 0.01);
+		ASSERT_NEAR(svfMagnitudes.back(), plateau, 0.01);
+	}
+
+	/// @brief Checks that the modulated path of `EQBand`, held at the band's frequency, matches
+	/// its unmodulated path
+	template<typename FloatType>
+	inline auto checkEQBandModulation() -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto referenceOutput = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto cutoffs
+			= std::vector<FloatType>(BENCHMARK_BLOCK_SIZE, narrow_cast<FloatType>(800.0));
+		fillWithNoise(input);
+
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto referenceSpan
+			= Span<FloatType>::MakeSpan(referenceOutput.data(), referenceOutput.size());
+		auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+		auto cutoffSpan = Span<const FloatType>::MakeSpan(cutoffs.data(), cutoffs.size());
+
+		constexpr auto types = std::array<BandType, 4>{BandType::Lowpass48DB,
+													   BandType::Highpass24DB,
+													   BandType::Notch,
+													   BandType::Bell};
+		for(auto type : types) {
+			auto band = EQBand<FloatType>(800.0_Hz,
+										  narrow_cast<FloatType>(0.9),
+										  3.0_dB,
+										  44.1_kHz,
+										  type);
+			band.processMono(inputSpan, referenceSpan);
+			band.reset();
+			band.processMono(inputSpan, outputSpan, cutoffSpan);
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				ASSERT_NEAR(output.at(i), referenceOutput.at(i), 0.001);
+			}
+		}
+	}
+
+	template<typename FloatType>
+	inline auto benchmarkStateVariableFilter(const std::string& typeName) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto referenceOutput = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto cutoffs = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto referenceSpan
+			= Span<FloatType>::MakeSpan(referenceOutput.data(), referenceOutput.size());
+		auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+		auto cutoffSpan = Span<const FloatType>::MakeSpan(cutoffs.data(), cutoffs.size());
+
+		// unmodulated, the two filters should produce the same output
+		auto biquad = BiQuadFilter<FloatType>::MakeBell(1.0_kHz,
+														narrow_cast<FloatType>(0.7),
+														6.0_dB,
+														44.1_kHz);
+		auto svf = StateVariableFilter<FloatType>(FilterType::Bell,
+												  1.0_kHz,
+												  narrow_cast<FloatType>(0.7),
+												  6.0_dB,
+												  44.1_kHz);
+		biquad.process(inputSpan, referenceSpan);
+		svf.process(inputSpan, outputSpan);
+		for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+			ASSERT_NEAR(output.at(i), referenceOutput.at(i), 0.001);
+		}
+
+		// an envelope sweeping the frequency between 200Hz and 5kHz every block
+		for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+			const auto phase = static_cast<double>(i) / static_cast<double>(BENCHMARK_BLOCK_SIZE);
+			cutoffs.at(i) = static_cast<FloatType>(
+				200.0 * std::pow(25.0, 0.5 - 0.5 * std::cos(6.283185307179586 * phase)));
+		}
+
+		// modulated, the filter should stay stable
+		for(auto block = 0U; block < 64U; ++block) {
+			svf.process(inputSpan, outputSpan, cutoffSpan);
+		}
+		for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+			ASSERT_TRUE(std::isfinite(output.at(i)));
+			ASSERT_LT(std::abs(output.at(i)), static_cast<FloatType>(8.0));
+		}
+
+		auto biquadNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				biquad.setFrequency(Hertz(static_cast<double>(cutoffs.at(i))));
+				referenceOutput.at(i) = biquad.process(input.at(i));
+			}
+			doNotOptimize(referenceOutput.back());
+		});
+		auto scalarNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				svf.setFrequency(Hertz(static_cast<double>(cutoffs.at(i))));
+				output.at(i) = svf.process(input.at(i));
+			}
+			doNotOptimize(output.back());
+		});
+		auto blockNanos = benchmarkNanoseconds([&]() {
+			svf.process(inputSpan, outputSpan, cutoffSpan);
+			doNotOptimize(output.back());
+		});
+		auto staticNanos = benchmarkNanoseconds([&]() {
+			svf.process(inputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+
+		auto blockSize = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("BiQuadFilter<" + typeName + "> modulated per sample",
+						biquadNanos / blockSize);
+		reportBenchmark("StateVariableFilter<" + typeName + "> modulated per sample",
+						scalarNanos / blockSize);
+		reportBenchmark("StateVariableFilter<" + typeName + "> modulated block",
+						blockNanos / blockSize);
+		reportBenchmark("StateVariableFilter<" + typeName + "> unmodulated block",
+						staticNanos / blockSize);
+	}
+
+	TEST(StateVariableFilterBench, responseMatchesBiQuad) {
+		checkStateVariableFilterResponses();
+	}
+
+	TEST(StateVariableFilterBench, eqBandModulationFloat) {
+		checkEQBandModulation<float>();
+	}
+
+	TEST(StateVariableFilterBench, modulatedFloat) {
+		benchmarkStateVariableFilter<float>("float");
+	}
+
+	TEST(StateVariableFilterBench, modulatedDouble) {
+		benchmarkStateVariableFilter<double>("double");
+	}
+} // namespace apex::dsp::test
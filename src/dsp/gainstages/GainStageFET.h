@@ -41,12 +41,11 @@ namespace apex::dsp {
 		/// @param output - The processed output
 		inline auto process(Span<FloatType> input, Span<FloatType> output) noexcept -> void final {
 			jassert(input.size() == output.size());
-			auto size = input.size();
-			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = waveshapers::softSaturation<FloatType>(input.at(i),
-																	  SATURATION_AMOUNT,
-																	  SATURATION_SLOPE);
-			}
+			waveshapers::softSaturation<FloatType>(
+				Span<const FloatType>::MakeSpan(input.data(), input.size()),
+				output,
+				SATURATION_AMOUNT,
+				SATURATION_SLOPE);
 		}
 
 		/// @brief Processes the input according to this `GainStage`'s parameters'
@@ -56,12 +55,10 @@ namespace apex::dsp {
 		inline auto
 		process(Span<const FloatType> input, Span<FloatType> output) noexcept -> void final {
 			jassert(input.size() == output.size());
-			auto size = input.size();
-			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = waveshapers::softSaturation<FloatType>(input.at(i),
-																	  SATURATION_AMOUNT,
-																	  SATURATION_SLOPE);
-			}
+			waveshapers::softSaturation<FloatType>(input,
+												   output,
+												   SATURATION_AMOUNT,
+												   SATURATION_SLOPE);
 		}
 
 		auto operator=(GainStageFET&& stage) noexcept -> GainStageFET& = default;
@@ -6,6 +6,7 @@
 #include <utility>
 
 #include "../../base/StandardIncludes.h"
+#include "../filters/BiQuadBank.h"
 #include "../filters/BiQuadFilter.h"
 #include "../gainstages/GainStage.h"
 #include "../meters/RMSMeter.h"
@@ -28,25 +29,21 @@ namespace apex::dsp {
 		using BiQuadFilter = BiQuadFilter<FloatType>;
 		using GainStage = GainStage<FloatType>;
 		using Processor = Processor<FloatType>;
+		using BiQuadBank = BiQuadBank<FloatType, Processor::MAX_CHANNELS>;
 
 	  public:
 		BaseCompressor() noexcept {
 			auto one = narrow_cast<FloatType>(1.0);
-			for(auto& filt : mSidechainFilter) {
-				filt = BiQuadFilter::MakeHighpass(mSidechainHPFCutoffFreq, one, 44.1_kHz);
-			}
-			for(auto& filt : mSoftLowShelfFilter) {
-				filt = BiQuadFilter::MakeLowShelf(240_Hz, one, -8_dB, 44.1_kHz);
-			}
-			for(auto& filt : mSoftHighShelfFilter) {
-				filt = BiQuadFilter::MakeHighShelf(2.4_kHz, one, 8_dB, 44.1_kHz);
-			}
-			for(auto& filt : mHardLowShelfFilter) {
-				filt = BiQuadFilter::MakeLowShelf(700_Hz, one, -8_dB, 44.1_kHz);
-			}
-			for(auto& filt : mHardHighShelfFilter) {
-				filt = BiQuadFilter::MakeHighShelf(700_Hz, one, 8_dB, 44.1_kHz);
-			}
+			mSidechainFilter
+				= BiQuadBank(BiQuadFilter::MakeHighpass(mSidechainHPFCutoffFreq, one, 44.1_kHz));
+			mSoftLowShelfFilter
+				= BiQuadBank(BiQuadFilter::MakeLowShelf(240_Hz, one, -8_dB, 44.1_kHz));
+			mSoftHighShelfFilter
+				= BiQuadBank(BiQuadFilter::MakeHighShelf(2.4_kHz, one, 8_dB, 44.1_kHz));
+			mHardLowShelfFilter
+				= BiQuadBank(BiQuadFilter::MakeLowShelf(700_Hz, one, -8_dB, 44.1_kHz));
+			mHardHighShelfFilter
+				= BiQuadBank(BiQuadFilter::MakeHighShelf(700_Hz, one, 8_dB, 44.1_kHz));
 		}
 		BaseCompressor(BaseCompressor&& compressor) noexcept = default;
 		~BaseCompressor() noexcept override = default;
@@ -102,21 +99,11 @@ namespace apex::dsp {
 		inline auto reset() noexcept -> void override {
 			mInputMeter.reset();
 			mOutputMeter.reset();
-			for(auto& filt : mSidechainFilter) {
-				filt.reset();
-			}
-			for(auto& filt : mSoftLowShelfFilter) {
-				filt.reset();
-			}
-			for(auto& filt : mSoftHighShelfFilter) {
-				filt.reset();
-			}
-			for(auto& filt : mHardLowShelfFilter) {
-				filt.reset();
-			}
-			for(auto& filt : mHardHighShelfFilter) {
-				filt.reset();
-			}
+			mSidechainFilter.reset();
+			mSoftLowShelfFilter.reset();
+			mSoftHighShelfFilter.reset();
+			mHardLowShelfFilter.reset();
+			mHardHighShelfFilter.reset();
 		}
 
 		[[nodiscard]] inline auto getCurrentGainReduction() const noexcept -> Decibels {
@@ -127,21 +114,11 @@ namespace apex::dsp {
 			mSampleRate = sampleRate;
 			mInputMeter.setSampleRate(sampleRate);
 			mOutputMeter.setSampleRate(sampleRate);
-			for(auto& filt : mSidechainFilter) {
-				filt.setSampleRate(sampleRate);
-			}
-			for(auto& filt : mSoftLowShelfFilter) {
-				filt.setSampleRate(sampleRate);
-			}
-			for(auto& filt : mSoftHighShelfFilter) {
-				filt.setSampleRate(sampleRate);
-			}
-			for(auto& filt : mHardLowShelfFilter) {
-				filt.setSampleRate(sampleRate);
-			}
-			for(auto& filt : mHardHighShelfFilter) {
-				filt.setSampleRate(sampleRate);
-			}
+			mSidechainFilter.setSampleRate(sampleRate);
+			mSoftLowShelfFilter.setSampleRate(sampleRate);
+			mSoftHighShelfFilter.setSampleRate(sampleRate);
+			mHardLowShelfFilter.setSampleRate(sampleRate);
+			mHardHighShelfFilter.setSampleRate(sampleRate);
 		}
 
 		[[nodiscard]] inline auto getSampleRate() const noexcept -> Hertz {
@@ -269,16 +246,11 @@ namespace apex::dsp {
 		std::unique_ptr<GainStage> mOutputStage = std::make_unique<GainStage>();
 		std::array<Decibels, Processor::MAX_CHANNELS> mCompressionGain
 			= std::array<Decibels, Processor::MAX_CHANNELS>();
-		std::array<BiQuadFilter, Processor::MAX_CHANNELS> mSidechainFilter
-			= std::array<BiQuadFilter, Processor::MAX_CHANNELS>();
-		std::array<BiQuadFilter, Processor::MAX_CHANNELS> mSoftLowShelfFilter
-			= std::array<BiQuadFilter, Processor::MAX_CHANNELS>();
-		std::array<BiQuadFilter, Processor::MAX_CHANNELS> mSoftHighShelfFilter
-			= std::array<BiQuadFilter, Processor::MAX_CHANNELS>();
-		std::array<BiQuadFilter, Processor::MAX_CHANNELS> mHardLowShelfFilter
-			= std::array<BiQuadFilter, Processor::MAX_CHANNELS>();
-		std::array<BiQuadFilter, Processor::MAX_CHANNELS> mHardHighShelfFilter
-			= std::array<BiQuadFilter, Processor::MAX_CHANNELS>();
+		BiQuadBank mSidechainFilter = BiQuadBank();
+		BiQuadBank mSoftLowShelfFilter = BiQuadBank();
+		BiQuadBank mSoftHighShelfFilter = BiQuadBank();
+		BiQuadBank mHardLowShelfFilter = BiQuadBank();
+		BiQuadBank mHardHighShelfFilter = BiQuadBank();
 
 	  private:
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BaseCompressor)
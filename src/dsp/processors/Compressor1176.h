@@ -32,19 +32,20 @@ namespace apex::dsp {
 			auto procced = BaseCompressor::mInputStage->process(input);
 			auto sidechain = procced;
 			if(BaseCompressor::mSidechainHPFEnabled) {
-				sidechain = BaseCompressor::mSidechainFilter.at(Processor::MONO).process(sidechain);
+				sidechain
+					= BaseCompressor::mSidechainFilter.processLane(Processor::MONO, sidechain);
 			}
 			if(BaseCompressor::mPreEmphasisMode == SidechainPreEmphasisFilterMode::Soft) {
 				sidechain
-					= BaseCompressor::mSoftLowShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mSoftLowShelfFilter.processLane(Processor::MONO, sidechain);
 				sidechain
-					= BaseCompressor::mSoftHighShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mSoftHighShelfFilter.processLane(Processor::MONO, sidechain);
 			}
 			else if(BaseCompressor::mPreEmphasisMode == SidechainPreEmphasisFilterMode::Hard) {
 				sidechain
-					= BaseCompressor::mHardLowShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mHardLowShelfFilter.processLane(Processor::MONO, sidechain);
 				sidechain
-					= BaseCompressor::mHardHighShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mHardHighShelfFilter.processLane(Processor::MONO, sidechain);
 			}
 			BaseCompressor::mCompressionGain.at(Processor::MONO)
 				= mSidechains.at(Processor::MONO).process(sidechain);
@@ -89,19 +90,20 @@ namespace apex::dsp {
 			auto procced = BaseCompressor::mInputStage->process(input);
 			sidechain = BaseCompressor::mInputStage->process(input);
 			if(BaseCompressor::mSidechainHPFEnabled) {
-				sidechain = BaseCompressor::mSidechainFilter.at(Processor::MONO).process(sidechain);
+				sidechain
+					= BaseCompressor::mSidechainFilter.processLane(Processor::MONO, sidechain);
 			}
 			if(BaseCompressor::mPreEmphasisMode == SidechainPreEmphasisFilterMode::Soft) {
 				sidechain
-					= BaseCompressor::mSoftLowShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mSoftLowShelfFilter.processLane(Processor::MONO, sidechain);
 				sidechain
-					= BaseCompressor::mSoftHighShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mSoftHighShelfFilter.processLane(Processor::MONO, sidechain);
 			}
 			else if(BaseCompressor::mPreEmphasisMode == SidechainPreEmphasisFilterMode::Hard) {
 				sidechain
-					= BaseCompressor::mHardLowShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mHardLowShelfFilter.processLane(Processor::MONO, sidechain);
 				sidechain
-					= BaseCompressor::mHardHighShelfFilter.at(Processor::MONO).process(sidechain);
+					= BaseCompressor::mHardHighShelfFilter.processLane(Processor::MONO, sidechain);
 			}
 			BaseCompressor::mCompressionGain.at(Processor::MONO)
 				= mSidechains.at(Processor::MONO).process(sidechain);
@@ -125,7 +127,7 @@ namespace apex::dsp {
 		inline auto processMonoSidechained(Span<FloatType> input,
 										   Span<FloatType> sidechain,
 										   Span<FloatType> output) noexcept -> void final {
-			jassert(input.size() == sidechain.size() == output.size());
+			jassert(input.size() == sidechain.size() && input.size() == output.size());
 			auto size = input.size();
 			for(auto index = 0U; index < size; ++size) {
 				output.at(index) = processMonoSidechained(input.at(index), sidechain.at(index));
@@ -135,7 +137,7 @@ namespace apex::dsp {
 		inline auto processMonoSidechained(Span<FloatType> input,
 										   Span<const FloatType> sidechain,
 										   Span<FloatType> output) noexcept -> void final {
-			jassert(input.size() == sidechain.size() == output.size());
+			jassert(input.size() == sidechain.size() && input.size() == output.size());
 			auto size = input.size();
 			for(auto index = 0U; index < size; ++size) {
 				output.at(index) = processMonoSidechained(input.at(index), sidechain.at(index));
@@ -145,7 +147,7 @@ namespace apex::dsp {
 		inline auto processMonoSidechained(Span<const FloatType> input,
 										   Span<const FloatType> sidechain,
 										   Span<FloatType> output) noexcept -> void final {
-			jassert(input.size() == sidechain.size() == output.size());
+			jassert(input.size() == sidechain.size() && input.size() == output.size());
 			auto size = input.size();
 			for(auto index = 0U; index < size; ++size) {
 				output.at(index) = processMonoSidechained(input.at(index), sidechain.at(index));
@@ -167,31 +169,20 @@ namespace apex::dsp {
 			Logger::LogMessage("Compressor1176: InputStagedLeft:" + juce::String(proccedLeft)
 							   + " SidechainStagedLeft" + juce::String(sideLeft));
 #endif
+			auto sidechain = std::array<FloatType, Processor::MAX_CHANNELS>({sideLeft, sideRight});
 			if(BaseCompressor::mSidechainHPFEnabled) {
-				sideLeft = BaseCompressor::mSidechainFilter.at(Processor::LEFT).process(sideLeft);
-				sideRight
-					= BaseCompressor::mSidechainFilter.at(Processor::RIGHT).process(sideRight);
+				BaseCompressor::mSidechainFilter.processFrame(sidechain);
 			}
 			if(BaseCompressor::mPreEmphasisMode == SidechainPreEmphasisFilterMode::Soft) {
-				sideLeft
-					= BaseCompressor::mSoftLowShelfFilter.at(Processor::LEFT).process(sideLeft);
-				sideLeft
-					= BaseCompressor::mSoftHighShelfFilter.at(Processor::LEFT).process(sideLeft);
-				sideRight
-					= BaseCompressor::mSoftLowShelfFilter.at(Processor::RIGHT).process(sideRight);
-				sideRight
-					= BaseCompressor::mSoftHighShelfFilter.at(Processor::RIGHT).process(sideRight);
+				BaseCompressor::mSoftLowShelfFilter.processFrame(sidechain);
+				BaseCompressor::mSoftHighShelfFilter.processFrame(sidechain);
 			}
 			else if(BaseCompressor::mPreEmphasisMode == SidechainPreEmphasisFilterMode::Hard) {
-				sideLeft
-					= BaseCompressor::mHardLowShelfFilter.at(Processor::LEFT).process(sideLeft);
-				sideLeft
-					= BaseCompressor::mHardHighShelfFilter.at(Processor::LEFT).process(sideLeft);
-				sideRight
-					= BaseCompressor::mHardLowShelfFilter.at(Processor::RIGHT).process(sideRight);
-				sideRight
-					= BaseCompressor::mHardHighShelfFilter.at(Processor::RIGHT).process(sideRight);
+				BaseCompressor::mHardLowShelfFilter.processFrame(sidechain);
+				BaseCompressor::mHardHighShelfFilter.processFrame(sidechain);
 			}
+			sideLeft = sidechain.at(Processor::LEFT);
+			sideRight = sidechain.at(Processor::RIGHT);
 #ifdef TESTING_COMPRESSOR_1176
 			Logger::LogMessage("Compressor1176: SidechainFilteredLeft:" + juce::String(sideLeft));
 #endif
@@ -259,8 +250,11 @@ namespace apex::dsp {
 											 Span<FloatType> sidechainRight,
 											 Span<FloatType> outputLeft,
 											 Span<FloatType> outputRight) noexcept -> void final {
-			jassert(inputLeft.size() == inputRight.size() == sidechainLeft.size()
-					== sidechainRight.size() == outputLeft.size() == outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == sidechainLeft.size()
+					&& inputLeft.size() == sidechainRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
 			auto numSamples = inputLeft.size();
 			for(auto index = 0U; index < numSamples; ++index) {
 				auto [outLeft, outRight] = processStereoSidechained(inputLeft.at(index),
@@ -287,8 +281,11 @@ namespace apex::dsp {
 											 Span<const FloatType> sidechainRight,
 											 Span<FloatType> outputLeft,
 											 Span<FloatType> outputRight) noexcept -> void final {
-			jassert(inputLeft.size() == inputRight.size() == sidechainLeft.size()
-					== sidechainRight.size() == outputLeft.size() == outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == sidechainLeft.size()
+					&& inputLeft.size() == sidechainRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
 			auto numSamples = inputLeft.size();
 			for(auto index = 0U; index < numSamples; ++index) {
 				auto [outLeft, outRight] = processStereoSidechained(inputLeft.at(index),
@@ -315,8 +312,11 @@ namespace apex::dsp {
 											 Span<const FloatType> sidechainRight,
 											 Span<FloatType> outputLeft,
 											 Span<FloatType> outputRight) noexcept -> void final {
-			jassert(inputLeft.size() == inputRight.size() == sidechainLeft.size()
-					== sidechainRight.size() == outputLeft.size() == outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == sidechainLeft.size()
+					&& inputLeft.size() == sidechainRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
 			auto numSamples = inputLeft.size();
 			for(auto index = 0U; index < numSamples; ++index) {
 				auto [outLeft, outRight] = processStereoSidechained(inputLeft.at(index),
@@ -346,8 +346,9 @@ namespace apex::dsp {
 								  Span<FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void final {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
 			auto size = inputLeft.size();
 			for(auto i = 0U; i < size; ++i) {
 				auto [outLeft, outRight] = processStereoSidechained(inputLeft.at(i),
@@ -363,8 +364,9 @@ namespace apex::dsp {
 								  Span<const FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void final {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
 			auto size = inputLeft.size();
 			for(auto i = 0U; i < size; ++i) {
 				auto [outLeft, outRight] = processStereoSidechained(inputLeft.at(i),
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <array>
+#include <memory>
 #include <type_traits>
 #include <utility>
-#include <vector>
 
 #include "../../base/StandardIncludes.h"
+#include "../filters/BiQuadBank.h"
+#include "../filters/BiQuadCascade.h"
 #include "../filters/BiQuadFilter.h"
+#include "../filters/ResponseGrid.h"
+#include "../filters/StateVariableFilter.h"
+#include "../../utils/synchronization/TripleBuffer.h"
 #include "Gain.h"
 #include "Processor.h"
 
@@ -40,15 +46,35 @@ namespace apex::dsp {
 			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
 	class EQBand : public Processor<FloatType> {
 	  private:
+		/// The maximum order (number of stages) used by "____pass" type filters
+		static constexpr size_t MAX_ORDER = 8;
+
 		using Processor = Processor<FloatType>;
 		using BiQuadFilter = BiQuadFilter<FloatType>;
+		using BiQuadBank = BiQuadBank<FloatType, Processor::MAX_CHANNELS>;
+		using BiQuadCascade = BiQuadCascade<FloatType, MAX_ORDER>;
+		using StateVariableFilter = StateVariableFilter<FloatType>;
 
 	  public:
+		/// @brief The designs of every filter stage of an `EQBand`, calculated ahead of time so
+		/// they can be handed to the audio thread without it having to do any maths
+		struct Design {
+			BandType type = BandType::Bell;
+			Hertz frequency = 1.0_kHz;
+			FloatType q = narrow_cast<FloatType>(0.7);
+			Decibels gain = 0.0_dB;
+			Hertz sampleRate = 44.1_kHz;
+			DesignMethod method = DesignMethod::Bilinear;
+			/// `gain` as a linear value, for bands whose gain stage follows it
+			FloatType gainLinear = narrow_cast<FloatType>(1.0);
+			size_t numStages = 1;
+			std::array<BiQuadDesign<FloatType>, MAX_ORDER> stages
+				= std::array<BiQuadDesign<FloatType>, MAX_ORDER>();
+		};
+
 		/// @brief Creates a default `EQBand`
 		EQBand() noexcept {
-			for(auto& channel : mFilter) {
-				channel = BiQuadFilter::MakeBell(mFrequency, mQ, mGain, mSampleRate);
-			}
+			mFilter = BiQuadBank(BiQuadFilter::MakeBell(mFrequency, mQ, mGain, mSampleRate));
 		}
 
 		/// @brief Creates an `EQBand` with the given parameters
@@ -74,9 +100,10 @@ namespace apex::dsp {
 				mGainProcessor = Gain<FloatType>(mGain);
 			}
 			for(auto& channel : mFilters) {
-				channel.resize(mOrder);
+				channel.setNumStages(mOrder);
 			}
 			createFilters();
+			applyParameters(mFrequency, mQ, mGain);
 		}
 
 		/// @brief Move constructs an `EQBand` from the given one
@@ -89,17 +116,7 @@ namespace apex::dsp {
 		///
 		/// @param frequency - The new frequency, in Hertz
 		inline auto setFrequency(Hertz frequency) noexcept -> void {
-			mFrequency = frequency;
-			for(auto& channel : mFilter) {
-				channel.setFrequency(mFrequency);
-			}
-			if(mType < BandType::Allpass) {
-				for(auto& channel : mFilters) {
-					for(auto& filter : channel) {
-						filter.setFrequency(mFrequency);
-					}
-				}
-			}
+			applyParameters(frequency, mQ, getGainDB());
 		}
 
 		/// @brief Returns the frequency of this `EQBand`
@@ -114,17 +131,7 @@ namespace apex::dsp {
 		/// @param q - The new Q
 		inline auto setQ(FloatType q) noexcept -> void {
 			jassert(q > narrow_cast<FloatType>(0.0));
-			mQ = q;
-			for(auto& channel : mFilter) {
-				channel.setQ(mQ);
-			}
-			if(mType < BandType::Allpass) {
-				for(auto& channel : mFilters) {
-					for(auto& filter : channel) {
-						filter.setQ(mQ);
-					}
-				}
-			}
+			applyParameters(mFrequency, q, getGainDB());
 		}
 
 		/// @brief Returns the Q of this `EQBand`
@@ -138,17 +145,7 @@ namespace apex::dsp {
 		///
 		/// @param gainDB - The new gain, in Decibels
 		virtual inline auto setGainDB(Decibels gainDB) noexcept -> void {
-			mGain = gainDB;
-			for(auto& channel : mFilter) {
-				channel.setGainDB(mGain);
-			}
-			if(mType < BandType::Allpass) {
-				for(auto& channel : mFilters) {
-					for(auto& filter : channel) {
-						filter.setGainDB(mGain);
-					}
-				}
-			}
+			applyParameters(mFrequency, mQ, gainDB);
 		}
 
 		/// @brief Returns the gain of this `EQBand`
@@ -163,16 +160,7 @@ namespace apex::dsp {
 		/// @param sampleRate - The new sample rate, in Hertz
 		inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
 			mSampleRate = sampleRate;
-			for(auto& channel : mFilter) {
-				channel.setSampleRate(mSampleRate);
-			}
-			if(mType < BandType::Allpass) {
-				for(auto& channel : mFilters) {
-					for(auto& filter : channel) {
-						filter.setSampleRate(mSampleRate);
-					}
-				}
-			}
+			applyParameters(mFrequency, mQ, getGainDB());
 		}
 
 		/// @brief Returns the sample rate of this `EQBand`
@@ -182,6 +170,24 @@ namespace apex::dsp {
 			return mSampleRate;
 		}
 
+		/// @brief Sets the method used to design this `EQBand`'s filters. With
+		/// `DesignMethod::MagnitudeMatched`, the band follows its analog response up to Nyquist,
+		/// so it doesn't need to be oversampled to avoid cramping. The modulated processing paths
+		/// are unaffected
+		///
+		/// @param method - The new design method
+		inline auto setDesignMethod(DesignMethod method) noexcept -> void {
+			mDesignMethod = method;
+			applyParameters(mFrequency, mQ, getGainDB());
+		}
+
+		/// @brief Returns the method used to design this `EQBand`'s filters
+		///
+		/// @return - The current design method
+		[[nodiscard]] inline auto getDesignMethod() const noexcept -> DesignMethod {
+			return mDesignMethod;
+		}
+
 		/// @brief Sets the type of this `EQBand` to the given value
 		///
 		/// @param type - The new type
@@ -195,10 +201,12 @@ namespace apex::dsp {
 					case 3: mOrder = 8; break;
 				}
 				for(auto& channel : mFilters) {
-					channel.resize(mOrder);
+					channel.setNumStages(mOrder);
 				}
 			}
 			createFilters();
+			// the filters were just recreated with the default design method
+			applyParameters(mFrequency, mQ, getGainDB());
 		}
 
 		/// @brief Returns the type of this `EQBand`
@@ -208,7 +216,52 @@ namespace apex::dsp {
 			return mType;
 		}
 
-		/// @brief Applies this `EQBand` to the given input value
+		/// @brief Calculates the filter designs for the given parameters and publishes them to
+		/// the audio thread, which picks them up at the start of its next block. This is
+		/// lock-free and allocation-free, and is meant to be called from a single non-realtime
+		/// thread (eg. the message thread) instead of the parameter setters, so that the
+		/// coefficient maths never runs on the audio thread.
+		///
+		/// The type, sample rate and design method are only used to calculate the designs:
+		/// changing them is still done with `setBandType`, `setSampleRate` and
+		/// `setDesignMethod`. Designs calculated for a type, sample rate or design method other
+		/// than the band's current ones are ignored when picked up.
+		///
+		/// The frequency, Q and gain returned by the getters are updated here, on the calling
+		/// thread. The audio thread keeps its own copy of the parameters it has applied, so the
+		/// two threads never share them
+		///
+		/// @param type - The type of the band
+		/// @param frequency - The new frequency, in Hertz
+		/// @param q - The new Q
+		/// @param gainDB - The new gain, in Decibels
+		/// @param sampleRate - The sample rate of the band, in Hertz
+		/// @param method - The design method of the band
+		inline auto publishDesign(BandType type,
+								  Hertz frequency,
+								  FloatType q,
+								  Decibels gainDB,
+								  Hertz sampleRate,
+								  DesignMethod method = DesignMethod::Bilinear) noexcept -> void {
+			auto& design = mDesignHandoff->getBackBuffer();
+			design = calculateDesign(type, frequency, q, gainDB, sampleRate, method);
+			if(isDesignForThisBand(design)) {
+				recordPublishedParameters(design);
+			}
+			mDesignHandoff->publish();
+		}
+
+		/// @brief Picks up the latest design published by `publishDesign`, if there is a new
+		/// one. The block processing paths do this themselves, but per-sample processing does
+		/// not, so when using it, call this at the start of each block
+		inline auto updateFiltersIfNeeded() noexcept -> void {
+			if(mDesignHandoff->update() && applyDesign(mDesignHandoff->read())) {
+				mModulatedFiltersDirty = true;
+			}
+		}
+
+		/// @brief Applies this `EQBand` to the given input value. Designs published by
+		/// `publishDesign` are only picked up by `updateFiltersIfNeeded`
 		///
 		/// @param input - The input to apply EQ to
 		///
@@ -216,15 +269,13 @@ namespace apex::dsp {
 		[[nodiscard]] inline auto processMono(FloatType input) noexcept -> FloatType override {
 			auto x = input;
 			if(mType < BandType::Allpass) {
-				for(auto& filter : mFilters.at(Processor::MONO)) {
-					x = filter.process(x);
-				}
-				x = mGainProcessor.process(x);
+				x = mFilters.at(Processor::MONO).process(x);
+				x = mGainProcessor.processMono(x);
 			}
 			else {
-				x = mFilter.at(Processor::MONO).process(input);
+				x = mFilter.processLane(Processor::MONO, input);
 				if(mType == BandType::Allpass || mType == BandType::Notch) {
-					x = mGainProcessor.process(x);
+					x = mGainProcessor.processMono(x);
 				}
 			}
 			return x;
@@ -237,9 +288,16 @@ namespace apex::dsp {
 		inline auto
 		processMono(Span<FloatType> input, Span<FloatType> output) noexcept -> void override {
 			jassert(input.size() == output.size());
-			auto size = input.size();
-			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = processMono(input.at(i));
+			updateFiltersIfNeeded();
+			if(mType < BandType::Allpass) {
+				mFilters.at(Processor::MONO).process(input, output);
+				mGainProcessor.processMono(output, output);
+			}
+			else {
+				mFilter.processLane(Processor::MONO, input, output);
+				if(mType == BandType::Allpass || mType == BandType::Notch) {
+					mGainProcessor.processMono(output, output);
+				}
 			}
 		}
 
@@ -250,13 +308,21 @@ namespace apex::dsp {
 		inline auto
 		processMono(Span<const FloatType> input, Span<FloatType> output) noexcept -> void override {
 			jassert(input.size() == output.size());
-			auto size = input.size();
-			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = processMono(input.at(i));
+			updateFiltersIfNeeded();
+			if(mType < BandType::Allpass) {
+				mFilters.at(Processor::MONO).process(input, output);
+				mGainProcessor.processMono(output, output);
+			}
+			else {
+				mFilter.processLane(Processor::MONO, input, output);
+				if(mType == BandType::Allpass || mType == BandType::Notch) {
+					mGainProcessor.processMono(output, output);
+				}
 			}
 		}
 
-		/// @brief Applies this `EQBand` to the given arrays of input values
+		/// @brief Applies this `EQBand` to the given arrays of input values. Designs published by
+		/// `publishDesign` are only picked up by `updateFiltersIfNeeded`
 		///
 		/// @param inputLeft - The left channel sample to apply EQ to
 		/// @param inputRight - The right channel sample to apply EQ to
@@ -267,21 +333,19 @@ namespace apex::dsp {
 			auto left = inputLeft;
 			auto right = inputRight;
 			if(mType < BandType::Allpass) {
-				for(auto& filter : mFilters.at(Processor::LEFT)) {
-					left = filter.process(left);
-				}
-				for(auto& filter : mFilters.at(Processor::RIGHT)) {
-					right = filter.process(right);
-				}
-				left = mGainProcessor.process(left);
-				right = mGainProcessor.process(right);
+				left = mFilters.at(Processor::LEFT).process(left);
+				right = mFilters.at(Processor::RIGHT).process(right);
+				left = mGainProcessor.processMono(left);
+				right = mGainProcessor.processMono(right);
 			}
 			else {
-				left = mFilter.at(Processor::LEFT).process(left);
-				right = mFilter.at(Processor::RIGHT).process(right);
+				auto frame = std::array<FloatType, Processor::MAX_CHANNELS>({left, right});
+				mFilter.processFrame(frame);
+				left = frame.at(Processor::LEFT);
+				right = frame.at(Processor::RIGHT);
 				if(mType == BandType::Allpass || mType == BandType::Notch) {
-					left = mGainProcessor.process(left);
-					right = mGainProcessor.process(right);
+					left = mGainProcessor.processMono(left);
+					right = mGainProcessor.processMono(right);
 				}
 			}
 			return {left, right};
@@ -297,13 +361,22 @@ namespace apex::dsp {
 								  Span<FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
-			auto size = inputLeft.size();
-			for(auto i = 0U; i < size; ++i) {
-				auto [left, right] = processStereo(inputLeft.at(i), inputRight.at(i));
-				outputLeft.at(i) = left;
-				outputRight.at(i) = right;
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
+			updateFiltersIfNeeded();
+			if(mType < BandType::Allpass) {
+				mFilters.at(Processor::LEFT).process(inputLeft, outputLeft);
+				mFilters.at(Processor::RIGHT).process(inputRight, outputRight);
+				mGainProcessor.processMono(outputLeft, outputLeft);
+				mGainProcessor.processMono(outputRight, outputRight);
+			}
+			else {
+				mFilter.process({inputLeft, inputRight}, {outputLeft, outputRight});
+				if(mType == BandType::Allpass || mType == BandType::Notch) {
+					mGainProcessor.processMono(outputLeft, outputLeft);
+					mGainProcessor.processMono(outputRight, outputRight);
+				}
 			}
 		}
 
@@ -317,13 +390,107 @@ namespace apex::dsp {
 								  Span<const FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
-			auto size = inputLeft.size();
-			for(auto i = 0U; i < size; ++i) {
-				auto [left, right] = processStereo(inputLeft.at(i), inputRight.at(i));
-				outputLeft.at(i) = left;
-				outputRight.at(i) = right;
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
+			updateFiltersIfNeeded();
+			if(mType < BandType::Allpass) {
+				mFilters.at(Processor::LEFT).process(inputLeft, outputLeft);
+				mFilters.at(Processor::RIGHT).process(inputRight, outputRight);
+				mGainProcessor.processMono(outputLeft, outputLeft);
+				mGainProcessor.processMono(outputRight, outputRight);
+			}
+			else {
+				mFilter.process({inputLeft, inputRight}, {outputLeft, outputRight});
+				if(mType == BandType::Allpass || mType == BandType::Notch) {
+					mGainProcessor.processMono(outputLeft, outputLeft);
+					mGainProcessor.processMono(outputRight, outputRight);
+				}
+			}
+		}
+
+		/// @brief Applies this `EQBand` to the given array of input values, with its frequency
+		/// modulated per sample (eg. by an envelope, for dynamic EQ). Uses state variable filters
+		/// with the same response as the band's BiQuad Filters, so modulating costs one `tan` per
+		/// sample per filter stage
+		///
+		/// @param input - The input values to apply EQ to
+		/// @param output - The processed values
+		/// @param frequencies - The frequency of the band for each sample, in Hertz
+		inline auto processMono(Span<FloatType> input,
+								Span<FloatType> output,
+								Span<const FloatType> frequencies) noexcept -> void {
+			processMono(Span<const FloatType>::MakeSpan(input.data(), input.size()),
+						output,
+						frequencies);
+		}
+
+		/// @brief Applies this `EQBand` to the given array of input values, with its frequency
+		/// modulated per sample (eg. by an envelope, for dynamic EQ). Uses state variable filters
+		/// with the same response as the band's BiQuad Filters, so modulating costs one `tan` per
+		/// sample per filter stage
+		///
+		/// @param input - The input values to apply EQ to
+		/// @param output - The processed values
+		/// @param frequencies - The frequency of the band for each sample, in Hertz
+		inline auto processMono(Span<const FloatType> input,
+								Span<FloatType> output,
+								Span<const FloatType> frequencies) noexcept -> void {
+			jassert(input.size() == output.size() && input.size() == frequencies.size());
+			updateFiltersIfNeeded();
+			updateModulatedFiltersIfNeeded();
+			processModulated(Processor::MONO, input, output, frequencies);
+			if(mType <= BandType::Notch) {
+				mGainProcessor.processMono(output, output);
+			}
+		}
+
+		/// @brief Applies this `EQBand` to the given arrays of input values, with its frequency
+		/// modulated per sample (eg. by an envelope, for dynamic EQ). Both channels share the
+		/// same modulation
+		///
+		/// @param inputLeft - The left channel to apply EQ to
+		/// @param inputRight - The right channel to apply EQ to
+		/// @param outputLeft - The left channel processed values
+		/// @param outputRight - The right channel processed values
+		/// @param frequencies - The frequency of the band for each sample, in Hertz
+		inline auto processStereo(Span<FloatType> inputLeft,
+								  Span<FloatType> inputRight,
+								  Span<FloatType> outputLeft,
+								  Span<FloatType> outputRight,
+								  Span<const FloatType> frequencies) noexcept -> void {
+			processStereo(Span<const FloatType>::MakeSpan(inputLeft.data(), inputLeft.size()),
+						  Span<const FloatType>::MakeSpan(inputRight.data(), inputRight.size()),
+						  outputLeft,
+						  outputRight,
+						  frequencies);
+		}
+
+		/// @brief Applies this `EQBand` to the given arrays of input values, with its frequency
+		/// modulated per sample (eg. by an envelope, for dynamic EQ). Both channels share the
+		/// same modulation
+		///
+		/// @param inputLeft - The left channel to apply EQ to
+		/// @param inputRight - The right channel to apply EQ to
+		/// @param outputLeft - The left channel processed values
+		/// @param outputRight - The right channel processed values
+		/// @param frequencies - The frequency of the band for each sample, in Hertz
+		inline auto processStereo(Span<const FloatType> inputLeft,
+								  Span<const FloatType> inputRight,
+								  Span<FloatType> outputLeft,
+								  Span<FloatType> outputRight,
+								  Span<const FloatType> frequencies) noexcept -> void {
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size()
+					&& inputLeft.size() == frequencies.size());
+			updateFiltersIfNeeded();
+			updateModulatedFiltersIfNeeded();
+			processModulated(Processor::LEFT, inputLeft, outputLeft, frequencies);
+			processModulated(Processor::RIGHT, inputRight, outputRight, frequencies);
+			if(mType <= BandType::Notch) {
+				mGainProcessor.processMono(outputLeft, outputLeft);
+				mGainProcessor.processMono(outputRight, outputRight);
 			}
 		}
 
@@ -331,14 +498,15 @@ namespace apex::dsp {
 		inline auto reset() noexcept -> void override {
 			if(mType < BandType::Allpass) {
 				for(auto& channel : mFilters) {
-					for(auto& filter : channel) {
-						filter.reset();
-					}
+					channel.reset();
 				}
 			}
 			else {
-				for(auto& channel : mFilter) {
-					channel.reset();
+				mFilter.reset();
+			}
+			for(auto& channel : mModulatedFilters) {
+				for(auto& stage : channel) {
+					stage.reset();
 				}
 			}
 		}
@@ -353,12 +521,10 @@ namespace apex::dsp {
 		getMagnitudeForFrequency(Hertz frequency) const noexcept -> FloatType {
 			auto x = narrow_cast<FloatType>(1.0);
 			if(mType < BandType::Allpass) {
-				for(const auto& channel : mFilters.at(Processor::MONO)) {
-					x *= channel.getMagnitudeForFrequency(frequency);
-				}
+				x = mFilters.at(Processor::MONO).getMagnitudeForFrequency(frequency);
 			}
 			else {
-				x = mFilter.at(Processor::MONO).getMagnitudeForFrequency(frequency);
+				x = mFilter.getMagnitudeForFrequency(frequency);
 			}
 			return x;
 		}
@@ -389,6 +555,22 @@ namespace apex::dsp {
 			}
 		}
 
+		/// @brief Calculates the linear magnitude response of this filter at every point of the
+		/// given grid, evaluating the whole grid at once
+		///
+		/// @param grid - The frequencies to calculate the magnitude response for
+		/// @param magnitudes - The array to store the magnitudes in
+		virtual inline auto
+		getMagnitudesForFrequencies(const ResponseGrid<FloatType>& grid,
+									Span<FloatType> magnitudes) const noexcept -> void {
+			if(mType < BandType::Allpass) {
+				mFilters.at(Processor::MONO).getMagnitudesForFrequencies(grid, magnitudes);
+			}
+			else {
+				mFilter.getMagnitudesForFrequencies(grid, magnitudes);
+			}
+		}
+
 		/// @brief Calculates the decibel magnitude response of this filter for the given array
 		/// of frequencies and stores them in `magnitudes`
 		///
@@ -414,12 +596,10 @@ namespace apex::dsp {
 		getPhaseForFrequency(Hertz frequency) const noexcept -> Radians {
 			Radians x = 0.0_rad;
 			if(mType < BandType::Allpass) {
-				for(const auto& channel : mFilters.at(Processor::MONO)) {
-					x += channel.getPhaseForFrequency(frequency);
-				}
+				x = mFilters.at(Processor::MONO).getPhaseForFrequency(frequency);
 			}
 			else {
-				x = mFilter.at(Processor::MONO).getPhaseForFrequency(frequency);
+				x = mFilter.getPhaseForFrequency(frequency);
 			}
 			return x;
 		}
@@ -449,6 +629,21 @@ namespace apex::dsp {
 			}
 		}
 
+		/// @brief Calculates the phase response of this filter at every point of the given grid,
+		/// evaluating the whole grid at once
+		///
+		/// @param grid - The frequencies to calculate the phase response for
+		/// @param phases - The array to store the phases (in radians) in
+		virtual inline auto getPhasesForFrequencies(const ResponseGrid<FloatType>& grid,
+													Span<Radians> phases) const noexcept -> void {
+			if(mType < BandType::Allpass) {
+				mFilters.at(Processor::MONO).getPhasesForFrequencies(grid, phases);
+			}
+			else {
+				mFilter.getPhasesForFrequencies(grid, phases);
+			}
+		}
+
 		/// @brief Calculates the phase response of this filter for the given array of
 		/// frequencies and stores it in `phases`
 		///
@@ -474,11 +669,247 @@ namespace apex::dsp {
 		/// Only used for "____pass" type filters
 		Gain<FloatType> mGainProcessor = Gain<FloatType>(mGain);
 		Hertz mSampleRate = 44.1_kHz;
+		DesignMethod mDesignMethod = DesignMethod::Bilinear;
+		/// The frequency, Q and gain the filters were last designed with, which the processing
+		/// paths use. Designs picked up from `publishDesign` only update these, never the
+		/// parameters above, so the audio thread doesn't race with the getters
+		Hertz mAppliedFrequency = mFrequency;
+		FloatType mAppliedQ = mQ;
+		Decibels mAppliedGain = mGain;
 		size_t mOrder = 1;
-		std::array<BiQuadFilter, Processor::MAX_CHANNELS> mFilter
-			= std::array<BiQuadFilter, Processor::MAX_CHANNELS>();
-		std::array<std::vector<BiQuadFilter>, Processor::MAX_CHANNELS> mFilters
-			= std::array<std::vector<BiQuadFilter>, Processor::MAX_CHANNELS>();
+		/// Used for single-stage filters, all channels share one design and run in lanes
+		BiQuadBank mFilter = BiQuadBank();
+		/// Used for "____pass" type filters, one cascade of `mOrder` stages per channel
+		std::array<BiQuadCascade, Processor::MAX_CHANNELS> mFilters
+			= std::array<BiQuadCascade, Processor::MAX_CHANNELS>();
+		/// Used by the modulated processing paths, one cascade of up to `MAX_ORDER` stages per
+		/// channel, configured lazily the first time they are used after a parameter change
+		std::array<std::array<StateVariableFilter, MAX_ORDER>, Processor::MAX_CHANNELS>
+			mModulatedFilters
+			= std::array<std::array<StateVariableFilter, MAX_ORDER>, Processor::MAX_CHANNELS>();
+		/// The ratio of each modulated stage's frequency to the band's frequency
+		std::array<FloatType, MAX_ORDER> mModulatedFrequencyScales
+			= std::array<FloatType, MAX_ORDER>();
+		/// Whether parameters have changed since the modulated filters were last configured
+		bool mModulatedFiltersDirty = true;
+		/// Designs published by `publishDesign`, picked up at the start of each block
+		std::unique_ptr<utils::synchronization::TripleBuffer<Design>> mDesignHandoff
+			= std::make_unique<utils::synchronization::TripleBuffer<Design>>();
+
+		/// @brief Returns the number of filter stages used by the given band type
+		///
+		/// @param type - The band type
+		///
+		/// @return - The number of stages
+		[[nodiscard]] static inline auto orderOf(BandType type) noexcept -> size_t {
+			if(type >= BandType::Allpass) {
+				return 1;
+			}
+			switch(static_cast<size_t>(type) % 4) {
+				case 0: return 1;
+				case 1: return 2;
+				case 2: return 4;
+				default: return 8;
+			}
+		}
+
+		/// @brief Returns the type of filter used for the stages of the given band type
+		///
+		/// @param type - The band type
+		///
+		/// @return - The filter type
+		[[nodiscard]] static inline auto filterTypeOf(BandType type) noexcept -> FilterType {
+			if(type < BandType::Highpass12DB) {
+				return FilterType::Lowpass;
+			}
+			if(type < BandType::Bandpass12DB) {
+				return FilterType::Highpass;
+			}
+			switch(type) {
+				case BandType::Allpass: return FilterType::Allpass;
+				case BandType::Notch: return FilterType::Notch;
+				case BandType::LowShelf: return FilterType::LowShelf;
+				case BandType::HighShelf: return FilterType::HighShelf;
+				case BandType::Bell: return FilterType::Bell;
+				case BandType::AnalogBell: return FilterType::AnalogBell;
+				default: return FilterType::Bandpass;
+			}
+		}
+
+		/// @brief Calculates the designs of the filter stages of a band with the given
+		/// parameters, the same way `createFilters` does. Does not touch any state of the band,
+		/// so it is safe to call from any thread
+		///
+		/// @param type - The type of the band
+		/// @param frequency - The frequency, in Hertz
+		/// @param q - The Q
+		/// @param gainDB - The gain, in Decibels
+		/// @param sampleRate - The sample rate, in Hertz
+		/// @param method - The method to design the filters with
+		///
+		/// @return - The design
+		[[nodiscard]] virtual inline auto calculateDesign(BandType type,
+														  Hertz frequency,
+														  FloatType q,
+														  Decibels gainDB,
+														  Hertz sampleRate,
+														  DesignMethod method) const noexcept
+			-> Design {
+			auto design = Design();
+			design.type = type;
+			design.frequency = frequency;
+			design.q = q;
+			design.gain = gainDB;
+			design.sampleRate = sampleRate;
+			design.method = method;
+			design.gainLinear = narrow_cast<FloatType>(gainDB.getLinear());
+			design.numStages = orderOf(type);
+
+			const auto filterType = filterTypeOf(type);
+			if(type < BandType::Allpass) {
+				for(size_t stage = 0; stage < design.numStages; ++stage) {
+					auto stageFrequency = filterType == FilterType::Bandpass ?
+											  frequency :
+											  frequencyShift(type, frequency, stage);
+					design.stages.at(stage) = BiQuadFilter::calculateDesign(filterType,
+																			stageFrequency,
+																			q,
+																			gainDB,
+																			sampleRate,
+																			method);
+				}
+			}
+			else {
+				design.stages.at(0) = BiQuadFilter::calculateDesign(filterType,
+																	frequency,
+																	q,
+																	gainDB,
+																	sampleRate,
+																	method);
+			}
+			return design;
+		}
+
+		/// @brief Returns whether the given design was calculated for this band's current type,
+		/// sample rate and design method
+		///
+		/// @param design - The design to check
+		///
+		/// @return - Whether the design can be applied to this band
+		[[nodiscard]] inline auto isDesignForThisBand(const Design& design) const noexcept -> bool {
+			return design.type == mType && design.sampleRate == mSampleRate
+				   && design.method == mDesignMethod;
+		}
+
+		/// @brief Records the parameters of a design being published by `publishDesign` (or
+		/// applied by the parameter setters) as the ones returned by the getters. Called on the
+		/// publishing thread
+		///
+		/// @param design - The design being published
+		virtual inline auto recordPublishedParameters(const Design& design) noexcept -> void {
+			mFrequency = design.frequency;
+			mQ = design.q;
+			mGain = design.gain;
+		}
+
+		/// @brief Applies the given design, picked up from `publishDesign` or calculated by the
+		/// parameter setters, to this band's filters. Only copies parameters and coefficients, so
+		/// no maths is done here. Called on the audio thread, so only the applied parameters are
+		/// updated
+		///
+		/// @param design - The design to apply
+		///
+		/// @return - Whether the design was applied. Designs calculated for a different type,
+		/// sample rate or design method than the band's current ones are dropped
+		virtual inline auto applyDesign(const Design& design) noexcept -> bool {
+			if(!isDesignForThisBand(design)) {
+				return false;
+			}
+
+			mAppliedFrequency = design.frequency;
+			mAppliedQ = design.q;
+			mAppliedGain = design.gain;
+			if(mType < BandType::Allpass) {
+				jassert(design.numStages == mOrder);
+				// the design is shared by every channel, so it is only copied, never recalculated
+				for(auto& channel : mFilters) {
+					for(size_t stage = 0; stage < design.numStages; ++stage) {
+						channel.setStageDesign(stage, design.stages.at(stage));
+					}
+				}
+			}
+			else {
+				mFilter.setDesign(design.stages.at(0));
+			}
+			return true;
+		}
+
+		/// @brief Calculates the filter designs for the given parameters, the same way
+		/// `publishDesign` does, and applies them straight away. The parameter setters go through
+		/// here, so every stage of a "____pass" band gets its frequency shift however it was
+		/// configured. The design is calculated once and copied to every channel
+		///
+		/// @param frequency - The new frequency, in Hertz
+		/// @param q - The new Q
+		/// @param gainDB - The new gain, in Decibels
+		inline auto
+		applyParameters(Hertz frequency, FloatType q, Decibels gainDB) noexcept -> void {
+			const auto design
+				= calculateDesign(mType, frequency, q, gainDB, mSampleRate, mDesignMethod);
+			recordPublishedParameters(design);
+			applyDesign(design);
+			mModulatedFiltersDirty = true;
+		}
+
+		/// @brief Configures the modulated filters for the current parameters if any have changed
+		/// since they were last configured
+		inline auto updateModulatedFiltersIfNeeded() noexcept -> void {
+			if(!mModulatedFiltersDirty) {
+				return;
+			}
+
+			const auto filterType = filterTypeOf(mType);
+			const auto numStages = orderOf(mType);
+			for(size_t stage = 0; stage < numStages; ++stage) {
+				// the stage shifts are proportional to the band's frequency, so they are kept as
+				// ratios and applied to the modulated frequency
+				auto scale = narrow_cast<FloatType>(1.0);
+				if(mType < BandType::Bandpass12DB) {
+					scale = narrow_cast<FloatType>(
+						static_cast<double>(frequencyShift(mType, Hertz(1.0), stage)));
+				}
+				mModulatedFrequencyScales.at(stage) = scale;
+				for(auto& channel : mModulatedFilters) {
+					channel.at(stage).setParameters(filterType,
+													mAppliedFrequency * scale,
+													mAppliedQ,
+													mAppliedGain,
+													mSampleRate);
+				}
+			}
+			mModulatedFiltersDirty = false;
+		}
+
+		/// @brief Applies the modulated filters of the given channel to the given input values
+		///
+		/// @param channel - The channel to process
+		/// @param input - The input values to apply EQ to
+		/// @param output - The processed values
+		/// @param frequencies - The frequency of the band for each sample, in Hertz
+		inline auto processModulated(size_t channel,
+									 Span<const FloatType> input,
+									 Span<FloatType> output,
+									 Span<const FloatType> frequencies) noexcept -> void {
+			auto& stages = mModulatedFilters.at(channel);
+			const auto numStages = orderOf(mType);
+			stages.at(0).process(input, output, frequencies, mModulatedFrequencyScales.at(0));
+			for(size_t stage = 1; stage < numStages; ++stage) {
+				stages.at(stage).process(output,
+										 output,
+										 frequencies,
+										 mModulatedFrequencyScales.at(stage));
+			}
+		}
 
 		/// @brief Returns the shifted frequency for the Nth filter stage in
 		/// a multi-order filter
@@ -487,16 +918,29 @@ namespace apex::dsp {
 		///
 		/// @return - The shifted frequency
 		[[nodiscard]] inline auto frequencyShift(size_t filterIndex) const noexcept -> Hertz {
+			return frequencyShift(mType, mFrequency, filterIndex);
+		}
+
+		/// @brief Returns the shifted frequency for the Nth filter stage in
+		/// a multi-order filter of the given type and frequency
+		///
+		/// @param type - The type of the band
+		/// @param frequency - The frequency of the band, in Hertz
+		/// @param filterIndex - The filter stage to calculate the shift for
+		///
+		/// @return - The shifted frequency
+		[[nodiscard]] static inline auto
+		frequencyShift(BandType type, Hertz frequency, size_t filterIndex) noexcept -> Hertz {
 			auto shiftMultiplier
 				= narrow_cast<FloatType>(0.25) * narrow_cast<FloatType>(filterIndex);
 			auto two = narrow_cast<FloatType>(2.0);
-			if(mType < BandType::Highpass12DB) {
-				Hertz nextOctFreq = mFrequency * two;
-				return mFrequency + (shiftMultiplier * (nextOctFreq - mFrequency));
+			if(type < BandType::Highpass12DB) {
+				Hertz nextOctFreq = frequency * two;
+				return frequency + (shiftMultiplier * (nextOctFreq - frequency));
 			}
 			else {
-				Hertz nextOctFreq = mFrequency / two;
-				return mFrequency - (shiftMultiplier * (nextOctFreq - mFrequency));
+				Hertz nextOctFreq = frequency / two;
+				return frequency - (shiftMultiplier * (nextOctFreq - frequency));
 			}
 		}
 
@@ -508,211 +952,205 @@ namespace apex::dsp {
 			switch(mType) {
 				case BandType::Lowpass12DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeLowpass(frequencyShift(ord),
-																		 mQ,
-																		 mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeLowpass(frequencyShift(ord),
+																		   mQ,
+																		   mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Lowpass24DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeLowpass(frequencyShift(ord),
-																		 mQ,
-																		 mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeLowpass(frequencyShift(ord),
+																		   mQ,
+																		   mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Lowpass48DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeLowpass(frequencyShift(ord),
-																		 mQ,
-																		 mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeLowpass(frequencyShift(ord),
+																		   mQ,
+																		   mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Lowpass96DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeLowpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeLowpass(frequencyShift(ord),
-																		 mQ,
-																		 mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeLowpass(frequencyShift(ord),
+																		   mQ,
+																		   mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Highpass12DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeHighpass(frequencyShift(ord),
-																		  mQ,
-																		  mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeHighpass(frequencyShift(ord),
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Highpass24DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeHighpass(frequencyShift(ord),
-																		  mQ,
-																		  mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeHighpass(frequencyShift(ord),
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Highpass48DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeHighpass(frequencyShift(ord),
-																		  mQ,
-																		  mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeHighpass(frequencyShift(ord),
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Highpass96DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeHighpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord] = BiQuadFilter::MakeHighpass(frequencyShift(ord),
-																		  mQ,
-																		  mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeHighpass(frequencyShift(ord),
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Bandpass12DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord]
-									= BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeBandpass(mFrequency,
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Bandpass24DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord]
-									= BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeBandpass(mFrequency,
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Bandpass48DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord]
-									= BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeBandpass(mFrequency,
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Bandpass96DB:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate));
 						for(auto& channel : mFilters) {
 							for(size_t ord = 0; ord < mOrder; ++ord) {
-								channel[ord]
-									= BiQuadFilter::MakeBandpass(mFrequency, mQ, mSampleRate);
+								channel.setStage(ord,
+												 BiQuadFilter::MakeBandpass(mFrequency,
+																			mQ,
+																			mSampleRate));
 							}
 						}
 					}
 					break;
 				case BandType::Allpass:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeAllpass(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeAllpass(mFrequency, mQ, mSampleRate));
 					}
 					break;
 				case BandType::Notch:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeNotch(mFrequency, mQ, mSampleRate);
-						}
+						mFilter = BiQuadBank(BiQuadFilter::MakeNotch(mFrequency, mQ, mSampleRate));
 					}
 					break;
 				case BandType::LowShelf:
 					{
-						for(auto& channel : mFilter) {
-							channel
-								= BiQuadFilter::MakeLowShelf(mFrequency, mQ, mGain, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeLowShelf(mFrequency, mQ, mGain, mSampleRate));
 					}
 					break;
 				case BandType::HighShelf:
 					{
-						for(auto& channel : mFilter) {
-							channel
-								= BiQuadFilter::MakeHighShelf(mFrequency, mQ, mGain, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeHighShelf(mFrequency, mQ, mGain, mSampleRate));
 					}
 					break;
 				case BandType::Bell:
 					{
-						for(auto& channel : mFilter) {
-							channel = BiQuadFilter::MakeBell(mFrequency, mQ, mGain, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeBell(mFrequency, mQ, mGain, mSampleRate));
 					}
 					break;
 				case BandType::AnalogBell:
 					{
-						for(auto& channel : mFilter) {
-							channel
-								= BiQuadFilter::MakeAnalogBell(mFrequency, mQ, mGain, mSampleRate);
-						}
+						mFilter = BiQuadBank(
+							BiQuadFilter::MakeAnalogBell(mFrequency, mQ, mGain, mSampleRate));
 					}
 					break;
 			}
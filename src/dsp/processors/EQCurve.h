@@ -0,0 +1,200 @@
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../base/StandardIncludes.h"
+#include "../filters/ResponseGrid.h"
+#include "EQBand.h"
+
+namespace apex::dsp {
+	/// @brief The combined magnitude response of several `EQBand`s over a grid of frequencies,
+	/// for drawing an EQ curve
+	///
+	/// The response of each band is cached, and only recalculated when that band's parameters
+	/// change. The combined curve is only recalculated when one of the bands has changed
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	/// @tparam MaxBands - The maximum number of bands in the curve
+	template<typename FloatType = float,
+			 size_t MaxBands = 8,
+			 std::enable_if_t<std::is_floating_point_v<FloatType> && (MaxBands > 0), bool> = true>
+	class EQCurve {
+	  public:
+		/// @brief Constructs an empty `EQCurve`
+		EQCurve() noexcept = default;
+
+		/// @brief Constructs an `EQCurve` over the given frequencies
+		///
+		/// @param frequencies - The frequencies of the curve, in Hertz
+		/// @param sampleRate - The sample rate of the bands, in Hertz
+		EQCurve(Span<const Hertz> frequencies, Hertz sampleRate) noexcept {
+			setFrequencies(frequencies, sampleRate);
+		}
+
+		/// @brief Move constructs an `EQCurve` from the given one
+		///
+		/// @param curve - The `EQCurve` to move
+		EQCurve(EQCurve&& curve) noexcept = default;
+		~EQCurve() noexcept = default;
+
+		/// @brief Sets the frequencies of this curve and the sample rate of its bands. Every band
+		/// will be recalculated on its next update. Allocates if the curve grows
+		///
+		/// @param frequencies - The frequencies of the curve, in Hertz
+		/// @param sampleRate - The sample rate of the bands, in Hertz
+		inline auto setFrequencies(Span<const Hertz> frequencies, Hertz sampleRate) noexcept
+			-> void {
+			mGrid.setFrequencies(frequencies, sampleRate);
+			for(auto& band : mBands) {
+				band.magnitudes.resize(mGrid.size());
+				band.upToDate = false;
+			}
+			mMagnitudes.resize(mGrid.size());
+			mMagnitudesDirty = true;
+		}
+
+		/// @brief Returns the grid of frequencies this curve is evaluated over
+		///
+		/// @return - The grid
+		[[nodiscard]] inline auto getGrid() const noexcept -> const ResponseGrid<FloatType>& {
+			return mGrid;
+		}
+
+		/// @brief Updates the given slot of this curve from the given band. The band's response
+		/// is only recalculated if its parameters have changed since the slot was last updated
+		///
+		/// @param index - The slot of the band in this curve
+		/// @param band - The band
+		///
+		/// @return - Whether the band's response was recalculated
+		inline auto updateBand(size_t index, const EQBand<FloatType>& band) noexcept -> bool {
+			jassert(index < MaxBands);
+			jassert(band.getSampleRate() == mGrid.getSampleRate());
+			auto& slot = mBands.at(index);
+			const auto parameters = BandParameters{band.getBandType(),
+												   band.getFrequency(),
+												   band.getQ(),
+												   band.getGainDB(),
+												   band.getSampleRate(),
+												   band.getDesignMethod()};
+
+			if(slot.upToDate && slot.parameters == parameters) {
+				if(!slot.active) {
+					slot.active = true;
+					mMagnitudesDirty = true;
+				}
+				return false;
+			}
+
+			band.getMagnitudesForFrequencies(
+				mGrid,
+				Span<FloatType>::MakeSpan(slot.magnitudes.data(), slot.magnitudes.size()));
+			slot.parameters = parameters;
+			slot.active = true;
+			slot.upToDate = true;
+			mMagnitudesDirty = true;
+			return true;
+		}
+
+		/// @brief Removes the band in the given slot from this curve
+		///
+		/// @param index - The slot of the band
+		inline auto removeBand(size_t index) noexcept -> void {
+			jassert(index < MaxBands);
+			if(mBands.at(index).active) {
+				mBands.at(index).active = false;
+				mMagnitudesDirty = true;
+			}
+		}
+
+		/// @brief Returns the linear magnitude response of the band in the given slot, as of its
+		/// last update
+		///
+		/// @param index - The slot of the band
+		///
+		/// @return - The magnitudes of the band, one per point of the curve
+		[[nodiscard]] inline auto
+		getBandMagnitudes(size_t index) const noexcept -> Span<const FloatType> {
+			const auto& magnitudes = mBands.at(index).magnitudes;
+			return Span<const FloatType>::MakeSpan(magnitudes.data(), magnitudes.size());
+		}
+
+		/// @brief Returns the combined linear magnitude response of every band in this curve,
+		/// recalculating it if any band has changed since it was last calculated
+		///
+		/// @return - The magnitudes, one per point of the curve
+		[[nodiscard]] inline auto getMagnitudes() noexcept -> Span<const FloatType> {
+			if(mMagnitudesDirty) {
+				combineBands();
+			}
+			return Span<const FloatType>::MakeSpan(mMagnitudes.data(), mMagnitudes.size());
+		}
+
+		/// @brief Calculates the combined decibel magnitude response of every band in this curve
+		///
+		/// @param magnitudes - The array to store the magnitudes in
+		inline auto getDecibelMagnitudes(Span<Decibels> magnitudes) noexcept -> void {
+			jassert(magnitudes.size() == mGrid.size());
+			const auto linear = getMagnitudes();
+			const auto size = linear.size();
+			for(size_t i = 0; i < size; ++i) {
+				magnitudes.at(i) = Decibels::fromLinear(linear.at(i));
+			}
+		}
+
+		auto operator=(EQCurve&& curve) noexcept -> EQCurve& = default;
+
+	  private:
+		/// @brief The parameters that determine the response of a band
+		struct BandParameters {
+			BandType type = BandType::Bell;
+			Hertz frequency = 1.0_kHz;
+			FloatType q = narrow_cast<FloatType>(0.7);
+			Decibels gain = 0.0_dB;
+			Hertz sampleRate = 44.1_kHz;
+			DesignMethod method = DesignMethod::Bilinear;
+
+			[[nodiscard]] inline auto
+			operator==(const BandParameters& parameters) const noexcept -> bool {
+				return type == parameters.type && frequency == parameters.frequency
+					   && q == parameters.q && gain == parameters.gain
+					   && sampleRate == parameters.sampleRate && method == parameters.method;
+			}
+		};
+
+		/// @brief The cached response of a single band
+		struct Band {
+			BandParameters parameters = BandParameters();
+			std::vector<FloatType> magnitudes = std::vector<FloatType>();
+			bool active = false;
+			bool upToDate = false;
+		};
+
+		ResponseGrid<FloatType> mGrid = ResponseGrid<FloatType>();
+		std::array<Band, MaxBands> mBands = std::array<Band, MaxBands>();
+		std::vector<FloatType> mMagnitudes = std::vector<FloatType>();
+		bool mMagnitudesDirty = true;
+
+		/// @brief Recalculates the combined response as the product of every active band's
+		inline auto combineBands() noexcept -> void {
+			const auto size = mMagnitudes.size();
+			for(size_t i = 0; i < size; ++i) {
+				mMagnitudes[i] = narrow_cast<FloatType>(1.0);
+			}
+
+			for(const auto& band : mBands) {
+				if(band.active) {
+					for(size_t i = 0; i < size; ++i) {
+						mMagnitudes[i] *= band.magnitudes[i];
+					}
+				}
+			}
+			mMagnitudesDirty = false;
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EQCurve)
+	};
+} // namespace apex::dsp
@@ -60,6 +60,16 @@ namespace apex::dsp {
 			mGainLinear = narrow_cast<FloatType>(gainDecibels.getLinear());
 		}
 
+		/// @brief Sets the gain of this `Gain` to the given Decibel value, using the given,
+		/// already converted, linear value instead of converting it here
+		///
+		/// @param gainDecibels - The Decibel gain value to set this `Gain` to
+		/// @param gainLinear - The same gain, as a linear value
+		inline auto setGain(Decibels gainDecibels, FloatType gainLinear) noexcept -> void {
+			mGainDecibels = gainDecibels;
+			mGainLinear = gainLinear;
+		}
+
 		/// @brief Returns the currently set gain value, in Decibels
 		///
 		/// @return The gain value, in Decibels
@@ -126,8 +136,9 @@ namespace apex::dsp {
 								  Span<FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void final {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
 			auto size = inputLeft.size();
 			for(auto i = 0U; i < size; ++i) {
 				auto [left, right] = processStereo(inputLeft.at(i), inputRight.at(i));
@@ -147,8 +158,9 @@ namespace apex::dsp {
 								  Span<const FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void final {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
 			auto size = inputLeft.size();
 			for(auto i = 0U; i < size; ++i) {
 				auto [left, right] = processStereo(inputLeft.at(i), inputRight.at(i));
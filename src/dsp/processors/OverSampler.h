@@ -1,186 +1,714 @@
 #pragma once
 
 #include <array>
+#include <cmath>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "../../base/StandardIncludes.h"
-#include "../filters/BiQuadFilter.h"
+#include "../../utils/AlignedBuffer.h"
+#include "../filters/HalfBandFIR.h"
+#include "../filters/HalfBandIIR.h"
 #include "juce_core/system/juce_PlatformDefs.h"
 
 namespace apex::dsp {
+	/// @brief The filters an `OverSampler` uses
+	enum class OverSamplingMode
+	{
+		/// Linear-phase half-band FIRs: no phase distortion, but tens of samples of latency
+		LinearPhase = 0,
+		/// Polyphase allpass half-band IIRs: a few samples of latency and much cheaper, but the
+		/// phase isn't linear near the top of the band
+		LowLatency
+	};
+
+	/// @brief How steep the filters of an `OverSampler` are. Steeper filters keep more of the top
+	/// of the band and reject more, for more CPU and latency
+	enum class OverSamplingSteepness
+	{
+		/// Keeps up to 0.40 of the sample rate, rejects images and aliases by 70dB
+		Gentle = 0,
+		/// Keeps up to 0.43 of the sample rate, rejects images and aliases by 90dB
+		Moderate,
+		/// Keeps up to 0.45 of the sample rate, rejects images and aliases by 100dB
+		Steep
+	};
+
+	/// @brief Oversamples by 2, 4, 8 or 16, by cascading 2x polyphase half-band stages.
+	///
+	/// The first stage (and last, when downsampling) is the steepest. Each later stage only has
+	/// to protect that same band at a higher rate, so it is much cheaper. In `LinearPhase` mode
+	/// the stages are FIRs, in `LowLatency` mode they are allpass IIRs, both as steep as the
+	/// chosen `OverSamplingSteepness`. The default, `Steep`, keeps everything up to 0.45 of the
+	/// original sample rate and rejects images and aliases by 100dB. A `Gentle` `LinearPhase`
+	/// first stage has about a third of the taps of a `Steep` one, so costs about half as much
+	///
+	/// Nothing is allocated until `prepare`, which sizes the (aligned, planar) buffers and the
+	/// per-channel filter states for the largest block and channel count that will be used. The
+	/// filters are designed once and shared by every channel. Channels can be oversampled one at
+	/// a time, or all at once, which lets the `LowLatency` filters run the channels side by side.
+	/// The `LinearPhase` filters are already vectorized within a channel, so they always run the
+	/// channels one at a time
+	///
+	/// The factor can be lowered (down to 1, ie no oversampling) and raised again at run time
+	/// with `setFactor`, without reallocating: each stage's design only depends on its place in
+	/// the cascade, so a lower factor just uses fewer of the stages, and the stages used by both
+	/// factors keep their state. To avoid clicks, the block before the switch fades out and the
+	/// blocks after it fade back in, once the signal from before the switch has been flushed
+	/// (ie after the new latency). The new latency is reported by `getLatency` from the first
+	/// block at the new factor
+	///
+	/// @tparam FloatType - The floating point type to back operations, either float or double
+	/// @tparam OverSampleRate - The largest oversampling factor, a power of two up to 16. This is
+	/// also the initial factor
 	template<typename FloatType,
 			 size_t OverSampleRate = 2,
-			 std::enable_if_t<(OverSampleRate % 2) == 0 && std::is_floating_point_v<FloatType>,
+			 std::enable_if_t<(OverSampleRate >= 2 && OverSampleRate <= 16
+							   && (OverSampleRate & (OverSampleRate - 1)) == 0)
+								  && std::is_floating_point_v<FloatType>,
 							  bool> = true>
 	class OverSampler {
 	  private:
-		using BiQuadFilter = BiQuadFilter<FloatType>;
+		using HalfBandFIR = HalfBandFIR<FloatType>;
+		using HalfBandIIR = HalfBandIIR<FloatType>;
+		using AlignedBuffer = utils::AlignedBuffer<FloatType>;
 
 	  public:
-		constexpr OverSampler() noexcept = default;
-		constexpr explicit OverSampler(Hertz sampleRate) noexcept : mSampleRate(sampleRate) {
+		OverSampler() noexcept {
+			setSampleRate(mSampleRate);
+			designStages();
+		}
+		explicit OverSampler(
+			Hertz sampleRate,
+			OverSamplingMode mode = OverSamplingMode::LinearPhase,
+			OverSamplingSteepness steepness = OverSamplingSteepness::Steep) noexcept
+			: mMode(mode), mSteepness(steepness) {
 #ifdef TESTING_OVERSAMPLER
 			Logger::LogMessage("Creating Oversampler");
 #endif
+			setSampleRate(sampleRate);
+			designStages();
+		}
+		OverSampler(OverSampler&& overSampler) noexcept = default;
+
+		/// @brief Prepares this `OverSampler` for processing, allocating everything it needs.
+		/// Allocates, so must not be called on the audio thread
+		///
+		/// @param sampleRate - The (original) sample rate
+		/// @param maxBlockSize - The largest number of samples that will be oversampled at once
+		/// @param numChannels - The number of channels that will be oversampled
+		inline auto
+		prepare(Hertz sampleRate, size_t maxBlockSize, size_t numChannels) noexcept -> void {
+#ifdef TESTING_OVERSAMPLER
+			Logger::LogMessage("Preparing Oversampler");
+#endif
+			setSampleRate(sampleRate);
+			mMaxBlockSize = maxBlockSize;
+			mBufferSize = maxBlockSize;
+			// nothing is playing yet, so a pending factor takes effect straight away
+			mFactor = mPendingFactor;
+			mFactorSwitch = FactorSwitch::None;
+			mOverSampledSize = maxBlockSize * mFactor;
+			mNumChannels = General<size_t>::max(numChannels, 1);
+
+			// every channel starts on an aligned boundary, with room for the largest factor
+			constexpr auto alignment = AlignedBuffer::ALIGNMENT / sizeof(FloatType);
+			const auto maxOverSampledSize = maxBlockSize * OverSampleRate;
+			mOverSampledStride = ((maxOverSampledSize + alignment - 1) / alignment) * alignment;
+			mDownSampledStride = ((maxBlockSize + alignment - 1) / alignment) * alignment;
+			mOverSampled.resize(mOverSampledStride * mNumChannels);
+			mDownSampled.resize(mDownSampledStride * mNumChannels);
+			mStageInputs.resize(mNumChannels);
+			mStageOutputs.resize(mNumChannels);
+			for(auto& stage : mFIRStages) {
+				stage.prepare(mNumChannels);
+			}
+			for(auto& stage : mIIRStages) {
+				stage.prepare(mNumChannels);
+			}
+		}
+
+		/// @brief Returns the number of bytes used by this `OverSampler`, including its heap
+		/// allocations
+		///
+		/// @return - The memory footprint, in bytes
+		[[nodiscard]] inline auto getMemoryFootprint() const noexcept -> size_t {
+			auto footprint = sizeof(*this) + mOverSampled.getMemoryFootprint()
+							 + mDownSampled.getMemoryFootprint()
+							 + (mStageInputs.capacity() + mStageOutputs.capacity())
+								   * sizeof(Span<FloatType>);
+			// the stages themselves are already part of `sizeof(*this)`
+			for(const auto& stage : mFIRStages) {
+				footprint += stage.getMemoryFootprint() - sizeof(HalfBandFIR);
+			}
+			for(const auto& stage : mIIRStages) {
+				footprint += stage.getMemoryFootprint() - sizeof(HalfBandIIR);
+			}
+			return footprint;
 		}
-		constexpr OverSampler(OverSampler&& overSampler) noexcept = default;
 
 		[[nodiscard]] constexpr inline auto getSampleRate() const noexcept -> Hertz {
 			return mSampleRate;
 		}
 
+		/// @brief Returns the sample rate of the oversampled signal, at the factor in use
+		///
+		/// @return - The oversampled sample rate
 		[[nodiscard]] constexpr inline auto getOverSampledSampleRate() const noexcept -> Hertz {
-			return mSampleRate * OverSampleRate;
+			return mSampleRate * mFactor;
+		}
+
+		/// @brief Sets the oversampling factor. Doesn't allocate, so can be called on the audio
+		/// thread. The switch happens at a block boundary: the next block fades out at the
+		/// current factor, and the one after it runs at the new factor, fading back in
+		///
+		/// @param factor - The new factor, a power of two up to `OverSampleRate`. 1 bypasses the
+		/// filters
+		inline auto setFactor(size_t factor) noexcept -> void {
+			jassert(factor >= 1 && factor <= OverSampleRate && (factor & (factor - 1)) == 0);
+			mPendingFactor
+				= General<size_t>::min(General<size_t>::max(factor, 1), OverSampleRate);
+			if(mFactorSwitch == FactorSwitch::FadingOut) {
+				// the switch is already underway, it'll go to the latest factor
+				return;
+			}
+			if(mPendingFactor == mFactor) {
+				if(mFactorSwitch == FactorSwitch::Requested) {
+					mFactorSwitch = FactorSwitch::None;
+				}
+				return;
+			}
+			mFactorSwitch = FactorSwitch::Requested;
+		}
+
+		/// @brief Returns the oversampling factor in use
+		///
+		/// @return - The factor
+		[[nodiscard]] inline auto getFactor() const noexcept -> size_t {
+			return mFactor;
+		}
+
+		/// @brief Returns whether a factor switch is pending or fading in
+		///
+		/// @return - Whether the factor is being switched
+		[[nodiscard]] inline auto isSwitchingFactor() const noexcept -> bool {
+			return mFactorSwitch != FactorSwitch::None;
+		}
+
+		/// @brief Returns the delay of oversampling and then downsampling at the factor in use,
+		/// in samples at the original sample rate. Stages after the first add fractions of a
+		/// sample. In `LowLatency` mode this is the delay at low frequencies
+		///
+		/// @return - The latency, in samples
+		[[nodiscard]] inline auto getLatency() const noexcept -> FloatType {
+			auto latency = narrow_cast<FloatType>(0.0);
+			auto rate = narrow_cast<FloatType>(1.0);
+			const auto numStages = getNumStages();
+			for(size_t stage = 0; stage < numStages; ++stage) {
+				const auto stageLatency
+					= mMode == OverSamplingMode::LinearPhase ?
+						  narrow_cast<FloatType>(mFIRStages.at(stage).getLatency()) :
+						  mIIRStages.at(stage).getLatency();
+				latency += stageLatency / rate;
+				rate *= narrow_cast<FloatType>(2.0);
+			}
+			return latency;
+		}
+
+		/// @brief Sets the filters used for oversampling, resetting their state
+		///
+		/// @param mode - The filters to use
+		inline auto setMode(OverSamplingMode mode) noexcept -> void {
+			mMode = mode;
+			reset();
+		}
+
+		/// @brief Returns the filters used for oversampling
+		///
+		/// @return - The filters in use
+		[[nodiscard]] inline auto getMode() const noexcept -> OverSamplingMode {
+			return mMode;
+		}
+
+		/// @brief Sets the steepness of the filters, redesigning them and resetting their state.
+		/// Doesn't allocate
+		///
+		/// @param steepness - The new steepness
+		inline auto setSteepness(OverSamplingSteepness steepness) noexcept -> void {
+			mSteepness = steepness;
+			designStages();
+		}
+
+		/// @brief Returns the steepness of the filters
+		///
+		/// @return - The steepness
+		[[nodiscard]] inline auto getSteepness() const noexcept -> OverSamplingSteepness {
+			return mSteepness;
 		}
 
-		constexpr inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
+		inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
 #ifdef TESTING_OVERSAMPLER
 			Logger::LogMessage("Updating Oversampler Sample Rate");
 #endif
+			// the half-band stages are relative to the sample rate, so there is nothing to
+			// redesign
 			mSampleRate = sampleRate;
-			mPreAntiAliasFilter.setSampleRate(mSampleRate * OverSampleRate);
-			mPreAntiAliasFilter.setFrequency(narrow_cast<FloatType>(mSampleRate)
-											 / narrow_cast<FloatType>(2.0));
-			mPostAntiAliasFilter.setSampleRate(mSampleRate * OverSampleRate);
-			mPostAntiAliasFilter.setFrequency(narrow_cast<FloatType>(mSampleRate)
-											  / narrow_cast<FloatType>(2.0));
+			mFadeLength = General<size_t>::max(
+				static_cast<size_t>(static_cast<double>(sampleRate) * FACTOR_FADE_TIME),
+				1);
 		}
 
+		/// @brief Sets the number of samples oversampled at once, at most the `maxBlockSize` this
+		/// was prepared for
+		///
+		/// @param bufferSize - The block size
 		constexpr inline auto setBufferSize(size_t bufferSize) noexcept -> void {
 #ifdef TESTING_OVERSAMPLER
 			Logger::LogMessage("Updating Oversampler Buffer Size");
 #endif
-			mBufferSize = bufferSize;
-			mOverSampledSize = OverSampleRate * bufferSize;
+			jassert(bufferSize <= mMaxBlockSize);
+			mBufferSize = General<size_t>::min(bufferSize, mMaxBlockSize);
+			mOverSampledSize = mFactor * mBufferSize;
 		}
 
-		constexpr inline auto reset() noexcept -> void {
+		inline auto reset() noexcept -> void {
 #ifdef TESTING_OVERSAMPLER
 			Logger::LogMessage("Resetting Oversampler");
 #endif
 
-			mPreAntiAliasFilter.reset();
-			mPostAntiAliasFilter.reset();
-			for(auto& sample : mOverSampled) {
-				sample = narrow_cast<FloatType>(0.0);
+			for(auto& stage : mFIRStages) {
+				stage.reset();
 			}
-			for(auto& sample : mDownSampled) {
-				sample = narrow_cast<FloatType>(0.0);
+			for(auto& stage : mIIRStages) {
+				stage.reset();
 			}
+			mOverSampled.fill(narrow_cast<FloatType>(0.0));
+			mDownSampled.fill(narrow_cast<FloatType>(0.0));
 		}
 
-		[[nodiscard]] constexpr inline auto
-		overSample(Span<FloatType> input) noexcept -> Span<FloatType> {
-			jassert(input.size() <= mOverSampled.size() / OverSampleRate);
+		/// @brief Oversamples the given input, for the given channel
+		///
+		/// @param input - The input to oversample, at most the current buffer size
+		/// @param channel - The channel the input belongs to
+		///
+		/// @return - The oversampled signal, valid until the next call for this channel
+		[[nodiscard]] inline auto
+		overSample(Span<FloatType> input, size_t channel = 0) noexcept -> Span<FloatType> {
+			jassert(input.size() <= mBufferSize && channel < mNumChannels);
+			overSampleBlock(input.data(), General<size_t>::min(input.size(), mBufferSize), channel);
+			return getOverSampled(channel);
+		}
 
-#ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Oversampler Copying Samples from input to oversample buffer");
-#endif
+		/// @brief Oversamples the given input, for the given channel
+		///
+		/// @param input - The input to oversample, at most the current buffer size
+		/// @param channel - The channel the input belongs to
+		///
+		/// @return - The oversampled signal, valid until the next call for this channel
+		[[nodiscard]] inline auto overSample(Span<const FloatType> input,
+											 size_t channel = 0) noexcept -> Span<const FloatType> {
+			jassert(input.size() <= mBufferSize && channel < mNumChannels);
+			overSampleBlock(input.data(), General<size_t>::min(input.size(), mBufferSize), channel);
+			auto overSampled = getOverSampled(channel);
+			return Span<const FloatType>::MakeSpan(overSampled.data(), overSampled.size());
+		}
 
-			auto inputSize = General<FloatType>::min(input.size(), mBufferSize);
-			for(size_t index = 0, overSampledIndex = 0; index < inputSize;
-				++index, overSampledIndex += OverSampleRate)
-			{
-				if(overSampledIndex < mOverSampledSize) {
-					mOverSampled.at(overSampledIndex) = input.at(index);
+		/// @brief Oversamples every channel of `input` at once, into the matching channels of
+		/// this. The oversampled signals are then available from `getOverSampled`
+		///
+		/// @param input - The channels to oversample, each the same size, at most the current
+		/// buffer size, and at most the number of channels this was prepared for
+		inline auto overSample(Span<const Span<const FloatType>> input) noexcept -> void {
+			jassert(input.size() <= mNumChannels);
+			const auto numChannels = General<size_t>::min(input.size(), mNumChannels);
+			if(numChannels == 0) {
+				return;
+			}
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto& firstChannel = input.data()[0];
+			jassert(firstChannel.size() <= mBufferSize);
+			const auto inputSize = General<size_t>::min(firstChannel.size(), mBufferSize);
+			beginBlock(inputSize);
+			mOverSampledSize = inputSize * mFactor;
+
+			// the same in-place, end-aligned layout as `overSampleBlock`, for every channel
+			auto stageSize = inputSize;
+			auto stageOffset = mOverSampledSize - inputSize;
+			for(size_t channel = 0; channel < numChannels; ++channel) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto& from = input.data()[channel];
+				jassert(from.size() == inputSize);
+				auto to = getOverSampled(channel).subspan(stageOffset, inputSize);
+				for(size_t index = 0; index < inputSize; ++index) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					to.at(index) = from.data()[index];
 				}
 			}
 
+			const auto numStages = getNumStages();
+			for(size_t stage = 0; stage < numStages; ++stage) {
+				for(size_t channel = 0; channel < numChannels; ++channel) {
+					auto buffer = getOverSampled(channel);
+					mStageInputs.at(channel) = buffer.subspan(stageOffset, stageSize);
+					mStageOutputs.at(channel) = buffer.subspan(stageOffset - stageSize,
+															   stageSize * 2);
+				}
+				if(mMode == OverSamplingMode::LinearPhase) {
+					// each FIR already fills the vector lanes within a channel, so the channels
+					// run one at a time
+					for(size_t channel = 0; channel < numChannels; ++channel) {
+						mFIRStages.at(stage).upSample(mStageInputs.at(channel),
+													  mStageOutputs.at(channel),
+													  channel);
+					}
+				}
+				else {
+					mIIRStages.at(stage).upSample(
+						Span<const Span<FloatType>>::MakeSpan(mStageInputs.data(), numChannels),
+						Span<const Span<FloatType>>::MakeSpan(mStageOutputs.data(), numChannels));
+				}
+				stageOffset -= stageSize;
+				stageSize *= 2;
+			}
+		}
+
+		/// @brief Downsamples the oversampled signal of the given channel (as returned by, and
+		/// possibly modified after, the last call to `overSample` for it)
+		///
+		/// @param channel - The channel to downsample
+		///
+		/// @return - The downsampled signal
+		inline auto downSample(size_t channel = 0) noexcept -> Span<FloatType> {
+#ifdef TESTING_OVERSAMPLER
+			Logger::LogMessage("Downsampling from" + juce::String(mFactor) + "X Oversampling");
+#endif
+			jassert(channel < mNumChannels);
+			const auto outputSize = mOverSampledSize / mFactor;
+			auto output = Span<FloatType>::MakeSpan(
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				mDownSampled.data() + channel * mDownSampledStride,
+				outputSize);
+			auto overSampled = getOverSampled(channel);
 #ifdef TESTING_OVERSAMPLER
 			Logger::LogMessage("Oversampler Processing With Antialias filter");
 #endif
-			auto span = Span<FloatType>::MakeSpan(mOverSampled.data(), mOverSampled.size())
-							.first(mOverSampledSize);
-			mPreAntiAliasFilter.process(span, span);
+			// the stages run in reverse, in place, with the first (steepest) one writing the
+			// output
+			auto stageSize = mOverSampledSize;
+			for(auto stage = getNumStages(); stage > 0; --stage) {
+				auto buffer = overSampled.first(stageSize);
+				downSampleStage(channel,
+								stage - 1,
+								buffer,
+								stage > 1 ? buffer.first(stageSize / 2) : output);
+				stageSize /= 2;
+			}
+			if(mFactor == 1) {
+				copy(overSampled, output);
+			}
+			applyFade(output);
 #ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Finished Oversampling");
+			Logger::LogMessage("Finished Downsampling");
 #endif
-			return span;
+			return output;
+		}
+
+		/// @brief Downsamples the oversampled signals of the first `output.size()` channels at
+		/// once (as oversampled by, and possibly modified after, the last call to `overSample`)
+		///
+		/// @param output - The channels to store the downsampled signals in, each the size of
+		/// the input to the last call to `overSample`
+		inline auto downSample(Span<const Span<FloatType>> output) noexcept -> void {
+			jassert(output.size() <= mNumChannels);
+			const auto numChannels = General<size_t>::min(output.size(), mNumChannels);
+			if(numChannels == 0) {
+				return;
+			}
+			// the stages run in reverse, in place, with the first (steepest) one writing the
+			// output
+			auto stageSize = mOverSampledSize;
+			for(auto stage = getNumStages(); stage > 0; --stage) {
+				for(size_t channel = 0; channel < numChannels; ++channel) {
+					auto buffer = getOverSampled(channel);
+					mStageInputs.at(channel) = buffer.first(stageSize);
+					if(stage > 1) {
+						mStageOutputs.at(channel) = buffer.first(stageSize / 2);
+					}
+					else {
+						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+						mStageOutputs.at(channel) = output.data()[channel];
+						jassert(mStageOutputs.at(channel).size() == stageSize / 2);
+					}
+				}
+				if(mMode == OverSamplingMode::LinearPhase) {
+					for(size_t channel = 0; channel < numChannels; ++channel) {
+						mFIRStages.at(stage - 1).downSample(mStageInputs.at(channel),
+															mStageOutputs.at(channel),
+															channel);
+					}
+				}
+				else {
+					mIIRStages.at(stage - 1).downSample(
+						Span<const Span<FloatType>>::MakeSpan(mStageInputs.data(), numChannels),
+						Span<const Span<FloatType>>::MakeSpan(mStageOutputs.data(), numChannels));
+				}
+				stageSize /= 2;
+			}
+			for(size_t channel = 0; channel < numChannels; ++channel) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				const auto& to = output.data()[channel];
+				if(mFactor == 1) {
+					jassert(to.size() == mOverSampledSize);
+					copy(getOverSampled(channel), to);
+				}
+				applyFade(to);
+			}
 		}
 
-		[[nodiscard]] constexpr inline auto
-		overSample(Span<const FloatType> input) noexcept -> Span<const FloatType> {
-			jassert(input.size() <= mOverSampled.size() / OverSampleRate);
+		/// @brief Returns the current oversampled signal of the given channel, as returned by the
+		/// last call to `overSample` for it, to be processed in place before `downSample`
+		///
+		/// @param channel - The channel
+		///
+		/// @return - The oversampled signal
+		[[nodiscard]] inline auto getOverSampled(size_t channel = 0) noexcept -> Span<FloatType> {
+			jassert(channel < mNumChannels);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return Span<FloatType>::MakeSpan(mOverSampled.data() + channel * mOverSampledStride,
+											 mOverSampledSize);
+		}
 
-#ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Oversampler Copying Samples from input to oversample buffer");
-#endif
+		inline auto operator=(OverSampler&& overSampler) noexcept -> OverSampler& = default;
 
-			auto inputSize = General<FloatType>::min(input.size(), mBufferSize);
-			for(size_t index = 0, overSampledIndex = 0; index < inputSize;
-				++index, overSampledIndex += OverSampleRate)
-			{
-				if(overSampledIndex < mOverSampledSize) {
-					mOverSampled.at(overSampledIndex) = input.at(index);
+	  private:
+		/// The number of 2x stages
+		static const constexpr size_t NUM_STAGES = OverSampleRate == 2 ?
+													   1 :
+													   (OverSampleRate == 4 ?
+															2 :
+															(OverSampleRate == 8 ? 3 : 4));
+		/// How long the fades out of and back into a factor switch each take, in seconds
+		static constexpr double FACTOR_FADE_TIME = 0.002;
+		/// The kept band and stopband attenuation of each `OverSamplingSteepness`
+		static constexpr std::array<std::pair<double, double>, 3> STEEPNESS_DESIGNS
+			= {std::pair<double, double>(0.40, 70.0),
+			   std::pair<double, double>(0.43, 90.0),
+			   std::pair<double, double>(0.45, 100.0)};
+
+		/// The 2x stages of each mode, from the original sample rate upwards
+		using FIRStages = std::array<HalfBandFIR, NUM_STAGES>;
+		using IIRStages = std::array<HalfBandIIR, NUM_STAGES>;
+
+		Hertz mSampleRate = 44.1_kHz;
+		size_t mMaxBlockSize = 0U;
+		size_t mBufferSize = 0U;
+		size_t mOverSampledSize = 0U;
+		size_t mNumChannels = 1U;
+		OverSamplingMode mMode = OverSamplingMode::LinearPhase;
+
+		/// The stages of a factor switch, advanced at the start of each block
+		enum class FactorSwitch
+		{
+			None = 0,
+			/// A new factor was set since the last block started
+			Requested,
+			/// The current block runs at the old factor and fades out
+			FadingOut,
+			/// The current block runs at the new factor and fades in
+			FadingIn
+		};
+
+		size_t mFactor = OverSampleRate;
+		size_t mPendingFactor = OverSampleRate;
+		FactorSwitch mFactorSwitch = FactorSwitch::None;
+		/// The length of each fade, in samples at the original sample rate
+		size_t mFadeLength = 1U;
+		/// How far into the fade in the current block starts
+		size_t mFadePosition = 0U;
+		/// How long the fade in stays silent, in samples at the original sample rate
+		size_t mFadeHold = 0U;
+		/// The size of the current block, at the original sample rate
+		size_t mBlockSize = 0U;
+		OverSamplingSteepness mSteepness = OverSamplingSteepness::Steep;
+		/// The stages, shared by every channel
+		FIRStages mFIRStages = FIRStages();
+		IIRStages mIIRStages = IIRStages();
+		/// The per-channel inputs and outputs of the stage being run, when running every channel
+		/// at once
+		std::vector<Span<FloatType>> mStageInputs = std::vector<Span<FloatType>>();
+		std::vector<Span<FloatType>> mStageOutputs = std::vector<Span<FloatType>>();
+		/// The planar buffers, each channel `m*Stride` samples after the previous one
+		AlignedBuffer mOverSampled = AlignedBuffer();
+		AlignedBuffer mDownSampled = AlignedBuffer();
+		size_t mOverSampledStride = 0U;
+		size_t mDownSampledStride = 0U;
+
+		/// @brief Returns the number of 2x stages used at the current factor
+		///
+		/// @return - The number of stages
+		[[nodiscard]] inline auto getNumStages() const noexcept -> size_t {
+			auto numStages = static_cast<size_t>(0);
+			for(auto factor = mFactor; factor > 1; factor /= 2) {
+				++numStages;
+			}
+			return numStages;
+		}
+
+		/// @brief Advances any factor switch at the start of a block
+		///
+		/// @param blockSize - The size of the block, at the original sample rate
+		inline auto beginBlock(size_t blockSize) noexcept -> void {
+			switch(mFactorSwitch) {
+				case FactorSwitch::None: break;
+				case FactorSwitch::Requested: mFactorSwitch = FactorSwitch::FadingOut; break;
+				case FactorSwitch::FadingOut: {
+					// the stages above the old factor's haven't run since they were last used,
+					// so their state is stale
+					for(auto stage = getNumStages(); stage < NUM_STAGES; ++stage) {
+						mFIRStages.at(stage).reset();
+						mIIRStages.at(stage).reset();
+					}
+					mFactor = mPendingFactor;
+					mFactorSwitch = FactorSwitch::FadingIn;
+					mFadePosition = 0;
+					// the last stage downsampling still holds the signal from before the
+					// switch, at the old factor's delay, so it's flushed before fading in
+					mFadeHold = static_cast<size_t>(
+						std::ceil(static_cast<double>(getLatency())));
+					break;
+				}
+				case FactorSwitch::FadingIn: {
+					mFadePosition += mBlockSize;
+					if(mFadePosition >= mFadeHold + mFadeLength) {
+						mFactorSwitch = FactorSwitch::None;
+					}
+					break;
 				}
 			}
+			mBlockSize = blockSize;
+		}
 
-#ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Oversampler Processing With Antialias filter");
-#endif
-			auto span = Span<FloatType>::MakeSpan(mOverSampled.data(), mOverSampled.size())
-							.first(mOverSampledSize);
-			mPreAntiAliasFilter.process(span, span);
-#ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Finished Oversampling");
-#endif
-			auto output = Span<const FloatType>::MakeSpan(mOverSampled.data(), mOverSampled.size())
-							  .first(mOverSampledSize);
-			return output;
+		/// @brief Applies the fade of the current block of a factor switch to the given output
+		///
+		/// @param output - The downsampled signal of a channel
+		inline auto applyFade(Span<FloatType> output) const noexcept -> void {
+			const auto size = output.size();
+			if(mFactorSwitch == FactorSwitch::FadingOut) {
+				// fade to silence by the end of the block
+				const auto length = General<size_t>::min(mFadeLength, size);
+				for(auto index = size - length; index < size; ++index) {
+					output.at(index) *= narrow_cast<FloatType>(size - 1 - index)
+										/ narrow_cast<FloatType>(length);
+				}
+			}
+			else if(mFactorSwitch == FactorSwitch::FadingIn) {
+				const auto end = mFadeHold + mFadeLength;
+				const auto length = General<size_t>::min(end - mFadePosition, size);
+				for(size_t index = 0; index < length; ++index) {
+					const auto position = mFadePosition + index;
+					output.at(index) *= position < mFadeHold ?
+											narrow_cast<FloatType>(0.0) :
+											narrow_cast<FloatType>(position - mFadeHold)
+												/ narrow_cast<FloatType>(mFadeLength);
+				}
+			}
+		}
+
+		/// @brief Copies the start of `from` into `to`
+		///
+		/// @param from - The values to copy
+		/// @param to - The destination, at most the size of `from`
+		static inline auto copy(Span<FloatType> from, Span<FloatType> to) noexcept -> void {
+			for(size_t index = 0; index < to.size(); ++index) {
+				to.at(index) = from.at(index);
+			}
+		}
+
+		/// @brief Designs the half-band stages of both modes for the current steepness. Each
+		/// stage's transition band spans from the top of the kept band to its mirror image around
+		/// the stage's Nyquist
+		inline auto designStages() noexcept -> void {
+			const auto [passband, attenuation]
+				= STEEPNESS_DESIGNS.at(static_cast<size_t>(mSteepness));
+			auto stageRate = 2.0;
+			for(size_t stage = 0; stage < NUM_STAGES; ++stage) {
+				const auto transitionWidth
+					= narrow_cast<FloatType>(0.5 - 2.0 * passband / stageRate);
+				mFIRStages.at(stage).setDesign(transitionWidth, Decibels(attenuation));
+				mIIRStages.at(stage).setDesign(transitionWidth, Decibels(attenuation));
+				stageRate *= 2.0;
+			}
+		}
+
+		/// @brief Downsamples through the given stage of the current mode
+		///
+		/// @param channel - The channel being downsampled
+		/// @param stage - The index of the stage
+		/// @param input - The input to the stage
+		/// @param output - The output of the stage, half the size of `input`
+		inline auto downSampleStage(size_t channel,
+									size_t stage,
+									Span<FloatType> input,
+									Span<FloatType> output) noexcept -> void {
+			if(mMode == OverSamplingMode::LinearPhase) {
+				mFIRStages.at(stage).downSample(input, output, channel);
+			}
+			else {
+				mIIRStages.at(stage).downSample(input, output, channel);
+			}
 		}
 
-		constexpr inline auto downSample() noexcept -> Span<FloatType> {
+		/// @brief Oversamples `inputSize` samples from `input` into the given channel of
+		/// `mOverSampled`
+		///
+		/// @param input - Pointer to the input samples
+		/// @param inputSize - The number of input samples
+		/// @param channel - The channel to oversample
+		inline auto overSampleBlock(const FloatType* input,
+									size_t inputSize,
+									size_t channel) noexcept -> void {
 #ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Downsampling from" + juce::String(OverSampleRate)
-							   + "X Oversampling");
+			Logger::LogMessage("Oversampler Copying Samples from input to oversample buffer");
 #endif
-			Span<FloatType> input
-				= Span<FloatType>::MakeSpan(mOverSampled.data(), mOverSampled.size())
-					  .first(mOverSampledSize);
-			Span<FloatType> output
-				= Span<FloatType>::MakeSpan(mDownSampled.data(), mDownSampled.size())
-					  .first(mBufferSize);
-			jassert(output.size() <= (input.size() / OverSampleRate));
+			// every stage works in place: its input is the upper half of its output, so the
+			// input starts at the end of the buffer and each stage's output fills the region
+			// below it, ending with the last stage filling the start of the buffer
+			if(channel == 0) {
+				beginBlock(inputSize);
+			}
+			mOverSampledSize = inputSize * mFactor;
+			auto stageSize = inputSize;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			auto* stageInput = getOverSampled(channel).data() + mOverSampledSize - inputSize;
+			for(size_t index = 0; index < inputSize; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				stageInput[index] = input[index];
+			}
+
 #ifdef TESTING_OVERSAMPLER
 			Logger::LogMessage("Oversampler Processing With Antialias filter");
 #endif
-			mPostAntiAliasFilter.process(input, input);
-#ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Oversampler Copying oversample buffer samples to output buffer");
-#endif
-			for(size_t index = 0, overSampledIndex = 0; index < mBufferSize;
-				++index, overSampledIndex += OverSampleRate)
-			{
-				if(overSampledIndex < mOverSampledSize) {
-					output.at(index) = input.at(overSampledIndex);
+			const auto numStages = getNumStages();
+			for(size_t stage = 0; stage < numStages; ++stage) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				auto* stageOutput = stageInput - stageSize;
+				auto from = Span<FloatType>::MakeSpan(stageInput, stageSize);
+				auto to = Span<FloatType>::MakeSpan(stageOutput, stageSize * 2);
+				if(mMode == OverSamplingMode::LinearPhase) {
+					mFIRStages.at(stage).upSample(from, to, channel);
+				}
+				else {
+					mIIRStages.at(stage).upSample(from, to, channel);
 				}
+				stageInput = stageOutput;
+				stageSize *= 2;
 			}
 #ifdef TESTING_OVERSAMPLER
-			Logger::LogMessage("Finished Downsampling");
+			Logger::LogMessage("Finished Oversampling");
 #endif
-			return output;
 		}
 
-		constexpr inline auto
-		operator=(OverSampler&& overSampler) noexcept -> OverSampler& = default;
-
-	  private:
-		static const constexpr size_t DOWNSAMPLED_MAX_BUFFER = 16384U;
-		Hertz mSampleRate = 44.1_kHz;
-		size_t mBufferSize = 1024U;
-		size_t mOverSampledSize = mBufferSize * OverSampleRate;
-		BiQuadFilter mPreAntiAliasFilter = BiQuadFilter::MakeLowpass(
-			narrow_cast<FloatType>(mSampleRate) / narrow_cast<FloatType>(2.0),
-			mSampleRate* OverSampleRate);
-		BiQuadFilter mPostAntiAliasFilter = BiQuadFilter::MakeLowpass(
-			narrow_cast<FloatType>(mSampleRate) / narrow_cast<FloatType>(2.0),
-			mSampleRate* OverSampleRate);
-		std::array<FloatType, DOWNSAMPLED_MAX_BUFFER* OverSampleRate> mOverSampled
-			= std::array<FloatType, DOWNSAMPLED_MAX_BUFFER * OverSampleRate>();
-		std::array<FloatType, DOWNSAMPLED_MAX_BUFFER> mDownSampled
-			= std::array<FloatType, DOWNSAMPLED_MAX_BUFFER>();
-
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OverSampler)
 	};
 } // namespace apex::dsp
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../base/StandardIncludes.h"
+#include "OverSampler.h"
+#include "Processor.h"
+
+namespace apex::dsp {
+	/// @brief Deduces the floating point type a `Processor` operates on
+	///
+	/// @tparam P - The `Processor` type
+	template<typename P>
+	struct ProcessorTraits {
+	  private:
+		template<typename Type>
+		static auto deduce(const Processor<Type>* processor) -> Type;
+
+	  public:
+		using FloatType = decltype(deduce(std::declval<const P*>()));
+	};
+
+	/// @brief Deduces the floating point type a `Processor` operates on, for processors
+	/// templated on it the same way the Apex processors are (which doesn't depend on them
+	/// deriving publicly from `Processor`)
+	///
+	/// @tparam P - The `Processor` template
+	/// @tparam Type - The floating point type
+	template<template<typename, bool> typename P, typename Type, bool Enable>
+	struct ProcessorTraits<P<Type, Enable>> {
+		using FloatType = Type;
+	};
+
+	/// @brief Runs a `Processor` at `Factor` times the sample rate.
+	///
+	/// Oversamples its input (both channels at once, when processing stereo), processes the
+	/// oversampled signal in place with the wrapped processor, and downsamples the result. The
+	/// wrapped processor runs at the oversampled rate, so `setSampleRate` and `prepare` forward
+	/// the oversampled rate to it (when it has a `setSampleRate`).
+	///
+	/// The wrapped processor can be a chain of processors itself, so a whole chain only pays for
+	/// oversampling once
+	///
+	/// The factor can be switched at run time with `setFactor`, up to `Factor`. The wrapped
+	/// processor's sample rate follows the switch, at the first block at the new factor
+	///
+	/// @tparam P - The type of the `Processor` to wrap
+	/// @tparam Factor - The largest oversampling factor, a power of two up to 16
+	template<typename P, size_t Factor = 2>
+	class OversampledProcessor final : public Processor<typename ProcessorTraits<P>::FloatType> {
+	  public:
+		using FloatType = typename ProcessorTraits<P>::FloatType;
+
+	  private:
+		using Processor = Processor<FloatType>;
+		using OverSampler = OverSampler<FloatType, Factor>;
+
+	  public:
+		/// @brief Constructs an `OversampledProcessor`, constructing the wrapped processor from
+		/// the given arguments
+		///
+		/// @param args - The arguments to construct the wrapped processor with
+		template<typename... Args>
+		explicit OversampledProcessor(Args&&... args) noexcept
+			: mProcessor(std::forward<Args>(args)...) {
+		}
+
+		/// @brief Move constructs the given `OversampledProcessor`
+		///
+		/// @param processor - The `OversampledProcessor` to move
+		OversampledProcessor(OversampledProcessor&& processor) noexcept = default;
+		~OversampledProcessor() noexcept final = default;
+
+		/// @brief Prepares this for processing, allocating the oversampling buffers and setting
+		/// the sample rate of the wrapped processor. Allocates, so must not be called on the
+		/// audio thread
+		///
+		/// @param sampleRate - The (original) sample rate
+		/// @param maxBlockSize - The largest number of samples that will be processed at once
+		inline auto prepare(Hertz sampleRate, size_t maxBlockSize) noexcept -> void {
+			mOverSampler.prepare(sampleRate, maxBlockSize, Processor::MAX_CHANNELS);
+			setSampleRate(sampleRate);
+		}
+
+		/// @brief Sets the (original) sample rate, forwarding the oversampled rate to the wrapped
+		/// processor
+		///
+		/// @param sampleRate - The new sample rate
+		inline auto setSampleRate(Hertz sampleRate) noexcept -> void {
+			mOverSampler.setSampleRate(sampleRate);
+			forwardSampleRate();
+		}
+
+		/// @brief Sets the oversampling factor. Doesn't allocate, so can be called on the audio
+		/// thread. The switch happens at a block boundary, with a short fade out and back in
+		///
+		/// @param factor - The new factor, a power of two up to `Factor`. 1 bypasses
+		/// oversampling
+		inline auto setFactor(size_t factor) noexcept -> void {
+			mOverSampler.setFactor(factor);
+		}
+
+		/// @brief Returns the oversampling factor in use
+		///
+		/// @return - The factor
+		[[nodiscard]] inline auto getFactor() const noexcept -> size_t {
+			return mOverSampler.getFactor();
+		}
+
+		/// @brief Returns the (original) sample rate
+		///
+		/// @return - The sample rate
+		[[nodiscard]] inline auto getSampleRate() const noexcept -> Hertz {
+			return mOverSampler.getSampleRate();
+		}
+
+		/// @brief Returns the delay added by this at the factor in use, in samples at the original
+		/// sample rate: the oversampling round trip, plus the wrapped processor's own latency
+		/// (when it has a `getLatency`). Changes when a factor switch takes effect, so hosts
+		/// should be told about it then
+		///
+		/// @return - The latency, in samples
+		[[nodiscard]] inline auto getLatency() const noexcept -> FloatType {
+			auto latency = mOverSampler.getLatency();
+			if constexpr(requires(const P processor) { processor.getLatency(); }) {
+				latency += narrow_cast<FloatType>(mProcessor.getLatency())
+						   / narrow_cast<FloatType>(mOverSampler.getFactor());
+			}
+			return latency;
+		}
+
+		/// @brief Returns the wrapped processor
+		///
+		/// @return - The wrapped processor
+		[[nodiscard]] inline auto getProcessor() noexcept -> P& {
+			return mProcessor;
+		}
+
+		/// @brief Returns the wrapped processor
+		///
+		/// @return - The wrapped processor
+		[[nodiscard]] inline auto getProcessor() const noexcept -> const P& {
+			return mProcessor;
+		}
+
+		/// @brief Returns the `OverSampler`, eg. to change its mode
+		///
+		/// @return - The `OverSampler`
+		[[nodiscard]] inline auto getOverSampler() noexcept -> OverSampler& {
+			return mOverSampler;
+		}
+
+		[[nodiscard]] inline auto processMono(FloatType input) noexcept -> FloatType final {
+			auto output = narrow_cast<FloatType>(0.0);
+			processMono(Span<const FloatType>::MakeSpan(&input, 1),
+						Span<FloatType>::MakeSpan(&output, 1));
+			return output;
+		}
+
+		inline auto
+		processMono(Span<FloatType> input, Span<FloatType> output) noexcept -> void final {
+			processMono(Span<const FloatType>::MakeSpan(input.data(), input.size()), output);
+		}
+
+		inline auto
+		processMono(Span<const FloatType> input, Span<FloatType> output) noexcept -> void final {
+			jassert(input.size() == output.size());
+			static_cast<void>(mOverSampler.overSample(input, Processor::MONO));
+			followFactor();
+			auto overSampled = mOverSampler.getOverSampled(Processor::MONO);
+			mProcessor.processMono(overSampled, overSampled);
+			copy(mOverSampler.downSample(Processor::MONO), output);
+		}
+
+		[[nodiscard]] inline auto processStereo(FloatType inputLeft, FloatType inputRight) noexcept
+			-> std::tuple<FloatType, FloatType> final {
+			auto outputLeft = narrow_cast<FloatType>(0.0);
+			auto outputRight = narrow_cast<FloatType>(0.0);
+			processStereo(Span<const FloatType>::MakeSpan(&inputLeft, 1),
+						  Span<const FloatType>::MakeSpan(&inputRight, 1),
+						  Span<FloatType>::MakeSpan(&outputLeft, 1),
+						  Span<FloatType>::MakeSpan(&outputRight, 1));
+			return {outputLeft, outputRight};
+		}
+
+		inline auto processStereo(Span<FloatType> inputLeft,
+								  Span<FloatType> inputRight,
+								  Span<FloatType> outputLeft,
+								  Span<FloatType> outputRight) noexcept -> void final {
+			processStereo(Span<const FloatType>::MakeSpan(inputLeft.data(), inputLeft.size()),
+						  Span<const FloatType>::MakeSpan(inputRight.data(), inputRight.size()),
+						  outputLeft,
+						  outputRight);
+		}
+
+		inline auto processStereo(Span<const FloatType> inputLeft,
+								  Span<const FloatType> inputRight,
+								  Span<FloatType> outputLeft,
+								  Span<FloatType> outputRight) noexcept -> void final {
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
+			const auto inputs = std::array<Span<const FloatType>, 2>{inputLeft, inputRight};
+			mOverSampler.overSample(
+				Span<const Span<const FloatType>>::MakeSpan(inputs.data(), inputs.size()));
+			followFactor();
+			auto left = mOverSampler.getOverSampled(Processor::LEFT);
+			auto right = mOverSampler.getOverSampled(Processor::RIGHT);
+			mProcessor.processStereo(left, right, left, right);
+			const auto outputs = std::array<Span<FloatType>, 2>{outputLeft, outputRight};
+			mOverSampler.downSample(
+				Span<const Span<FloatType>>::MakeSpan(outputs.data(), outputs.size()));
+		}
+
+		inline auto reset() noexcept -> void final {
+			mOverSampler.reset();
+			mProcessor.reset();
+		}
+
+		auto operator=(OversampledProcessor&& processor) noexcept
+			-> OversampledProcessor& = default;
+
+	  private:
+		P mProcessor;
+		OverSampler mOverSampler = OverSampler();
+		/// The factor the wrapped processor's sample rate was last set for
+		size_t mProcessorFactor = Factor;
+
+		/// @brief Sets the wrapped processor's sample rate (when it has a `setSampleRate`) to the
+		/// oversampled rate
+		inline auto forwardSampleRate() noexcept -> void {
+			mProcessorFactor = mOverSampler.getFactor();
+			if constexpr(requires(P processor, Hertz sampleRate) {
+							 processor.setSampleRate(sampleRate);
+						 })
+			{
+				mProcessor.setSampleRate(mOverSampler.getOverSampledSampleRate());
+			}
+		}
+
+		/// @brief Follows a factor switch that took effect at the start of the current block
+		inline auto followFactor() noexcept -> void {
+			if(mOverSampler.getFactor() != mProcessorFactor) {
+				forwardSampleRate();
+			}
+		}
+
+		/// @brief Copies `from` into `to`
+		///
+		/// @param from - The values to copy
+		/// @param to - The destination
+		static inline auto copy(Span<FloatType> from, Span<FloatType> to) noexcept -> void {
+			const auto size = General<size_t>::min(from.size(), to.size());
+			for(size_t index = 0; index < size; ++index) {
+				to.at(index) = from.at(index);
+			}
+		}
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OversampledProcessor)
+	};
+} // namespace apex::dsp
@@ -2,7 +2,6 @@
 
 #include <type_traits>
 #include <utility>
-#include <vector>
 
 #include "../../base/StandardIncludes.h"
 #include "EQBand.h"
@@ -17,11 +16,13 @@ namespace apex::dsp {
 	  private:
 		using EQBand = EQBand<FloatType>;
 		using Processor = Processor<FloatType>;
+		using BiQuadBank = BiQuadBank<FloatType, Processor::MAX_CHANNELS>;
+		using Design = typename EQBand::Design;
 
 	  public:
 		/// @brief Creates a default `ParallelEQBand`
 		ParallelEQBand() noexcept {
-			setGainDB(EQBand::mGain);
+			EQBand::setGainDB(EQBand::mGain);
 		}
 
 		/// @brief Creates a `ParallelEQBand` with the given parameters
@@ -37,7 +38,7 @@ namespace apex::dsp {
 					   Hertz sampleRate,
 					   BandType type) noexcept
 			: EQBand(frequency, q, gainDB, sampleRate, type) {
-			setGainDB(EQBand::mGain);
+			EQBand::setGainDB(EQBand::mGain);
 		}
 
 		/// @brief Move constructs a `ParallelEQBand` from the given one
@@ -46,53 +47,6 @@ namespace apex::dsp {
 		ParallelEQBand(ParallelEQBand&& band) noexcept = default;
 		~ParallelEQBand() noexcept override = default;
 
-		/// @brief Sets the gain of this `ParallelEQBand` to the given value
-		///
-		/// @param gainDB - The new gain, in Decibels
-		inline auto setGainDB(Decibels gainDB) noexcept -> void override {
-			auto one = narrow_cast<FloatType>(1.0);
-			if(EQBand::mType < BandType::Allpass) {
-				EQBand::mGain = gainDB;
-				mGainActual = EQBand::mGain;
-				EQBand::mGainProcessor.setGainDecibels(EQBand::mGain);
-				for(auto& channel : EQBand::mFilter) {
-					channel.setGainDB(EQBand::mGain);
-				}
-				for(auto& channel : EQBand::mFilters) {
-					for(auto& filt : channel) {
-						filt.setGainDB(EQBand::mGain);
-					}
-				}
-			}
-			else if(EQBand::mType < BandType::LowShelf) {
-				EQBand::mGain = gainDB;
-				mGainActual = EQBand::mGain;
-				EQBand::mGainProcessor.setGainDecibels(EQBand::mGain);
-				for(auto& channel : EQBand::mFilter) {
-					channel.setGainDB(EQBand::mGain);
-				}
-			}
-			else {
-				mGainActual = gainDB;
-				// if gain is negative, we need to subtract that amount of linear gain from the
-				// input to get the desired gain: linear 0db (eg 1.0) - linear gain level = amount
-				// of linear signal to be removed
-				if(gainDB < narrow_cast<FloatType>(0.0)) {
-					EQBand::mGain = Decibels::fromLinear(one - gainDB.getLinear());
-				}
-				// otherwise, the gain is the amount of linear gain we need to add to the input:
-				// linear gain level - linear 0db (eg 1.0) = amount of linear signal to be added
-				else {
-					EQBand::mGain = math::Decibels::linearToDecibels(gainDB.getLinear() - one);
-				}
-
-				EQBand::mGainProcessor.setGainDecibels(EQBand::mGain);
-				for(auto& channel : EQBand::mFilter) {
-					channel.setGainDB(EQBand::mGain);
-				}
-			}
-		}
-
 		/// @brief Returns the gain of this `ParallelEQBand`
 		///
 		/// @return - The current gain, in Decibels
@@ -100,7 +54,8 @@ namespace apex::dsp {
 			return mGainActual;
 		}
 
-		/// @brief Applies this `ParallelEQBand` to the given input value
+		/// @brief Applies this `ParallelEQBand` to the given input value. Designs published by
+		/// `publishDesign` are only picked up by `updateFiltersIfNeeded`
 		///
 		/// @param input - The input value to apply EQ to
 		///
@@ -108,19 +63,17 @@ namespace apex::dsp {
 		[[nodiscard]] inline auto processMono(FloatType input) noexcept -> FloatType override {
 			auto x = input;
 			if(EQBand::mType < BandType::Allpass) {
-				for(auto& filt : EQBand::mFilters.at(Processor::MONO)) {
-					x = filt.process(x);
-				}
-				x = EQBand::mGainProcessor.process(x);
+				x = EQBand::mFilters.at(Processor::MONO).process(x);
+				x = EQBand::mGainProcessor.processMono(x);
 			}
 			else if(EQBand::mType < BandType::LowShelf) {
-				x = EQBand::mFilter.at(Processor::MONO).process(x);
-				x = EQBand::mGainProcessor.process(x);
+				x = EQBand::mFilter.processLane(Processor::MONO, x);
+				x = EQBand::mGainProcessor.processMono(x);
 			}
 			else {
-				x = EQBand::mFilter.at(Processor::MONO).process(x);
-				x = EQBand::mGainProcessor.process(x);
-				if(mGainActual < narrow_cast<FloatType>(0.0)) {
+				x = EQBand::mFilter.processLane(Processor::MONO, x);
+				x = EQBand::mGainProcessor.processMono(x);
+				if(mAppliedGainActual < narrow_cast<FloatType>(0.0)) {
 					x = input - x;
 				}
 				else {
@@ -137,9 +90,10 @@ namespace apex::dsp {
 		inline auto
 		processMono(Span<FloatType> input, Span<FloatType> output) noexcept -> void override {
 			jassert(input.size() == output.size());
+			EQBand::updateFiltersIfNeeded();
 			auto size = input.size();
 			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = process(input.at(i));
+				output.at(i) = processMono(input.at(i));
 			}
 		}
 
@@ -150,13 +104,15 @@ namespace apex::dsp {
 		inline auto
 		processMono(Span<const FloatType> input, Span<FloatType> output) noexcept -> void override {
 			jassert(input.size() == output.size());
+			EQBand::updateFiltersIfNeeded();
 			auto size = input.size();
 			for(auto i = 0U; i < size; ++i) {
-				output.at(i) = process(input.at(i));
+				output.at(i) = processMono(input.at(i));
 			}
 		}
 
-		/// @brief Applies this `ParallelEQBand` to the given arrays of input values
+		/// @brief Applies this `ParallelEQBand` to the given arrays of input values. Designs
+		/// published by `publishDesign` are only picked up by `updateFiltersIfNeeded`
 		///
 		/// @param inputLeft - The left channel sample to apply EQ to
 		/// @param inputRight - The right channel sample to apply EQ to
@@ -167,27 +123,27 @@ namespace apex::dsp {
 			auto left = inputLeft;
 			auto right = inputRight;
 			if(EQBand::mType < BandType::Allpass) {
-				for(auto& filt : EQBand::mFilters.at(Processor::LEFT)) {
-					left = filt.process(left);
-				}
-				for(auto& filt : EQBand::mFilters.at(Processor::RIGHT)) {
-					right = filt.process(right);
-				}
-				left = EQBand::mGainProcessor.process(left);
-				right = EQBand::mGainProcessor.process(right);
+				left = EQBand::mFilters.at(Processor::LEFT).process(left);
+				right = EQBand::mFilters.at(Processor::RIGHT).process(right);
+				left = EQBand::mGainProcessor.processMono(left);
+				right = EQBand::mGainProcessor.processMono(right);
 			}
 			else if(EQBand::mType < BandType::LowShelf) {
-				left = EQBand::mFilter.at(Processor::LEFT).process(left);
-				right = EQBand::mFilter.at(Processor::LEFT).process(right);
-				left = EQBand::mGainProcessor.process(left);
-				right = EQBand::mGainProcessor.process(right);
+				auto frame = std::array<FloatType, Processor::MAX_CHANNELS>({left, right});
+				EQBand::mFilter.processFrame(frame);
+				left = frame.at(Processor::LEFT);
+				right = frame.at(Processor::RIGHT);
+				left = EQBand::mGainProcessor.processMono(left);
+				right = EQBand::mGainProcessor.processMono(right);
 			}
 			else {
-				left = EQBand::mFilter.at(Processor::MONO).process(left);
-				right = EQBand::mFilter.at(Processor::MONO).process(right);
-				left = EQBand::mGainProcessor.process(left);
-				right = EQBand::mGainProcessor.process(right);
-				if(mGainActual < narrow_cast<FloatType>(0.0)) {
+				auto frame = std::array<FloatType, Processor::MAX_CHANNELS>({left, right});
+				EQBand::mFilter.processFrame(frame);
+				left = frame.at(Processor::LEFT);
+				right = frame.at(Processor::RIGHT);
+				left = EQBand::mGainProcessor.processMono(left);
+				right = EQBand::mGainProcessor.processMono(right);
+				if(mAppliedGainActual < narrow_cast<FloatType>(0.0)) {
 					left = inputLeft - left;
 					right = inputRight - right;
 				}
@@ -209,8 +165,10 @@ namespace apex::dsp {
 								  Span<FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void override {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
+			EQBand::updateFiltersIfNeeded();
 			auto size = inputLeft.size();
 			for(auto i = 0U; i < size; ++i) {
 				auto [left, right] = processStereo(inputLeft.at(i), inputRight.at(i));
@@ -230,8 +188,10 @@ namespace apex::dsp {
 								  Span<const FloatType> inputRight,
 								  Span<FloatType> outputLeft,
 								  Span<FloatType> outputRight) noexcept -> void override {
-			jassert(inputLeft.size() == inputRight.size() == outputLeft.size()
-					== outputRight.size());
+			jassert(inputLeft.size() == inputRight.size()
+					&& inputLeft.size() == outputLeft.size()
+					&& inputLeft.size() == outputRight.size());
+			EQBand::updateFiltersIfNeeded();
 			auto size = inputLeft.size();
 			for(auto i = 0U; i < size; ++i) {
 				auto [left, right] = processStereo(inputLeft.at(i), inputRight.at(i));
@@ -250,12 +210,10 @@ namespace apex::dsp {
 		getMagnitudeForFrequency(Hertz frequency) const noexcept -> FloatType override {
 			auto x = narrow_cast<FloatType>(1.0);
 			if(EQBand::mType < BandType::Allpass) {
-				for(const auto& filt : EQBand::mFilters.at(Processor::LEFT)) {
-					x *= filt.getMagnitudeForFrequency(frequency);
-				}
+				x = EQBand::mFilters.at(Processor::LEFT).getMagnitudeForFrequency(frequency);
 			}
 			else if(EQBand::mType < BandType::LowShelf) {
-				x = EQBand::mFilter.at(Processor::LEFT).getMagnitudeForFrequency(frequency);
+				x = EQBand::mFilter.getMagnitudeForFrequency(frequency);
 			}
 			else if(EQBand::mType == BandType::LowShelf) {
 				BiQuadFilter<FloatType> filt
@@ -317,6 +275,37 @@ namespace apex::dsp {
 			}
 		}
 
+		/// @brief Calculates the linear magnitude response of this filter at every point of the
+		/// given grid, evaluating the whole grid at once
+		///
+		/// @param grid - The frequencies to calculate the magnitude response for
+		/// @param magnitudes - The array to store the magnitudes in
+		inline auto getMagnitudesForFrequencies(const ResponseGrid<FloatType>& grid,
+												Span<FloatType> magnitudes) const noexcept
+			-> void override {
+			if(EQBand::mType < BandType::LowShelf) {
+				EQBand::getMagnitudesForFrequencies(grid, magnitudes);
+				return;
+			}
+
+			// shelves and bells respond like their serial counterparts, so calculate those
+			// coefficients once for the whole grid
+			auto filterType = FilterType::AnalogBell;
+			switch(EQBand::mType) {
+				case BandType::LowShelf: filterType = FilterType::LowShelf; break;
+				case BandType::HighShelf: filterType = FilterType::HighShelf; break;
+				case BandType::Bell: filterType = FilterType::Bell; break;
+				default: break;
+			}
+			const auto design = BiQuadFilter<FloatType>::calculateDesign(filterType,
+																		 EQBand::mFrequency,
+																		 EQBand::mQ,
+																		 EQBand::mGain,
+																		 EQBand::mSampleRate,
+																		 EQBand::mDesignMethod);
+			grid.getMagnitudes(design.coefficients, magnitudes);
+		}
+
 		/// @brief Calculates the decibel magnitude response of this filter for the given array of
 		/// frequencies and stores them in `magnitudes`
 		///
@@ -342,12 +331,10 @@ namespace apex::dsp {
 		getPhaseForFrequency(Hertz frequency) const noexcept -> Radians override {
 			Radians x = 0.0_rad;
 			if(EQBand::mType < BandType::Allpass) {
-				for(const auto& filt : EQBand::mFilters.at(Processor::LEFT)) {
-					x += filt.getPhaseForFrequency(frequency);
-				}
+				x = EQBand::mFilters.at(Processor::LEFT).getPhaseForFrequency(frequency);
 			}
 			else if(EQBand::mType < BandType::LowShelf) {
-				x = EQBand::mFilter.at(Processor::LEFT).getPhaseForFrequency(frequency);
+				x = EQBand::mFilter.getPhaseForFrequency(frequency);
 			}
 			else {
 				/// TODO: This might not be the accurate way to do this,
@@ -355,7 +342,7 @@ namespace apex::dsp {
 
 				// Parallel bands should have phase-shift as the average between
 				// the shift caused by the filter and the original, right?
-				x = EQBand::mFilter.at(Processor::LEFT).getPhaseForFrequency(frequency)
+				x = EQBand::mFilter.getPhaseForFrequency(frequency)
 					* narrow_cast<FloatType>(0.5);
 			}
 			return x;
@@ -386,6 +373,22 @@ namespace apex::dsp {
 			}
 		}
 
+		/// @brief Calculates the phase response of this filter at every point of the given grid,
+		/// evaluating the whole grid at once
+		///
+		/// @param grid - The frequencies to calculate the phase response for
+		/// @param phases - The array to store the phases (in radians) in
+		inline auto getPhasesForFrequencies(const ResponseGrid<FloatType>& grid,
+											Span<Radians> phases) const noexcept -> void override {
+			EQBand::getPhasesForFrequencies(grid, phases);
+			if(EQBand::mType >= BandType::LowShelf) {
+				// see `getPhaseForFrequency`
+				for(auto& phase : phases) {
+					phase = phase * narrow_cast<FloatType>(0.5);
+				}
+			}
+		}
+
 		/// @brief Calculates the phase response of this filter for the given array of frequencies
 		/// and stores it in `phases`
 		///
@@ -406,40 +409,141 @@ namespace apex::dsp {
 	  protected:
 		/// the actual gain, before acounting for changes necessary for EQing in parallel
 		Decibels mGainActual = 0.0_dB;
+		/// The actual gain the filters were last designed with, which the processing paths use
+		Decibels mAppliedGainActual = 0.0_dB;
+
+		/// @brief Calculates the designs of the filter stages of a parallel band with the given
+		/// parameters, mapping the gain for EQing in parallel. Does not touch any state of the
+		/// band, so it is safe to call from any thread
+		///
+		/// @param type - The type of the band
+		/// @param frequency - The frequency, in Hertz
+		/// @param q - The Q
+		/// @param gainDB - The gain, in Decibels
+		/// @param sampleRate - The sample rate, in Hertz
+		/// @param method - The method to design the filters with
+		///
+		/// @return - The design
+		[[nodiscard]] inline auto calculateDesign(BandType type,
+												  Hertz frequency,
+												  FloatType q,
+												  Decibels gainDB,
+												  Hertz sampleRate,
+												  DesignMethod method) const noexcept
+			-> Design override {
+			auto one = narrow_cast<FloatType>(1.0);
+			auto filterGain = gainDB;
+			if(type >= BandType::LowShelf) {
+				if(gainDB < narrow_cast<FloatType>(0.0)) {
+					filterGain = Decibels::fromLinear(one - gainDB.getLinear());
+				}
+				else {
+					filterGain = math::Decibels::linearToDecibels(gainDB.getLinear() - one);
+				}
+			}
+
+			auto design
+				= EQBand::calculateDesign(type, frequency, q, filterGain, sampleRate, method);
+			// the band reports the gain it was given, the filters and gain stage use the
+			// parallel one
+			design.gain = gainDB;
+			if(type == BandType::LowShelf) {
+				design.stages.at(0) = BiQuadFilter<FloatType>::calculateDesign(FilterType::Lowpass,
+																			   frequency,
+																			   q,
+																			   filterGain,
+																			   sampleRate,
+																			   method);
+			}
+			else if(type == BandType::HighShelf) {
+				design.stages.at(0)
+					= BiQuadFilter<FloatType>::calculateDesign(FilterType::Highpass,
+															   frequency,
+															   q,
+															   filterGain,
+															   sampleRate,
+															   method);
+			}
+			else if(type == BandType::Bell) {
+				design.stages.at(0)
+					= BiQuadFilter<FloatType>::calculateDesign(FilterType::Bandpass,
+															   frequency,
+															   q,
+															   filterGain,
+															   sampleRate,
+															   method);
+			}
+			else if(type == BandType::AnalogBell) {
+				design.stages.at(0) = BiQuadFilter<FloatType>::calculateDesign(
+					FilterType::Bandpass,
+					frequency,
+					q
+						* Exponentials<FloatType>::pow10(narrow_cast<FloatType>(gainDB)
+														 / narrow_cast<FloatType>(40.0)),
+					filterGain,
+					sampleRate,
+					method);
+			}
+			return design;
+		}
+
+		/// @brief Applies the given design, picked up from `publishDesign` or calculated by the
+		/// parameter setters, to this band's filters and gain stage. Only copies parameters and
+		/// coefficients, so no maths is done here
+		///
+		/// @param design - The design to apply
+		///
+		/// @return - Whether the design was applied
+		inline auto applyDesign(const Design& design) noexcept -> bool override {
+			if(!EQBand::applyDesign(design)) {
+				return false;
+			}
+
+			mAppliedGainActual = design.gain;
+			EQBand::mAppliedGain = design.stages.at(0).gain;
+			EQBand::mGainProcessor.setGain(EQBand::mAppliedGain, design.gainLinear);
+			return true;
+		}
+
+		/// @brief Records the parameters of a design being published by `publishDesign` as the
+		/// ones returned by the getters, with the gain before and after the parallel mapping.
+		/// Called on the publishing thread
+		///
+		/// @param design - The design being published
+		inline auto recordPublishedParameters(const Design& design) noexcept -> void override {
+			EQBand::recordPublishedParameters(design);
+			mGainActual = design.gain;
+			EQBand::mGain = design.stages.at(0).gain;
+		}
 
 		/// @brief Creates necessary filter(s) for this EQ band
 		inline auto createFilters() noexcept -> void override {
 			EQBand::createFilters();
 			if(EQBand::mType == BandType::LowShelf) {
-				for(auto& channel : EQBand::mFilter) {
-					channel = BiQuadFilter<FloatType>::MakeLowpass(EQBand::mFrequency,
-																   EQBand::mQ,
-																   EQBand::mSampleRate);
-				}
+				EQBand::mFilter
+					= BiQuadBank(BiQuadFilter<FloatType>::MakeLowpass(EQBand::mFrequency,
+																	  EQBand::mQ,
+																	  EQBand::mSampleRate));
 			}
 			else if(EQBand::mType == BandType::HighShelf) {
-				for(auto& channel : EQBand::mFilter) {
-					channel = BiQuadFilter<FloatType>::MakeHighpass(EQBand::mFrequency,
-																	EQBand::mQ,
-																	EQBand::mSampleRate);
-				}
+				EQBand::mFilter
+					= BiQuadBank(BiQuadFilter<FloatType>::MakeHighpass(EQBand::mFrequency,
+																	   EQBand::mQ,
+																	   EQBand::mSampleRate));
 			}
 			else if(EQBand::mType == BandType::Bell) {
-				for(auto& channel : EQBand::mFilter) {
-					channel = BiQuadFilter<FloatType>::MakeBandpass(EQBand::mFrequency,
-																	EQBand::mQ,
-																	EQBand::mSampleRate);
-				}
+				EQBand::mFilter
+					= BiQuadBank(BiQuadFilter<FloatType>::MakeBandpass(EQBand::mFrequency,
+																	   EQBand::mQ,
+																	   EQBand::mSampleRate));
 			}
 			else if(EQBand::mType == BandType::AnalogBell) {
-				for(auto& channel : EQBand::mFilter) {
-					channel = BiQuadFilter<FloatType>::MakeBandpass(
-						EQBand::mFrequency,
-						EQBand::mQ
-							* Exponentials<FloatType>::pow10(narrow_cast<FloatType>(mGainActual)
-															 / narrow_cast<FloatType>(40.0)),
-						EQBand::mSampleRate);
-				}
+				EQBand::mFilter = BiQuadBank(BiQuadFilter<FloatType>::MakeBandpass(
+					EQBand::mFrequency,
+					EQBand::mQ
+						* Exponentials<FloatType>::pow10(narrow_cast<FloatType>(mGainActual)
+														 / narrow_cast<FloatType>(40.0)),
+					EQBand::mSampleRate));
 			}
 		}
 
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cmath>
+
+#include "../EQBand.h"
+#include "../ParallelEQBand.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Checks a band configured with `publishDesign` reports the published parameters
+	/// straight away, and once the design is picked up, processes the same as one configured
+	/// with the setters
+	template<typename Band>
+	inline auto checkPublishedDesign(Decibels gain) -> void {
+		constexpr size_t numSamples = 256;
+		auto published = Band();
+		published.setBandType(BandType::Bell);
+		auto reference = Band();
+		reference.setBandType(BandType::Bell);
+		reference.setFrequency(2.0_kHz);
+		reference.setQ(1.5);
+		reference.setGainDB(gain);
+
+		published.publishDesign(BandType::Bell, 2.0_kHz, 1.5, gain, 44.1_kHz);
+		ASSERT_EQ(published.getFrequency(), 2.0_kHz);
+		ASSERT_EQ(published.getQ(), 1.5);
+		ASSERT_EQ(published.getGainDB(), gain);
+
+		published.updateFiltersIfNeeded();
+		for(auto i = 0U; i < numSamples; ++i) {
+			const auto input = i == 0 ? 1.0 : 0.0;
+			ASSERT_NEAR(published.processMono(input), reference.processMono(input), 1.0e-12);
+		}
+		ASSERT_EQ(published.getGainDB(), gain);
+	}
+
+	TEST(EQBandTest, publishedDesignMatchesSetters) {
+		checkPublishedDesign<EQBand<double>>(6.0_dB);
+	}
+
+	TEST(EQBandTest, publishedParallelDesignMatchesSetters) {
+		checkPublishedDesign<ParallelEQBand<double>>(-6.0_dB);
+	}
+
+	/// @brief Checks a multi-stage band retuned with the setters shifts the frequency of each of
+	/// its stages, the same as a band constructed, or published, with the new parameters
+	TEST(EQBandTest, settersShiftStageFrequencies) {
+		constexpr size_t numSamples = 256;
+		for(const auto type : {BandType::Lowpass48DB, BandType::Highpass96DB}) {
+			auto constructed = EQBand<double>(2.0_kHz, 0.9, 0.0_dB, 44.1_kHz, type);
+			auto set = EQBand<double>(500.0_Hz, 0.7, 0.0_dB, 44.1_kHz, type);
+			set.setFrequency(2.0_kHz);
+			set.setQ(0.9);
+			auto published = EQBand<double>(500.0_Hz, 0.7, 0.0_dB, 44.1_kHz, type);
+			published.publishDesign(type, 2.0_kHz, 0.9, 0.0_dB, 44.1_kHz);
+			published.updateFiltersIfNeeded();
+
+			for(const auto frequency : {100.0_Hz, 1.0_kHz, 2.0_kHz, 3.0_kHz, 10.0_kHz}) {
+				const auto expected = constructed.getMagnitudeForFrequency(frequency);
+				ASSERT_NEAR(set.getMagnitudeForFrequency(frequency), expected, 1.0e-9);
+				ASSERT_NEAR(published.getMagnitudeForFrequency(frequency), expected, 1.0e-9);
+			}
+			for(auto i = 0U; i < numSamples; ++i) {
+				const auto input = i == 0 ? 1.0 : 0.0;
+				const auto expected = constructed.processMono(input);
+				ASSERT_NEAR(set.processMono(input), expected, 1.0e-12);
+				ASSERT_NEAR(published.processMono(input), expected, 1.0e-12);
+			}
+		}
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "../EQCurve.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	TEST(EQCurveTest, designMethodChangeRecalculatesBand) {
+		// near Nyquist, where the bilinear and magnitude matched designs differ the most
+		auto frequencies = std::vector<Hertz>{1.0_kHz, 10.0_kHz, 16.0_kHz, 20.0_kHz};
+		const auto frequencySpan
+			= Span<const Hertz>::MakeSpan(frequencies.data(), frequencies.size());
+		auto curve = EQCurve<double, 1>(frequencySpan, 44.1_kHz);
+		auto band = EQBand<double>();
+		band.setBandType(BandType::Bell);
+		band.setFrequency(15.0_kHz);
+		band.setQ(2.0);
+		band.setGainDB(12.0_dB);
+
+		ASSERT_TRUE(curve.updateBand(0, band));
+		ASSERT_FALSE(curve.updateBand(0, band));
+		const auto bilinear = curve.getBandMagnitudes(0);
+		auto bilinearMagnitudes = std::vector<double>(bilinear.begin(), bilinear.end());
+
+		band.setDesignMethod(DesignMethod::MagnitudeMatched);
+		ASSERT_TRUE(curve.updateBand(0, band));
+		ASSERT_FALSE(curve.updateBand(0, band));
+
+		auto expected = std::vector<double>(frequencies.size());
+		band.getMagnitudesForFrequencies(frequencySpan,
+										 Span<double>::MakeSpan(expected.data(), expected.size()));
+		auto magnitudes = curve.getMagnitudes();
+		for(auto i = 0U; i < frequencies.size(); ++i) {
+			ASSERT_NEAR(magnitudes.at(i), expected.at(i), 1.0e-9 * expected.at(i));
+		}
+		// the cramped bilinear bell is measurably lower at 20kHz
+		ASSERT_GT(std::abs(magnitudes.at(3) - bilinearMagnitudes.at(3)), 0.01);
+	}
+} // namespace apex::dsp::test
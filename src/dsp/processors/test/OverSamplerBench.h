@@ -0,0 +1,509 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../../filters/BiQuadFilter.h"
+#include "../../filters/test/BiQuadFilterBench.h"
+#include "../OverSampler.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+	using apex::test::reportMeasurement;
+
+	/// The smallest image rejection, in Decibels, accepted from the half-band cascade
+	constexpr double MIN_IMAGE_REJECTION = 90.0;
+	/// The largest passband deviation, in Decibels, accepted from an oversampling round trip
+	constexpr double MAX_ROUND_TRIP_DEVIATION = 0.01;
+
+	/// @brief Reproduces the previous `OverSampler` processing path: zero-stuffing followed by a
+	/// single biquad lowpass at the original Nyquist, in each direction
+	template<typename FloatType, size_t OverSampleRate>
+	class ZeroStuffReference {
+	  public:
+		explicit ZeroStuffReference(Hertz sampleRate)
+			: mPreAntiAliasFilter(BiQuadFilter<FloatType>::MakeLowpass(
+				narrow_cast<FloatType>(sampleRate) / narrow_cast<FloatType>(2.0),
+				sampleRate * OverSampleRate)),
+			  mPostAntiAliasFilter(BiQuadFilter<FloatType>::MakeLowpass(
+				  narrow_cast<FloatType>(sampleRate) / narrow_cast<FloatType>(2.0),
+				  sampleRate * OverSampleRate)) {
+		}
+
+		inline auto process(Span<const FloatType> input, Span<FloatType> output) noexcept
+			-> void {
+			auto size = input.size();
+			mOverSampled.resize(size * OverSampleRate);
+			std::fill(mOverSampled.begin(), mOverSampled.end(), narrow_cast<FloatType>(0.0));
+			for(auto i = 0U; i < size; ++i) {
+				mOverSampled.at(i * OverSampleRate) = input.at(i);
+			}
+			auto overSampled = Span<FloatType>::MakeSpan(mOverSampled.data(), mOverSampled.size());
+			mPreAntiAliasFilter.process(overSampled, overSampled);
+			mPostAntiAliasFilter.process(overSampled, overSampled);
+			for(auto i = 0U; i < size; ++i) {
+				output.at(i) = mOverSampled.at(i * OverSampleRate);
+			}
+		}
+
+	  private:
+		BiQuadFilter<FloatType> mPreAntiAliasFilter;
+		BiQuadFilter<FloatType> mPostAntiAliasFilter;
+		std::vector<FloatType> mOverSampled;
+	};
+
+	/// @brief Calculates the amplitude of the given DFT bin of `signal`
+	template<typename FloatType>
+	inline auto binAmplitude(const std::vector<FloatType>& signal, size_t bin) -> double {
+		auto real = 0.0;
+		auto imaginary = 0.0;
+		const auto size = signal.size();
+		for(auto i = 0U; i < size; ++i) {
+			const auto phase = 2.0 * 3.14159265358979323846 * static_cast<double>(bin)
+							   * static_cast<double>(i) / static_cast<double>(size);
+			real += static_cast<double>(signal.at(i)) * std::cos(phase);
+			imaginary -= static_cast<double>(signal.at(i)) * std::sin(phase);
+		}
+		return 2.0 * std::hypot(real, imaginary) / static_cast<double>(size);
+	}
+
+	/// @brief Oversamples one bin-centered sine in blocks, returning the last (steady-state)
+	/// period of the oversampled signal and of the round trip
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto overSampleSine(OverSampler<FloatType, OverSampleRate>& overSampler,
+							   size_t length,
+							   size_t bin,
+							   std::vector<FloatType>& overSampled,
+							   std::vector<FloatType>& roundTrip) -> void {
+		auto input = std::vector<FloatType>(length);
+		for(auto i = 0U; i < length; ++i) {
+			input.at(i) = static_cast<FloatType>(
+				std::sin(2.0 * 3.14159265358979323846 * static_cast<double>(bin)
+						 * static_cast<double>(i) / static_cast<double>(length)));
+		}
+
+		overSampled.resize(length * OverSampleRate);
+		roundTrip.resize(length);
+		overSampler.reset();
+		// the first period lets the filters settle, the second is kept
+		for(auto period = 0; period < 2; ++period) {
+			for(auto offset = 0U; offset < length; offset += BENCHMARK_BLOCK_SIZE) {
+				auto up = overSampler.overSample(
+					Span<const FloatType>::MakeSpan(&input.at(offset), BENCHMARK_BLOCK_SIZE));
+				std::copy(up.data(),
+						  up.data() + up.size(), // NOLINT
+						  &overSampled.at(offset * OverSampleRate));
+				auto down = overSampler.downSample();
+				std::copy(down.data(),
+						  down.data() + down.size(), // NOLINT
+						  &roundTrip.at(offset));
+			}
+		}
+	}
+
+	/// @brief Checks that `overSampler` rejects every image of a passband tone by at least
+	/// `minRejection`, and that its round trip is the input, delayed by the reported latency
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto checkOverSampler(OverSampler<FloatType, OverSampleRate>& overSampler,
+								 double minRejection,
+								 double latencyTolerance) -> void {
+		constexpr size_t length = 8 * BENCHMARK_BLOCK_SIZE;
+		constexpr auto sampleRate = 44100.0;
+		auto overSampled = std::vector<FloatType>();
+		auto roundTrip = std::vector<FloatType>();
+
+		// a high passband tone: every image of it must be rejected
+		const auto highBin = static_cast<size_t>(
+			std::round(15000.0 / sampleRate * static_cast<double>(length)));
+		overSampleSine(overSampler, length, highBin, overSampled, roundTrip);
+		auto fundamental = binAmplitude(overSampled, highBin);
+		auto worstImage = 0.0;
+		for(auto image = 1U; image < OverSampleRate; ++image) {
+			worstImage = std::max(worstImage, binAmplitude(overSampled, image * length - highBin));
+			worstImage = std::max(worstImage, binAmplitude(overSampled, image * length + highBin));
+		}
+		const auto rejection = 20.0 * std::log10(fundamental / worstImage);
+		EXPECT_GE(rejection, minRejection);
+		EXPECT_NEAR(20.0 * std::log10(binAmplitude(roundTrip, highBin)),
+					0.0,
+					MAX_ROUND_TRIP_DEVIATION);
+
+		// a low tone: the round trip must be the input, delayed by the reported latency
+		const auto lowBin = static_cast<size_t>(
+			std::round(1000.0 / sampleRate * static_cast<double>(length)));
+		overSampleSine(overSampler, length, lowBin, overSampled, roundTrip);
+		EXPECT_NEAR(20.0 * std::log10(binAmplitude(roundTrip, lowBin)),
+					0.0,
+					MAX_ROUND_TRIP_DEVIATION);
+		const auto latency = static_cast<double>(overSampler.getLatency());
+		for(auto i = 0U; i < length; ++i) {
+			const auto expected
+				= std::sin(2.0 * 3.14159265358979323846 * static_cast<double>(lowBin)
+						   * (static_cast<double>(i) - latency) / static_cast<double>(length));
+			ASSERT_NEAR(static_cast<double>(roundTrip.at(i)), expected, latencyTolerance);
+		}
+	}
+
+	/// @brief Times a block round trip through `overSampler`, returning ns/sample
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto timeOverSampler(OverSampler<FloatType, OverSampleRate>& overSampler) -> double {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto nanos = benchmarkNanoseconds([&]() {
+			auto up = overSampler.overSample(inputSpan);
+			doNotOptimize(up.at(0));
+			auto down = overSampler.downSample();
+			doNotOptimize(down.at(0));
+		});
+		return nanos / static_cast<double>(BENCHMARK_BLOCK_SIZE);
+	}
+
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto benchmarkOverSampler(const std::string& typeName) -> void {
+		auto overSampler = OverSampler<FloatType, OverSampleRate>(44.1_kHz);
+		overSampler.prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE, 1);
+		checkOverSampler(overSampler, MIN_IMAGE_REJECTION, 1.0e-3);
+
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+
+		auto reference = ZeroStuffReference<FloatType, OverSampleRate>(44.1_kHz);
+		auto referenceNanos = benchmarkNanoseconds([&]() {
+			reference.process(inputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+		auto halfBandNanos = timeOverSampler(overSampler);
+
+		auto rate = std::to_string(OverSampleRate);
+		reportBenchmark("OverSampler<" + typeName + ", " + rate + "> zero-stuff biquad (old)",
+						referenceNanos / static_cast<double>(BENCHMARK_BLOCK_SIZE));
+		reportBenchmark("OverSampler<" + typeName + ", " + rate + "> half-band FIR cascade",
+						halfBandNanos);
+		reportMeasurement("LATENCY",
+						  "OverSampler<" + typeName + ", " + rate + "> half-band FIR cascade",
+						  static_cast<double>(overSampler.getLatency()),
+						  "samples");
+	}
+
+	/// @brief Checks and times `mode` at every `OverSamplingSteepness`
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto
+	benchmarkOverSamplerSteepness(const std::string& typeName, OverSamplingMode mode) -> void {
+		constexpr auto steepnesses = std::array<OverSamplingSteepness, 3>{
+			OverSamplingSteepness::Gentle,
+			OverSamplingSteepness::Moderate,
+			OverSamplingSteepness::Steep};
+		constexpr auto steepnessNames = std::array<const char*, 3>{"gentle", "moderate", "steep"};
+		// the designed attenuation of each steepness, less a little for coefficient rounding
+		constexpr auto minRejections = std::array<double, 3>{68.0, 88.0, 98.0};
+
+		// in `LowLatency` mode the phase delay at 1kHz is a little past the delay at DC
+		const auto latencyTolerance = mode == OverSamplingMode::LinearPhase ? 1.0e-3 : 5.0e-3;
+
+		auto overSampler = OverSampler<FloatType, OverSampleRate>(44.1_kHz, mode);
+		overSampler.prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE, 1);
+		auto rate = std::to_string(OverSampleRate);
+		for(auto i = 0U; i < steepnesses.size(); ++i) {
+			overSampler.setSteepness(steepnesses.at(i));
+			// the steep FIRs are held to the same bound as `benchmarkOverSampler`'s
+			const auto minRejection = mode == OverSamplingMode::LinearPhase ?
+										  std::min(minRejections.at(i), MIN_IMAGE_REJECTION) :
+										  minRejections.at(i);
+			checkOverSampler(overSampler, minRejection, latencyTolerance);
+			const auto name = "OverSampler<" + typeName + ", " + rate + "> "
+							  + (mode == OverSamplingMode::LinearPhase ? "half-band FIR, " :
+																			"allpass IIR, ")
+							  + steepnessNames.at(i);
+			reportBenchmark(name, timeOverSampler(overSampler));
+			reportMeasurement("LATENCY",
+							  name,
+							  static_cast<double>(overSampler.getLatency()),
+							  "samples");
+		}
+	}
+
+	/// @brief Reports the memory used by a stereo `OverSampler` prepared for a typical block
+	/// size, next to what the previous fixed 16384-sample buffers took per channel
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto reportOverSamplerFootprint(const std::string& typeName) -> void {
+		constexpr size_t blockSize = 256;
+		constexpr size_t numChannels = 2;
+		constexpr size_t previousMaxBlockSize = 16384;
+		auto overSampler = OverSampler<FloatType, OverSampleRate>();
+		overSampler.prepare(44.1_kHz, blockSize, numChannels);
+
+		// every sample of the prepared buffers must be usable
+		auto input = std::vector<FloatType>(blockSize);
+		fillWithNoise(input);
+		auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		for(auto channel = 0U; channel < numChannels; ++channel) {
+			auto up = overSampler.overSample(inputSpan, channel);
+			ASSERT_EQ(up.size(), blockSize * OverSampleRate);
+			auto down = overSampler.downSample(channel);
+			ASSERT_EQ(down.size(), blockSize);
+		}
+
+		const auto previous = numChannels * previousMaxBlockSize * (OverSampleRate + 1)
+							  * sizeof(FloatType);
+		const auto current = overSampler.getMemoryFootprint();
+		EXPECT_LT(current, previous);
+		auto rate = std::to_string(OverSampleRate);
+		reportMeasurement("MEMORY",
+						  "OverSampler<" + typeName + ", " + rate + ">, 2ch, fixed buffers (old)",
+						  static_cast<double>(previous) / 1024.0,
+						  "KiB");
+		reportMeasurement("MEMORY",
+						  "OverSampler<" + typeName + ", " + rate + ">, 2ch, 256 block",
+						  static_cast<double>(current) / 1024.0,
+						  "KiB");
+	}
+
+	/// @brief Checks that oversampling `numChannels` channels at once through one `OverSampler`
+	/// matches oversampling each through its own single-channel `OverSampler`, then times both
+	/// ways for `LowLatency`, the only mode that runs the channels side by side
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto benchmarkMultichannelOverSampler(const std::string& typeName,
+												 OverSamplingMode mode,
+												 size_t numChannels) -> void {
+		auto overSampler = OverSampler<FloatType, OverSampleRate>(44.1_kHz, mode);
+		overSampler.prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE, numChannels);
+		auto references = std::vector<OverSampler<FloatType, OverSampleRate>>();
+		for(auto channel = 0U; channel < numChannels; ++channel) {
+			references.emplace_back(44.1_kHz, mode);
+			references.back().prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE, 1);
+		}
+
+		auto inputs = std::vector<std::vector<FloatType>>(numChannels);
+		auto outputs = std::vector<std::vector<FloatType>>(numChannels);
+		auto inputSpans = std::vector<Span<const FloatType>>();
+		auto outputSpans = std::vector<Span<FloatType>>();
+		for(auto channel = 0U; channel < numChannels; ++channel) {
+			inputs.at(channel).resize(BENCHMARK_BLOCK_SIZE);
+			outputs.at(channel).resize(BENCHMARK_BLOCK_SIZE);
+			inputSpans.push_back(Span<const FloatType>::MakeSpan(inputs.at(channel).data(),
+																 BENCHMARK_BLOCK_SIZE));
+			outputSpans.push_back(Span<FloatType>::MakeSpan(outputs.at(channel).data(),
+															BENCHMARK_BLOCK_SIZE));
+		}
+		auto input = Span<const Span<const FloatType>>::MakeSpan(inputSpans.data(), numChannels);
+		auto output = Span<const Span<FloatType>>::MakeSpan(outputSpans.data(), numChannels);
+
+		// the lanes do the same arithmetic as a single channel, so only the rounding of fused
+		// multiply-adds can differ
+		const auto tolerance = static_cast<FloatType>(1.0e-5);
+		for(auto block = 0; block < 4; ++block) {
+			for(auto& channel : inputs) {
+				fillWithNoise(channel);
+			}
+			overSampler.overSample(input);
+			for(auto channel = 0U; channel < numChannels; ++channel) {
+				auto expected = references.at(channel).overSample(inputSpans.at(channel));
+				auto actual = overSampler.getOverSampled(channel);
+				ASSERT_EQ(actual.size(), expected.size());
+				for(auto i = 0U; i < expected.size(); ++i) {
+					ASSERT_NEAR(actual.at(i), expected.data()[i], tolerance); // NOLINT
+				}
+			}
+			overSampler.downSample(output);
+			for(auto channel = 0U; channel < numChannels; ++channel) {
+				auto expected = references.at(channel).downSample();
+				for(auto i = 0U; i < expected.size(); ++i) {
+					ASSERT_NEAR(outputs.at(channel).at(i), expected.at(i), tolerance);
+				}
+			}
+		}
+
+		if(mode == OverSamplingMode::LinearPhase) {
+			return;
+		}
+		auto separateNanos = benchmarkNanoseconds([&]() {
+			for(auto channel = 0U; channel < numChannels; ++channel) {
+				auto up = references.at(channel).overSample(inputSpans.at(channel));
+				doNotOptimize(up.at(0));
+				auto down = references.at(channel).downSample();
+				doNotOptimize(down.at(0));
+			}
+		});
+		auto sharedNanos = benchmarkNanoseconds([&]() {
+			overSampler.overSample(input);
+			overSampler.downSample(output);
+			doNotOptimize(outputs.back().back());
+		});
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		const auto name = "OverSampler<" + typeName + ", " + std::to_string(OverSampleRate)
+						  + "> IIR, " + std::to_string(numChannels) + "ch";
+		reportBenchmark(name + ", an instance each (old)", separateNanos / size);
+		reportBenchmark(name + ", shared, all channels", sharedNanos / size);
+		auto separateFootprint = static_cast<size_t>(0);
+		for(const auto& reference : references) {
+			separateFootprint += reference.getMemoryFootprint();
+		}
+		reportMeasurement("MEMORY",
+						  name + ", an instance each (old)",
+						  static_cast<double>(separateFootprint) / 1024.0,
+						  "KiB");
+		reportMeasurement("MEMORY",
+						  name + ", shared",
+						  static_cast<double>(overSampler.getMemoryFootprint()) / 1024.0,
+						  "KiB");
+	}
+
+	TEST(OverSamplerBench, multichannelFloat2x) {
+		benchmarkMultichannelOverSampler<float, 2>("float", OverSamplingMode::LinearPhase, 2);
+		benchmarkMultichannelOverSampler<float, 2>("float", OverSamplingMode::LowLatency, 2);
+	}
+
+	TEST(OverSamplerBench, multichannelFloat2xFourChannels) {
+		benchmarkMultichannelOverSampler<float, 2>("float", OverSamplingMode::LinearPhase, 4);
+		benchmarkMultichannelOverSampler<float, 2>("float", OverSamplingMode::LowLatency, 4);
+	}
+
+	TEST(OverSamplerBench, multichannelFloat4x) {
+		benchmarkMultichannelOverSampler<float, 4>("float", OverSamplingMode::LinearPhase, 2);
+		benchmarkMultichannelOverSampler<float, 4>("float", OverSamplingMode::LowLatency, 2);
+	}
+
+	TEST(OverSamplerBench, multichannelDouble4xSixChannels) {
+		benchmarkMultichannelOverSampler<double, 4>("double", OverSamplingMode::LinearPhase, 6);
+		benchmarkMultichannelOverSampler<double, 4>("double", OverSamplingMode::LowLatency, 6);
+	}
+
+	/// @brief Switches the factor of a running `OverSampler` through every value. Checks that
+	/// nothing is reallocated, that the output never jumps (as it would if the delay changed
+	/// without a fade), and that once a switch has settled, the reported latency is the new
+	/// factor's and the output is the input, delayed by it
+	template<typename FloatType, size_t OverSampleRate>
+	inline auto checkFactorSwitching(const std::string& typeName,
+									 OverSamplingMode mode,
+									 double latencyTolerance) -> void {
+		constexpr size_t blockSize = 64;
+		constexpr size_t blocksPerFactor = 32;
+		constexpr auto sampleRate = 44100.0;
+		constexpr auto frequency = 1000.0;
+		constexpr auto amplitude = 0.5;
+		constexpr auto pi = 3.14159265358979323846;
+		// the largest step of the sine itself, plus a little for the fades
+		const auto maxStep = amplitude * 2.0 * pi * frequency / sampleRate + 0.02;
+		const auto factors = std::array<size_t, 5>{2, 1, OverSampleRate, OverSampleRate / 2, 1};
+
+		auto overSampler = OverSampler<FloatType, OverSampleRate>(44.1_kHz, mode);
+		overSampler.prepare(44.1_kHz, blockSize, 1);
+		const auto* storage = overSampler.getOverSampled().data();
+		const auto footprint = overSampler.getMemoryFootprint();
+
+		auto input = std::vector<FloatType>(blockSize);
+		auto output = std::vector<double>(blockSize);
+		auto time = static_cast<size_t>(0);
+		auto previous = 0.0;
+		for(auto factor : factors) {
+			overSampler.setFactor(factor);
+			for(auto block = 0U; block < blocksPerFactor; ++block) {
+				for(auto i = 0U; i < blockSize; ++i) {
+					input.at(i) = static_cast<FloatType>(
+						amplitude
+						* std::sin(2.0 * pi * frequency * static_cast<double>(time + i)
+								   / sampleRate));
+				}
+				auto up = overSampler.overSample(
+					Span<const FloatType>::MakeSpan(input.data(), input.size()));
+				ASSERT_EQ(up.size(), blockSize * overSampler.getFactor());
+				auto down = overSampler.downSample();
+				for(auto i = 0U; i < blockSize; ++i) {
+					output.at(i) = static_cast<double>(down.at(i));
+					ASSERT_LE(std::abs(output.at(i) - previous), maxStep);
+					previous = output.at(i);
+				}
+				time += blockSize;
+			}
+
+			ASSERT_EQ(overSampler.getFactor(), factor);
+			ASSERT_FALSE(overSampler.isSwitchingFactor());
+			ASSERT_EQ(static_cast<double>(overSampler.getOverSampledSampleRate()),
+					  sampleRate * static_cast<double>(factor));
+			// the reported latency is the same as an `OverSampler` prepared at this factor's
+			auto reference = OverSampler<FloatType, OverSampleRate>(44.1_kHz, mode);
+			reference.setFactor(factor);
+			reference.prepare(44.1_kHz, blockSize, 1);
+			const auto latency = static_cast<double>(overSampler.getLatency());
+			ASSERT_EQ(latency, static_cast<double>(reference.getLatency()));
+
+			// and the last block is the input, delayed by it
+			for(auto i = 0U; i < blockSize; ++i) {
+				const auto sampleTime = static_cast<double>(time - blockSize + i) - latency;
+				ASSERT_NEAR(output.at(i),
+							amplitude * std::sin(2.0 * pi * frequency * sampleTime / sampleRate),
+							latencyTolerance);
+			}
+			reportMeasurement("LATENCY",
+							  "OverSampler<" + typeName + ", " + std::to_string(OverSampleRate)
+								  + "> "
+								  + (mode == OverSamplingMode::LinearPhase ? "FIR" : "IIR")
+								  + ", switched to " + std::to_string(factor) + "x",
+							  latency,
+							  "samples");
+		}
+		ASSERT_EQ(overSampler.getOverSampled().data(), storage);
+		ASSERT_EQ(overSampler.getMemoryFootprint(), footprint);
+	}
+
+	TEST(OverSamplerBench, factorSwitchingFloat8x) {
+		checkFactorSwitching<float, 8>("float", OverSamplingMode::LinearPhase, 1.0e-3);
+		checkFactorSwitching<float, 8>("float", OverSamplingMode::LowLatency, 5.0e-3);
+	}
+
+	TEST(OverSamplerBench, factorSwitchingDouble4x) {
+		checkFactorSwitching<double, 4>("double", OverSamplingMode::LinearPhase, 1.0e-3);
+	}
+
+	TEST(OverSamplerBench, memoryFootprint) {
+		reportOverSamplerFootprint<float, 2>("float");
+		reportOverSamplerFootprint<double, 2>("double");
+		reportOverSamplerFootprint<double, 8>("double");
+	}
+
+	TEST(OverSamplerBench, halfBandFloat2x) {
+		benchmarkOverSampler<float, 2>("float");
+	}
+
+	TEST(OverSamplerBench, halfBandFloat4x) {
+		benchmarkOverSampler<float, 4>("float");
+	}
+
+	TEST(OverSamplerBench, halfBandFloat8x) {
+		benchmarkOverSampler<float, 8>("float");
+	}
+
+	TEST(OverSamplerBench, halfBandDouble16x) {
+		benchmarkOverSampler<double, 16>("double");
+	}
+
+	TEST(OverSamplerBench, linearPhaseSteepnessFloat2x) {
+		benchmarkOverSamplerSteepness<float, 2>("float", OverSamplingMode::LinearPhase);
+	}
+
+	TEST(OverSamplerBench, linearPhaseSteepnessFloat8x) {
+		benchmarkOverSamplerSteepness<float, 8>("float", OverSamplingMode::LinearPhase);
+	}
+
+	TEST(OverSamplerBench, lowLatencyFloat2x) {
+		benchmarkOverSamplerSteepness<float, 2>("float", OverSamplingMode::LowLatency);
+	}
+
+	TEST(OverSamplerBench, lowLatencyFloat4x) {
+		benchmarkOverSamplerSteepness<float, 4>("float", OverSamplingMode::LowLatency);
+	}
+
+	TEST(OverSamplerBench, lowLatencyDouble8x) {
+		benchmarkOverSamplerSteepness<double, 8>("double", OverSamplingMode::LowLatency);
+	}
+} // namespace apex::dsp::test
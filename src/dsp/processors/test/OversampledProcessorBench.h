@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../../test/Benchmark.h"
+#include "../../filters/test/BiQuadFilterBench.h"
+#include "../EQBand.h"
+#include "../Gain.h"
+#include "../OversampledProcessor.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	template<size_t Factor>
+	inline auto checkOversampledGain() -> void {
+		constexpr size_t length = 8 * BENCHMARK_BLOCK_SIZE;
+		constexpr auto pi = 3.14159265358979323846;
+		auto processor = OversampledProcessor<Gain<float>, Factor>(6.0_dB);
+		processor.prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE);
+		const auto gain = std::pow(10.0, 6.0 / 20.0);
+
+		// different tones on each channel, so a mixup between them shows
+		auto left = std::vector<float>(length);
+		auto right = std::vector<float>(length);
+		for(auto i = 0U; i < length; ++i) {
+			left.at(i) = static_cast<float>(0.5 * std::sin(2.0 * pi * 1000.0 * i / 44100.0));
+			right.at(i) = static_cast<float>(0.5 * std::sin(2.0 * pi * 700.0 * i / 44100.0));
+		}
+		auto outputLeft = std::vector<float>(length);
+		auto outputRight = std::vector<float>(length);
+		for(auto offset = 0U; offset < length; offset += BENCHMARK_BLOCK_SIZE) {
+			processor.processStereo(
+				Span<const float>::MakeSpan(&left.at(offset), BENCHMARK_BLOCK_SIZE),
+				Span<const float>::MakeSpan(&right.at(offset), BENCHMARK_BLOCK_SIZE),
+				Span<float>::MakeSpan(&outputLeft.at(offset), BENCHMARK_BLOCK_SIZE),
+				Span<float>::MakeSpan(&outputRight.at(offset), BENCHMARK_BLOCK_SIZE));
+		}
+
+		// after the filters settle, the output is the input, delayed by the reported latency
+		const auto latency = static_cast<double>(processor.getLatency());
+		for(auto i = length / 2; i < length; ++i) {
+			const auto time = (static_cast<double>(i) - latency) / 44100.0;
+			ASSERT_NEAR(outputLeft.at(i), gain * 0.5 * std::sin(2.0 * pi * 1000.0 * time), 1.0e-3);
+			ASSERT_NEAR(outputRight.at(i), gain * 0.5 * std::sin(2.0 * pi * 700.0 * time), 1.0e-3);
+		}
+
+		// the single-sample path goes through the same buffers
+		processor.reset();
+		for(auto i = 0U; i < length; ++i) {
+			outputLeft.at(i) = processor.processMono(left.at(i));
+		}
+		for(auto i = length / 2; i < length; ++i) {
+			const auto time = (static_cast<double>(i) - latency) / 44100.0;
+			ASSERT_NEAR(outputLeft.at(i), gain * 0.5 * std::sin(2.0 * pi * 1000.0 * time), 1.0e-3);
+		}
+	}
+
+	template<size_t Factor>
+	inline auto benchmarkOversampledEQBand() -> void {
+		auto processor = OversampledProcessor<EQBand<float>, Factor>(1.0_kHz,
+																	  0.7F,
+																	  6.0_dB,
+																	  44.1_kHz,
+																	  BandType::Bell);
+		processor.prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE);
+		// the wrapped processor runs at the oversampled rate
+		ASSERT_EQ(static_cast<double>(processor.getProcessor().getSampleRate()),
+				  44100.0 * static_cast<double>(Factor));
+		processor.setSampleRate(48.0_kHz);
+		ASSERT_EQ(static_cast<double>(processor.getProcessor().getSampleRate()),
+				  48000.0 * static_cast<double>(Factor));
+		processor.setSampleRate(44.1_kHz);
+
+		auto band = EQBand<float>(1.0_kHz, 0.7F, 6.0_dB, 44.1_kHz, BandType::Bell);
+
+		auto left = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		auto right = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		auto outputLeft = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		auto outputRight = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(left);
+		fillWithNoise(right);
+		auto leftSpan = Span<const float>::MakeSpan(left.data(), left.size());
+		auto rightSpan = Span<const float>::MakeSpan(right.data(), right.size());
+		auto outputLeftSpan = Span<float>::MakeSpan(outputLeft.data(), outputLeft.size());
+		auto outputRightSpan = Span<float>::MakeSpan(outputRight.data(), outputRight.size());
+
+		auto baseNanos = benchmarkNanoseconds([&]() {
+			band.processStereo(leftSpan, rightSpan, outputLeftSpan, outputRightSpan);
+			doNotOptimize(outputRight.back());
+		});
+		auto oversampledNanos = benchmarkNanoseconds([&]() {
+			processor.processStereo(leftSpan, rightSpan, outputLeftSpan, outputRightSpan);
+			doNotOptimize(outputRight.back());
+		});
+
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		auto factor = std::to_string(Factor);
+		reportBenchmark("EQBand<float> bell, stereo", baseNanos / size);
+		reportBenchmark("OversampledProcessor<EQBand<float>, " + factor + ">, stereo",
+						oversampledNanos / size);
+	}
+
+	/// @brief Checks that the wrapped processor's sample rate, and the reported latency, follow
+	/// a factor switch once it takes effect
+	inline auto checkOversampledFactorSwitch() -> void {
+		auto processor = OversampledProcessor<EQBand<float>, 8>(1.0_kHz,
+																 0.7F,
+																 6.0_dB,
+																 44.1_kHz,
+																 BandType::Bell);
+		processor.prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE);
+		auto input = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<float>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+		auto inputSpan = Span<const float>::MakeSpan(input.data(), input.size());
+		auto outputSpan = Span<float>::MakeSpan(output.data(), output.size());
+
+		for(auto factor : std::array<size_t, 4>{2, 1, 4, 8}) {
+			processor.setFactor(factor);
+			// one block fades out at the old factor, the next runs at the new one
+			processor.processMono(inputSpan, outputSpan);
+			processor.processMono(inputSpan, outputSpan);
+			ASSERT_EQ(processor.getFactor(), factor);
+			ASSERT_EQ(static_cast<double>(processor.getProcessor().getSampleRate()),
+					  44100.0 * static_cast<double>(factor));
+			ASSERT_EQ(processor.getLatency(), processor.getOverSampler().getLatency());
+		}
+	}
+
+	TEST(OversampledProcessorBench, factorSwitch) {
+		checkOversampledFactorSwitch();
+	}
+
+	TEST(OversampledProcessorBench, gain2x) {
+		checkOversampledGain<2>();
+	}
+
+	TEST(OversampledProcessorBench, gain4x) {
+		checkOversampledGain<4>();
+	}
+
+	TEST(OversampledProcessorBench, eqBand2x) {
+		benchmarkOversampledEQBand<2>();
+	}
+
+	TEST(OversampledProcessorBench, eqBand4x) {
+		benchmarkOversampledEQBand<4>();
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../test/Benchmark.h"
+#include "../WaveShaper.h"
+#include "../WaveShaperADAA.h"
+#include "../filters/test/BiQuadFilterBench.h"
+#include "../processors/OverSampler.h"
+#include "../processors/test/OverSamplerBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+	/// The number of samples aliasing is measured over, a whole number of periods of the sine
+	static const constexpr size_t ALIASING_LENGTH = 8 * BENCHMARK_BLOCK_SIZE;
+	/// The DFT bin of the sine aliasing is measured with, about 5kHz at 44.1kHz
+	static const constexpr size_t ALIASING_BIN = 465;
+	/// How hard the sine and the timed noise drive the waveshapers
+	constexpr double ALIASING_DRIVE = 4.0;
+
+	template<typename FloatType>
+	using BlockProcess = std::function<void(Span<const FloatType>, Span<FloatType>)>;
+
+	/// @brief Drives `process` with a bin-centered sine and returns the ratio of the power in
+	/// the harmonics of the sine to the power everywhere else, which is aliasing, in Decibels
+	template<typename FloatType>
+	inline auto signalToAliasRatio(const BlockProcess<FloatType>& process) -> double {
+		auto input = std::vector<FloatType>(ALIASING_LENGTH);
+		for(auto i = 0U; i < ALIASING_LENGTH; ++i) {
+			input.at(i) = static_cast<FloatType>(
+				ALIASING_DRIVE
+				* std::sin(2.0 * 3.14159265358979323846 * static_cast<double>(ALIASING_BIN)
+						   * static_cast<double>(i) / static_cast<double>(ALIASING_LENGTH)));
+		}
+
+		auto output = std::vector<FloatType>(ALIASING_LENGTH);
+		// the first period lets any filters settle, the second is kept
+		for(auto period = 0; period < 2; ++period) {
+			for(auto offset = 0U; offset < ALIASING_LENGTH; offset += BENCHMARK_BLOCK_SIZE) {
+				process(Span<const FloatType>::MakeSpan(&input.at(offset), BENCHMARK_BLOCK_SIZE),
+						Span<FloatType>::MakeSpan(&output.at(offset), BENCHMARK_BLOCK_SIZE));
+			}
+		}
+
+		auto totalPower = 0.0;
+		for(auto sample : output) {
+			totalPower += static_cast<double>(sample) * static_cast<double>(sample);
+		}
+		totalPower /= static_cast<double>(ALIASING_LENGTH);
+		auto mean = 0.0;
+		for(auto sample : output) {
+			mean += static_cast<double>(sample);
+		}
+		mean /= static_cast<double>(ALIASING_LENGTH);
+		auto harmonicPower = 0.0;
+		for(auto bin = ALIASING_BIN; bin < ALIASING_LENGTH / 2; bin += ALIASING_BIN) {
+			const auto amplitude = binAmplitude(output, bin);
+			harmonicPower += amplitude * amplitude / 2.0;
+		}
+		const auto aliasPower = std::max(totalPower - mean * mean - harmonicPower, 1.0e-30);
+		return 10.0 * std::log10(harmonicPower / aliasPower);
+	}
+
+	/// @brief Times `process` on a block of driven noise, returning ns/sample
+	template<typename FloatType>
+	inline auto timeBlockProcess(const BlockProcess<FloatType>& process) -> double {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+		for(auto& sample : input) {
+			sample *= static_cast<FloatType>(ALIASING_DRIVE);
+		}
+		const auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		const auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+		auto nanos = benchmarkNanoseconds([&]() {
+			process(inputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+		return nanos / static_cast<double>(BENCHMARK_BLOCK_SIZE);
+	}
+
+	/// @brief Wraps the block `shape` in `overSampler`, at the given factor
+	template<typename FloatType>
+	inline auto overSampled(OverSampler<FloatType, 8>& overSampler,
+							size_t factor,
+							BlockProcess<FloatType> shape) -> BlockProcess<FloatType> {
+		overSampler.setFactor(factor);
+		overSampler.prepare(44.1_kHz, BENCHMARK_BLOCK_SIZE, 1);
+		return [&overSampler, shape = std::move(shape)](Span<const FloatType> input,
+														Span<FloatType> output) {
+			static_cast<void>(overSampler.overSample(input));
+			auto upSampled = overSampler.getOverSampled();
+			shape(Span<const FloatType>::MakeSpan(upSampled.data(), upSampled.size()), upSampled);
+			auto down = overSampler.downSample();
+			std::copy(down.data(), down.data() + down.size(), output.data()); // NOLINT
+		};
+	}
+
+	/// @brief Compares the aliasing and cost of a waveshaper anti-aliased by ADAA against the
+	/// plain block waveshaper, at 1x and oversampled
+	template<typename FloatType, typename Antiderivatives>
+	inline auto compareAliasing(const std::string& name,
+								const BlockProcess<FloatType>& plain,
+								ADAAWaveshaper<FloatType, Antiderivatives>& waveshaper) -> void {
+		const auto adaa = BlockProcess<FloatType>(
+			[&waveshaper](Span<const FloatType> input, Span<FloatType> output) {
+				waveshaper.process(input, output);
+			});
+		auto overSampler = OverSampler<FloatType, 8>(44.1_kHz);
+
+		const auto report = [&name](const std::string& config,
+									const BlockProcess<FloatType>& process) {
+			const auto ratio = signalToAliasRatio(process);
+			reportBenchmark(name + ", " + config, timeBlockProcess(process));
+			reportMeasurement("ALIASING", name + ", " + config, ratio, "dB SAR");
+			return ratio;
+		};
+
+		const auto plainRatio = report("plain 1x", plain);
+		waveshaper.setOrder(ADAAOrder::First);
+		const auto firstRatio = report("ADAA1 1x", adaa);
+		waveshaper.setOrder(ADAAOrder::Second);
+		const auto secondRatio = report("ADAA2 1x", adaa);
+		for(auto factor : {2U, 4U, 8U}) {
+			report("plain " + std::to_string(factor) + "x",
+				   overSampled(overSampler, factor, plain));
+		}
+		waveshaper.setOrder(ADAAOrder::First);
+		const auto overSampledRatio = report("ADAA1 2x", overSampled(overSampler, 2U, adaa));
+
+		EXPECT_GT(firstRatio, plainRatio);
+		EXPECT_GT(secondRatio, plainRatio);
+		EXPECT_GT(overSampledRatio, firstRatio);
+	}
+
+	template<typename FloatType>
+	inline auto benchmarkADAA(const std::string& typeName) -> void {
+		const auto amount = narrow_cast<FloatType>(0.5);
+		const auto slope = narrow_cast<FloatType>(0.7);
+		const auto clipLevel = narrow_cast<FloatType>(0.8);
+
+		auto softClip = SoftClipADAA<FloatType>(amount);
+		compareAliasing<FloatType>(
+			"softClip<" + typeName + ">",
+			[amount](Span<const FloatType> input, Span<FloatType> output) {
+				waveshapers::softClip<FloatType>(input, output, amount);
+			},
+			softClip);
+
+		auto hardClip = HardClipADAA<FloatType>(clipLevel, amount);
+		compareAliasing<FloatType>(
+			"hardClip<" + typeName + ">",
+			[clipLevel, amount](Span<const FloatType> input, Span<FloatType> output) {
+				waveshapers::hardClip<FloatType>(input, output, clipLevel, amount);
+			},
+			hardClip);
+
+		auto softSaturation = SoftSaturationADAA<FloatType>(amount, slope);
+		compareAliasing<FloatType>(
+			"softSaturation<" + typeName + ">",
+			[amount, slope](Span<const FloatType> input, Span<FloatType> output) {
+				waveshapers::softSaturation<FloatType>(input, output, amount, slope);
+			},
+			softSaturation);
+	}
+
+	TEST(WaveShaperADAABench, aliasingFloat) {
+		benchmarkADAA<float>("float");
+	}
+
+	TEST(WaveShaperADAABench, aliasingDouble) {
+		benchmarkADAA<double>("double");
+	}
+} // namespace apex::dsp::test
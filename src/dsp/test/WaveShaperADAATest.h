@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "../WaveShaperADAA.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+	/// The step of the central differences the antiderivatives are checked with
+	constexpr double DIFFERENCE_STEP = 1.0e-4;
+
+	/// @brief Checks that each antiderivative of `shape` is zero at zero and differentiates to
+	/// the one below it
+	template<typename Shape>
+	inline auto checkAntiderivatives(const Shape& shape, double acceptedError) -> void {
+		ASSERT_EQ(shape.antiderivative(0.0), 0.0);
+		ASSERT_EQ(shape.secondAntiderivative(0.0), 0.0);
+		// offset from round numbers, to stay clear of the kinks of the shapes tested
+		for(auto input = -3.0037; input < 3.0; input += 0.01) {
+			const auto derivative = (shape.antiderivative(input + DIFFERENCE_STEP)
+									 - shape.antiderivative(input - DIFFERENCE_STEP))
+									/ (2.0 * DIFFERENCE_STEP);
+			ASSERT_NEAR(derivative, shape.value(input), acceptedError);
+			const auto secondDerivative = (shape.secondAntiderivative(input + DIFFERENCE_STEP)
+										   - shape.secondAntiderivative(input - DIFFERENCE_STEP))
+										  / (2.0 * DIFFERENCE_STEP);
+			ASSERT_NEAR(secondDerivative, shape.antiderivative(input), acceptedError);
+		}
+	}
+
+	TEST(WaveShaperADAATest, softClipAntiderivatives) {
+		for(auto amount : {0.0, 0.5, 1.0, 3.0}) {
+			const auto shape = SoftClipAntiderivatives{amount};
+			checkAntiderivatives(shape, 1.0e-7);
+			for(auto input : {-1.7, -0.01, 0.3, 2.5}) {
+				auto output = 0.0;
+				waveshapers::softClip<double>(Span<const double>::MakeSpan(&input, 1),
+											  Span<double>::MakeSpan(&output, 1),
+											  amount);
+				ASSERT_DOUBLE_EQ(shape.value(input), output);
+			}
+		}
+
+		// the closed forms and the series agree where they meet
+		const auto below = std::nextafter(waveshapers::ANTIDERIVATIVE_SERIES_LIMIT, 0.0);
+		const auto above = std::nextafter(waveshapers::ANTIDERIVATIVE_SERIES_LIMIT, 1.0);
+		ASSERT_NEAR(waveshapers::softClipAntiderivative(below),
+					waveshapers::softClipAntiderivative(above),
+					1.0e-15);
+		ASSERT_NEAR(waveshapers::softClipSecondAntiderivative(below),
+					waveshapers::softClipSecondAntiderivative(above),
+					1.0e-15);
+	}
+
+	TEST(WaveShaperADAATest, hardClipAntiderivatives) {
+		// clipping at the knee, clipping with no soft clipping, and never reaching the clip
+		// level
+		for(auto [clipLevel, amount] : {std::pair{0.8, 1.0}, {0.5, 0.0}, {3.0, 1.0}}) {
+			const auto shape = HardClipAntiderivatives{clipLevel, amount};
+			checkAntiderivatives(shape, 1.0e-7);
+			for(auto input : {-1.7, -0.01, 0.3, 2.5}) {
+				auto output = 0.0;
+				waveshapers::hardClip<double>(Span<const double>::MakeSpan(&input, 1),
+											  Span<double>::MakeSpan(&output, 1),
+											  clipLevel,
+											  amount);
+				ASSERT_DOUBLE_EQ(shape.value(input), output);
+			}
+		}
+	}
+
+	TEST(WaveShaperADAATest, softSaturationAntiderivatives) {
+		auto shape = SoftSaturationAntiderivatives(0.5, 0.7);
+		checkAntiderivatives(shape, 1.0e-7);
+		// against the exact shape, as accurately as the table allows
+		for(auto input = -3.0037; input < 3.0; input += 0.01) {
+			const auto exact
+				= input * 1.5 / (1.0 + 0.5 * std::pow(std::abs(input), 0.7));
+			ASSERT_NEAR(shape.value(input), exact, 1.0e-5);
+		}
+
+		// beyond the table, the shape is held, and the antiderivatives continue consistently
+		shape.prepare(-1.0, 1.0, 257);
+		ASSERT_EQ(shape.value(2.0), shape.value(1.0));
+		checkAntiderivatives(shape, 1.0e-7);
+
+		ASSERT_FALSE(shape.setParameters(0.5, 0.7));
+		ASSERT_TRUE(shape.setParameters(2.0, 0.7));
+		ASSERT_EQ(shape.getAmount(), 2.0);
+		checkAntiderivatives(shape, 1.0e-7);
+	}
+
+	/// @brief Checks an anti-aliased waveshaper against its shape on a slow sine, which should
+	/// be shaped as the shape would, delayed by the waveshaper's latency
+	template<typename FloatType, typename Shape>
+	inline auto checkADAA(ADAAWaveshaper<FloatType, Shape>& waveshaper,
+						  const Shape& shape,
+						  double acceptedError) -> void {
+		constexpr size_t size = 2048;
+		auto input = std::vector<FloatType>(size);
+		for(auto i = 0U; i < size; ++i) {
+			input.at(i) = static_cast<FloatType>(
+				1.5 * std::sin(2.0 * 3.14159265358979323846 * 2.0 * static_cast<double>(i)
+							   / static_cast<double>(size)));
+		}
+
+		for(auto order : {ADAAOrder::First, ADAAOrder::Second}) {
+			waveshaper.setOrder(order);
+			waveshaper.reset();
+			auto output = std::vector<FloatType>(size);
+			waveshaper.process(Span<const FloatType>::MakeSpan(input.data(), input.size()),
+							   Span<FloatType>::MakeSpan(output.data(), output.size()));
+			for(auto i = 2U; i < size; ++i) {
+				const auto current = static_cast<double>(input.at(i));
+				const auto previous = static_cast<double>(input.at(i - 1));
+				const auto delayed = order == ADAAOrder::First ? (current + previous) / 2.0 :
+																   previous;
+				ASSERT_NEAR(static_cast<double>(output.at(i)),
+							shape.value(delayed),
+							acceptedError);
+			}
+
+			// sample by sample gives the same result, as does in place
+			waveshaper.reset();
+			for(auto i = 0U; i < size; ++i) {
+				ASSERT_EQ(waveshaper.process(input.at(i)), output.at(i));
+			}
+			waveshaper.reset();
+			auto inPlace = input;
+			waveshaper.process(Span<const FloatType>::MakeSpan(inPlace.data(), inPlace.size()),
+							   Span<FloatType>::MakeSpan(inPlace.data(), inPlace.size()));
+			ASSERT_EQ(inPlace, output);
+
+			// a constant is shaped exactly, once the inputs it's averaged over are all equal
+			for(auto i = 0; i < 3; ++i) {
+				static_cast<void>(waveshaper.process(static_cast<FloatType>(0.7)));
+			}
+			ASSERT_NEAR(static_cast<double>(waveshaper.process(static_cast<FloatType>(0.7))),
+						shape.value(static_cast<double>(static_cast<FloatType>(0.7))),
+						static_cast<double>(std::numeric_limits<FloatType>::epsilon()));
+		}
+	}
+
+	TEST(WaveShaperADAATest, softClipFloat) {
+		auto waveshaper = SoftClipADAA<float>(0.5F);
+		ASSERT_EQ(waveshaper.getLatency(), 0.5F);
+		checkADAA(waveshaper, SoftClipAntiderivatives{0.5}, 1.0e-4);
+		ASSERT_EQ(waveshaper.getLatency(), 1.0F);
+	}
+
+	TEST(WaveShaperADAATest, softClipDouble) {
+		auto waveshaper = SoftClipADAA<double>(0.5);
+		checkADAA(waveshaper, SoftClipAntiderivatives{0.5}, 1.0e-4);
+	}
+
+	TEST(WaveShaperADAATest, hardClipFloat) {
+		auto waveshaper = HardClipADAA<float>(0.8F, 0.5F);
+		// the average over a step across the clip level is rounder than the shape
+		checkADAA(waveshaper, HardClipAntiderivatives{0.8, 0.5}, 1.0e-3);
+	}
+
+	TEST(WaveShaperADAATest, hardClipDouble) {
+		auto waveshaper = HardClipADAA<double>(0.8, 0.5);
+		checkADAA(waveshaper, HardClipAntiderivatives{0.8, 0.5}, 1.0e-3);
+	}
+
+	TEST(WaveShaperADAATest, softSaturationFloat) {
+		auto waveshaper = SoftSaturationADAA<float>(0.5F, 0.7F);
+		checkADAA(waveshaper, SoftSaturationAntiderivatives(0.5, 0.7), 1.0e-4);
+	}
+
+	TEST(WaveShaperADAATest, softSaturationDouble) {
+		auto waveshaper = SoftSaturationADAA<double>(0.5, 0.7);
+		checkADAA(waveshaper, SoftSaturationAntiderivatives(0.5, 0.7), 1.0e-4);
+	}
+
+	TEST(WaveShaperADAATest, secondOrderPeaks) {
+		// when an input returns to the one before the last, second order averages the shape
+		// from the last input to it, weighted linearly towards it. That's exact to rounding on
+		// either side of where it switches to the shape at the average's centroid
+		const auto shape = SoftClipAntiderivatives{1.0};
+		for(auto offset : {2.0e-5, 5.0e-4, 2.0e-3}) {
+			auto waveshaper = SoftClipADAA<double>(1.0, ADAAOrder::Second);
+			const auto peak = 0.9;
+			const auto previous = peak - offset;
+			static_cast<void>(waveshaper.process(peak));
+			static_cast<void>(waveshaper.process(previous));
+
+			constexpr auto steps = 1000;
+			const auto step = offset / static_cast<double>(steps);
+			auto integral = 0.0;
+			for(auto i = 0; i <= steps; ++i) {
+				const auto weight = i == 0 || i == steps ? 1.0 : (i % 2 == 1 ? 4.0 : 2.0);
+				const auto position = static_cast<double>(i) * step;
+				integral += weight * position * shape.value(previous + position);
+			}
+			const auto expected = 2.0 * integral * step / 3.0 / (offset * offset);
+			ASSERT_NEAR(waveshaper.process(peak), expected, 1.0e-8);
+		}
+	}
+
+	TEST(WaveShaperADAATest, parameterChanges) {
+		auto waveshaper = SoftSaturationADAA<double>(0.5, 0.7, ADAAOrder::Second);
+		waveshaper.setAmount(2.0);
+		waveshaper.setSlope(1.5);
+		ASSERT_EQ(waveshaper.getAmount(), 2.0);
+		ASSERT_EQ(waveshaper.getSlope(), 1.5);
+		checkADAA(waveshaper, SoftSaturationAntiderivatives(2.0, 1.5), 1.0e-4);
+
+		// a change mid-stream doesn't glitch: the output moves straight to the new shape
+		auto clipper = HardClipADAA<double>(0.8, 0.5, ADAAOrder::Second);
+		for(auto i = 0; i < 4; ++i) {
+			static_cast<void>(clipper.process(0.5));
+		}
+		clipper.setAmount(1.0);
+		clipper.setClipLevel(0.6);
+		ASSERT_EQ(clipper.getClipLevel(), 0.6);
+		const auto expected = HardClipAntiderivatives{0.6, 1.0}.value(0.5);
+		ASSERT_NEAR(clipper.process(0.5), expected, 1.0e-12);
+	}
+} // namespace apex::dsp::test
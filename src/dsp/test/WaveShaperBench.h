@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../test/Benchmark.h"
+#include "../WaveShaper.h"
+#include "../filters/test/BiQuadFilterBench.h"
+#include "../gainstages/GainStageFET.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Times each waveshaper a sample at a time against its block version
+	template<typename FloatType>
+	inline auto benchmarkWaveshapers(const std::string& typeName) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+		for(auto& sample : input) {
+			sample *= static_cast<FloatType>(2.0);
+		}
+		const auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		const auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+		const auto amount = narrow_cast<FloatType>(0.5);
+		const auto slope = narrow_cast<FloatType>(0.7);
+		const auto clipLevel = narrow_cast<FloatType>(0.8);
+
+		auto softSaturationNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				output.at(i) = waveshapers::softSaturation<FloatType>(input.at(i), amount, slope);
+			}
+			doNotOptimize(output.back());
+		});
+		auto softSaturationBlockNanos = benchmarkNanoseconds([&]() {
+			waveshapers::softSaturation<FloatType>(inputSpan, outputSpan, amount, slope);
+			doNotOptimize(output.back());
+		});
+		auto softClipNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				output.at(i) = waveshapers::softClip<FloatType>(input.at(i), amount);
+			}
+			doNotOptimize(output.back());
+		});
+		auto softClipBlockNanos = benchmarkNanoseconds([&]() {
+			waveshapers::softClip<FloatType>(inputSpan, outputSpan, amount);
+			doNotOptimize(output.back());
+		});
+		auto hardClipNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				output.at(i) = waveshapers::hardClip<FloatType>(input.at(i), clipLevel, amount);
+			}
+			doNotOptimize(output.back());
+		});
+		auto hardClipBlockNanos = benchmarkNanoseconds([&]() {
+			waveshapers::hardClip<FloatType>(inputSpan, outputSpan, clipLevel, amount);
+			doNotOptimize(output.back());
+		});
+
+		// the FET stage through its virtual interface, per sample and per block
+		auto stage = GainStageFET<FloatType>();
+		GainStage<FloatType>& base = stage;
+		auto stageNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				output.at(i) = base.process(input.at(i));
+			}
+			doNotOptimize(output.back());
+		});
+		auto stageBlockNanos = benchmarkNanoseconds([&]() {
+			base.process(inputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("softSaturation<" + typeName + ">, per sample", softSaturationNanos / size);
+		reportBenchmark("softSaturation<" + typeName + ">, block", softSaturationBlockNanos / size);
+		reportBenchmark("softClip<" + typeName + ">, per sample", softClipNanos / size);
+		reportBenchmark("softClip<" + typeName + ">, block", softClipBlockNanos / size);
+		reportBenchmark("hardClip<" + typeName + ">, per sample", hardClipNanos / size);
+		reportBenchmark("hardClip<" + typeName + ">, block", hardClipBlockNanos / size);
+		reportBenchmark("GainStageFET<" + typeName + ">, per sample", stageNanos / size);
+		reportBenchmark("GainStageFET<" + typeName + ">, block", stageBlockNanos / size);
+	}
+
+	TEST(WaveShaperBench, throughputFloat) {
+		benchmarkWaveshapers<float>("float");
+	}
+
+	TEST(WaveShaperBench, throughputDouble) {
+		benchmarkWaveshapers<double>("double");
+	}
+} // namespace apex::dsp::test
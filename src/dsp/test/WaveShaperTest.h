@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cmath>
+#include <vector>
+
 #include "../../test/TestConstants.h"
 #include "../WaveShaper.h"
 #include "gtest/gtest.h"
@@ -85,4 +88,76 @@ namespace apex::dsp::test {
 					expected,
 					DOUBLE_ACCEPTED_ERROR);
 	}
+
+	/// @brief Checks the block waveshapers against the single sample ones, out of place and in
+	/// place, over a block that isn't a whole number of chunks
+	template<typename FloatType>
+	inline auto checkBlockWaveshapers(double acceptedError) -> void {
+		constexpr size_t size = waveshapers::WAVESHAPER_CHUNK_SIZE * 3 + 7;
+		auto input = std::vector<FloatType>(size);
+		for(auto i = 0U; i < size; ++i) {
+			input.at(i) = static_cast<FloatType>(-2.0 + 4.0 * i / (size - 1));
+		}
+		input.at(size / 2) = static_cast<FloatType>(0.0);
+		const auto inputSpan = utils::Span<const FloatType>::MakeSpan(input.data(), size);
+		auto output = std::vector<FloatType>(size);
+		const auto outputSpan = utils::Span<FloatType>::MakeSpan(output.data(), size);
+		const auto amount = static_cast<FloatType>(2.0);
+		const auto slope = static_cast<FloatType>(0.8);
+		const auto clipLevel = static_cast<FloatType>(0.9);
+
+		waveshapers::softSaturation<FloatType>(inputSpan, outputSpan, amount, slope);
+		for(auto i = 0U; i < size; ++i) {
+			const auto x = static_cast<double>(input.at(i));
+			// checked against the exact function rather than the single sample version, whose
+			// `pow` is a much coarser approximation for small inputs
+			ASSERT_NEAR(output.at(i),
+						x * 3.0 / (1.0 + 2.0 * std::pow(std::abs(x), 0.8)),
+						acceptedError * 1.0e-2);
+		}
+
+		waveshapers::softClip<FloatType>(inputSpan, outputSpan, amount);
+		for(auto i = 0U; i < size; ++i) {
+			const auto x = static_cast<double>(input.at(i));
+			// the single sample version's absolute value is an approximate root of the square,
+			// which fast-math makes 0 * infinity at zero
+			if(input.at(i) != static_cast<FloatType>(0.0)) {
+				ASSERT_NEAR(output.at(i),
+							waveshapers::softClip<FloatType>(input.at(i), amount),
+							acceptedError);
+			}
+			ASSERT_NEAR(output.at(i), x * 3.0 / (1.0 + 2.0 * std::abs(x)), acceptedError * 1.0e-2);
+		}
+
+		waveshapers::hardClip<FloatType>(inputSpan, outputSpan, clipLevel, amount);
+		for(auto i = 0U; i < size; ++i) {
+			const auto x = static_cast<double>(input.at(i));
+			const auto shaped = x * 3.0 / (1.0 + 2.0 * std::abs(x));
+			const auto expected = std::abs(shaped) > 0.9 ? std::copysign(0.9, shaped) : shaped;
+			// the single sample version divides zero by zero to get its sign
+			if(input.at(i) != static_cast<FloatType>(0.0)) {
+				ASSERT_NEAR(output.at(i),
+							waveshapers::hardClip<FloatType>(input.at(i), clipLevel, amount),
+							acceptedError);
+			}
+			ASSERT_NEAR(output.at(i), expected, acceptedError * 1.0e-2);
+		}
+
+		auto inPlace = input;
+		waveshapers::softSaturation<FloatType>(
+			utils::Span<const FloatType>::MakeSpan(inPlace.data(), size),
+			utils::Span<FloatType>::MakeSpan(inPlace.data(), size),
+			amount,
+			slope);
+		waveshapers::softSaturation<FloatType>(inputSpan, outputSpan, amount, slope);
+		ASSERT_EQ(inPlace, output);
+	}
+
+	TEST(WaveShaperTestFloat, blockWaveshapers) {
+		checkBlockWaveshapers<float>(FLOAT_ACCEPTED_ERROR);
+	}
+
+	TEST(WaveShaperTestDouble, blockWaveshapers) {
+		checkBlockWaveshapers<double>(DOUBLE_ACCEPTED_ERROR);
+	}
 } // namespace apex::dsp::test
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../test/Benchmark.h"
+#include "../WaveShaper.h"
+#include "../WaveshaperTable.h"
+#include "../filters/test/BiQuadFilterBench.h"
+#include "../processors/test/OverSamplerBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+	/// The number of timed table rebuilds, each of which evaluates the shape thousands of times
+	static const constexpr size_t NUM_REBUILDS = 64;
+
+	/// @brief Times `softSaturation` evaluated from tables, against the block waveshaper
+	template<typename FloatType>
+	inline auto benchmarkWaveshaperTables(const std::string& typeName) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		fillWithNoise(input);
+		for(auto& sample : input) {
+			sample *= static_cast<FloatType>(2.0);
+		}
+		const auto inputSpan = Span<const FloatType>::MakeSpan(input.data(), input.size());
+		const auto outputSpan = Span<FloatType>::MakeSpan(output.data(), output.size());
+		const auto amount = narrow_cast<FloatType>(0.5);
+		const auto slope = narrow_cast<FloatType>(0.7);
+
+		auto blockNanos = benchmarkNanoseconds([&]() {
+			waveshapers::softSaturation<FloatType>(inputSpan, outputSpan, amount, slope);
+			doNotOptimize(output.back());
+		});
+
+		auto table = WaveshaperTable<FloatType>::softSaturation(amount, slope);
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("softSaturation<" + typeName + ">, block", blockNanos / size);
+		const auto interpolations
+			= {WaveshaperInterpolation::Linear, WaveshaperInterpolation::Cubic};
+		for(auto interpolation : interpolations) {
+			const auto name = std::string(interpolation == WaveshaperInterpolation::Linear ?
+											  "linear" :
+											  "cubic");
+			table.prepare(narrow_cast<FloatType>(-2.0),
+						  narrow_cast<FloatType>(2.0),
+						  WaveshaperTable<FloatType>::DEFAULT_NUM_POINTS,
+						  interpolation);
+			auto tableNanos = benchmarkNanoseconds([&]() {
+				table.process(inputSpan, outputSpan);
+				doNotOptimize(output.back());
+			});
+			reportBenchmark("WaveshaperTable<" + typeName + ">, " + name, tableNanos / size);
+			reportMeasurement("ERROR",
+							  "WaveshaperTable<" + typeName + ">, " + name,
+							  20.0 * std::log10(static_cast<double>(table.getMaxError())),
+							  "dB");
+		}
+
+		// how long a parameter change takes to rebuild the table
+		auto rebuildNanos = benchmarkNanoseconds(
+			[&]() {
+				table.setSlope(table.getSlope() == slope ? slope * narrow_cast<FloatType>(0.9) :
+															 slope);
+				doNotOptimize(table.getMaxError());
+			},
+			NUM_REBUILDS);
+		reportBenchmark("WaveshaperTable<" + typeName + ">, cubic", rebuildNanos, "rebuild");
+	}
+
+	TEST(WaveshaperTableBench, throughputFloat) {
+		benchmarkWaveshaperTables<float>("float");
+	}
+
+	TEST(WaveshaperTableBench, throughputDouble) {
+		benchmarkWaveshaperTables<double>("double");
+	}
+} // namespace apex::dsp::test
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "../WaveshaperTable.h"
+#include "gtest/gtest.h"
+
+namespace apex::dsp::test {
+
+	/// @brief Checks a table against the shape it was built from, between and beyond its points
+	template<typename FloatType>
+	inline auto checkTable(WaveshaperTable<FloatType>&& table,
+						   const std::function<FloatType(FloatType)>& shape,
+						   WaveshaperInterpolation interpolation,
+						   double acceptedError) -> void {
+		constexpr size_t numPoints = 257;
+		constexpr size_t samplesPerSegment = 13;
+		const auto range = static_cast<FloatType>(2.0);
+		table.prepare(-range, range, numPoints, interpolation);
+		ASSERT_EQ(table.getInterpolation(), interpolation);
+		ASSERT_LE(static_cast<double>(table.getMaxError()), acceptedError);
+
+		const auto size = (numPoints - 1) * samplesPerSegment + 1;
+		auto input = std::vector<FloatType>(size);
+		for(auto i = 0U; i < size; ++i) {
+			input.at(i) = -range
+						  + static_cast<FloatType>(2.0) * range * static_cast<FloatType>(i)
+								/ static_cast<FloatType>(size - 1);
+		}
+		auto output = std::vector<FloatType>(size);
+		table.process(Span<const FloatType>::MakeSpan(input.data(), input.size()),
+					  Span<FloatType>::MakeSpan(output.data(), output.size()));
+		// the error is measured at the quarters of each segment, which is close to, but not
+		// always exactly at, the largest error
+		const auto tolerance = 2.0 * static_cast<double>(table.getMaxError());
+		for(auto i = 0U; i < size; ++i) {
+			ASSERT_EQ(output.at(i), table.process(input.at(i)));
+			ASSERT_NEAR(static_cast<double>(output.at(i)),
+						static_cast<double>(shape(input.at(i))),
+						tolerance + static_cast<double>(std::numeric_limits<FloatType>::epsilon()));
+		}
+
+		// inputs beyond the range are clamped to it
+		ASSERT_EQ(table.process(static_cast<FloatType>(10.0)), table.process(range));
+		ASSERT_EQ(table.process(static_cast<FloatType>(-10.0)), table.process(-range));
+		ASSERT_NEAR(static_cast<double>(table.process(range)),
+					static_cast<double>(shape(range)),
+					tolerance + static_cast<double>(std::numeric_limits<FloatType>::epsilon()));
+
+		// in place gives the same result
+		auto inPlace = input;
+		table.process(Span<const FloatType>::MakeSpan(inPlace.data(), inPlace.size()),
+					  Span<FloatType>::MakeSpan(inPlace.data(), inPlace.size()));
+		ASSERT_EQ(inPlace, output);
+	}
+
+	/// @brief Checks tables of the built-in shapes against the exact shapes. The errors accepted
+	/// are for shapes that are smooth, have a cusp (at zero) and have a kink (at the clip level)
+	template<typename FloatType>
+	inline auto checkTables(WaveshaperInterpolation interpolation,
+							double smoothError,
+							double cuspError,
+							double kinkError) -> void {
+		const auto amount = 0.5;
+		const auto clipLevel = 0.8;
+		// the exact shapes, which the tables should match to within their errors
+		const auto softSaturation = [&](FloatType input, double slope) {
+			const auto x = static_cast<double>(input);
+			return static_cast<FloatType>(x * (1.0 + amount)
+										  / (1.0 + amount * std::pow(std::abs(x), slope)));
+		};
+		const auto softClip = [&](FloatType input) {
+			const auto x = static_cast<double>(input);
+			return static_cast<FloatType>(x * (1.0 + amount) / (1.0 + amount * std::abs(x)));
+		};
+
+		checkTable<FloatType>(
+			WaveshaperTable<FloatType>::softSaturation(static_cast<FloatType>(amount),
+													   static_cast<FloatType>(0.7)),
+			[&](FloatType input) { return softSaturation(input, 0.7); },
+			interpolation,
+			cuspError);
+		checkTable<FloatType>(
+			WaveshaperTable<FloatType>::softSaturation(static_cast<FloatType>(amount),
+													   static_cast<FloatType>(2.0)),
+			[&](FloatType input) { return softSaturation(input, 2.0); },
+			interpolation,
+			smoothError);
+		checkTable<FloatType>(WaveshaperTable<FloatType>::softClip(static_cast<FloatType>(amount)),
+							  softClip,
+							  interpolation,
+							  cuspError);
+		checkTable<FloatType>(
+			WaveshaperTable<FloatType>::hardClip(static_cast<FloatType>(clipLevel),
+												 static_cast<FloatType>(amount)),
+			[&](FloatType input) {
+				const auto clipped = softClip(input);
+				return std::abs(clipped) > static_cast<FloatType>(clipLevel) ?
+						   std::copysign(static_cast<FloatType>(clipLevel), clipped) :
+						   clipped;
+			},
+			interpolation,
+			kinkError);
+	}
+
+	TEST(WaveshaperTableTest, linearFloat) {
+		checkTables<float>(WaveshaperInterpolation::Linear, 1.0e-4, 2.0e-4, 5.0e-3);
+	}
+
+	TEST(WaveshaperTableTest, linearDouble) {
+		checkTables<double>(WaveshaperInterpolation::Linear, 1.0e-4, 2.0e-4, 5.0e-3);
+	}
+
+	TEST(WaveshaperTableTest, cubicFloat) {
+		checkTables<float>(WaveshaperInterpolation::Cubic, 5.0e-7, 1.0e-4, 5.0e-3);
+	}
+
+	TEST(WaveshaperTableTest, cubicDouble) {
+		checkTables<double>(WaveshaperInterpolation::Cubic, 5.0e-8, 1.0e-4, 5.0e-3);
+	}
+
+	TEST(WaveshaperTableTest, rebuildsOnlyOnChange) {
+		const auto shape = [](float input, float amount, float slope) {
+			return waveshapers::softSaturation(input, amount, slope);
+		};
+		auto numCalls = 0U;
+		auto table = WaveshaperTable<float>(
+			[&numCalls, &shape](float input, float amount, float slope) {
+				++numCalls;
+				return shape(input, amount, slope);
+			},
+			1.0F,
+			0.4F);
+		table.prepare(-1.0F, 1.0F, 65);
+
+		numCalls = 0U;
+		table.setAmount(1.0F);
+		table.setSlope(0.4F);
+		ASSERT_EQ(numCalls, 0U);
+
+		table.setAmount(2.0F);
+		ASSERT_GT(numCalls, 0U);
+		ASSERT_EQ(table.getAmount(), 2.0F);
+		numCalls = 0U;
+		table.setSlope(0.9F);
+		ASSERT_GT(numCalls, 0U);
+		ASSERT_EQ(table.getSlope(), 0.9F);
+
+		// rebuilding gives the same table as building with the new parameters from the start
+		auto rebuilt = WaveshaperTable<float>(shape, 2.0F, 0.9F);
+		rebuilt.prepare(-1.0F, 1.0F, 65);
+		for(auto input = -1.0F; input <= 1.0F; input += 0.01F) {
+			ASSERT_EQ(table.process(input), rebuilt.process(input));
+		}
+	}
+} // namespace apex::dsp::test
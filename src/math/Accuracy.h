@@ -0,0 +1,30 @@
+#pragma once
+
+namespace apex::math {
+	/// @brief The accuracy tiers of the approximations in `Exponentials`, `Trig` and
+	/// `General::sqrt`, chosen at compile time
+	///
+	/// The tiers give the same results with any standard library, and at compile time, which is
+	/// the reason to use `Balanced` or `Precise` where they cost more than their `std::`
+	/// equivalents. Under fast-math, compilers vectorize loops of `std::` calls with their
+	/// vector math libraries, which none of the single value functions match; loops should use
+	/// the block functions of `Exponentials` instead, where they exist
+	enum class Accuracy
+	{
+		/// Around 1e-4 error, up to 2e-3 for `sqrt`, for as little CPU as possible: meter
+		/// ballistics, UI curves, and anything else that ends up as pixels. Errors are relative,
+		/// except for sine, cosine, arctangent and hyperbolic tangent, where they're absolute.
+		/// The cheapest tier of every function
+		Fast = 0,
+		/// The default: hand-tuned approximations, accurate near the middle of their ranges, but
+		/// with errors that grow towards the edges. The float exponentials and logarithms branch
+		/// on the range of their input, so they cost more than the `Precise` kernels, but they're
+		/// kept as the default so existing results don't change
+		Balanced,
+		/// Within 4 ULP of the exact result, or 5 for hyperbolic tangent, for filter coefficient
+		/// design and anything else whose errors compound, with or without fast-math. Sine,
+		/// cosine and tangent reduce their angle in double, and hyperbolic tangent sums a series
+		/// near zero, so they cost more than `std::`
+		Precise
+	};
+} // namespace apex::math
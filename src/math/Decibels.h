@@ -2,7 +2,9 @@
 
 #include <gsl/gsl>
 
+#include "../utils/Span.h"
 #include "Exponentials.h"
+#include "General.h"
 
 namespace apex::math {
 
@@ -16,35 +18,52 @@ namespace apex::math {
 
 	/// @brief Basic class for working with decibel values and converting from decibels to linear
 	/// and vice versa
-	class Decibels {
+	///
+	/// @tparam FloatType - The floating point type the decibel value is stored as. `Decibels`
+	/// stores a double, and `DecibelsF` a float, for use in float processing
+	template<typename FloatType = double,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class BasicDecibels {
 	  public:
-		static const constexpr double MINUS_INFINITY_DB = -100.0;
+		static const constexpr FloatType MINUS_INFINITY_DB = narrow_cast<FloatType>(-100.0);
 
 		/// @brief Constructs a `Decibels` with a value of minus infinity db
-		constexpr Decibels() noexcept = default;
+		constexpr BasicDecibels() noexcept = default;
 
 		/// @brief Constructs a `Decibels` with the given decibel value
 		///
 		/// @param decibels - The decibel value
-		constexpr Decibels(float decibels) noexcept : mValue(decibels) {
+		constexpr BasicDecibels(float decibels) noexcept : mValue(decibels) {
 		}
 
 		/// @brief Constructs a `Decibels` with the given decibel value
 		///
 		/// @param decibels - The decibel value
-		constexpr Decibels(double decibels) noexcept : mValue(decibels) {
+		constexpr BasicDecibels(double decibels) noexcept
+			: mValue(narrow_cast<FloatType>(decibels)) {
+		}
+
+		/// @brief Constructs a `BasicDecibels` from one of another precision. Widening, eg a
+		/// `DecibelsF` to a `Decibels`, is implicit, and narrowing explicit
+		///
+		/// @param decibels - The decibel value
+		template<typename OtherFloatType,
+				 std::enable_if_t<!std::is_same_v<OtherFloatType, FloatType>, bool> = true>
+		constexpr explicit(sizeof(OtherFloatType) > sizeof(FloatType))
+			BasicDecibels(BasicDecibels<OtherFloatType> decibels) noexcept
+			: mValue(narrow_cast<FloatType>(decibels.getDecibels())) {
 		}
 
 		/// @brief Copy constructs a `Decibels` from the given one
 		///
 		/// @param decibels - The `Decibels` to copy
-		constexpr Decibels(const Decibels& decibels) noexcept = default;
+		constexpr BasicDecibels(const BasicDecibels& decibels) noexcept = default;
 
 		/// @brief Move constructs the given `Decibels`
 		///
 		/// @param decibels - The `Decibels` to move
-		constexpr Decibels(Decibels&& decibels) noexcept = default;
-		~Decibels() noexcept = default;
+		constexpr BasicDecibels(BasicDecibels&& decibels) noexcept = default;
+		~BasicDecibels() noexcept = default;
 
 		/// @brief Converts the given linear value to the corresponding Decibel value
 		///
@@ -86,7 +105,8 @@ namespace apex::math {
 		///
 		/// @param decibels - The decibel value to convert
 		/// @return - The corresponding linear value
-		[[nodiscard]] static inline constexpr auto toLinear(Decibels decibels) noexcept -> double {
+		[[nodiscard]] static inline constexpr auto
+		toLinear(BasicDecibels decibels) noexcept -> FloatType {
 			return decibelsToLinear(decibels.mValue);
 		}
 
@@ -94,22 +114,76 @@ namespace apex::math {
 		///
 		/// @param linear - The linear value to convert
 		/// @return - The corresponding decibel value
-		[[nodiscard]] static inline constexpr auto fromLinear(float linear) noexcept -> Decibels {
-			return Decibels(linearToDecibels(linear));
+		[[nodiscard]] static inline constexpr auto
+		fromLinear(float linear) noexcept -> BasicDecibels {
+			return BasicDecibels(linearToDecibels(linear));
 		}
 
 		/// @brief Converts the given linear value to a decibel value
 		///
 		/// @param linear - The linear value to convert
 		/// @return - The corresponding decibel value
-		[[nodiscard]] static inline constexpr auto fromLinear(double linear) noexcept -> Decibels {
-			return Decibels(linearToDecibels(linear));
+		[[nodiscard]] static inline constexpr auto
+		fromLinear(double linear) noexcept -> BasicDecibels {
+			return BasicDecibels(linearToDecibels(linear));
+		}
+
+		/// @brief Converts a block of Decibel values to linear values, with the block
+		/// `Exponentials::pow10`, which the compiler can vectorize
+		///
+		/// @param decibels - The Decibel values to convert
+		/// @param linear - Where to write the linear values; Must be the same size as
+		/// `decibels`, and may be the same memory
+		static inline auto
+		toLinear(utils::Span<const float> decibels, utils::Span<float> linear) noexcept -> void {
+			blockToLinear<float>(decibels, linear);
+		}
+
+		/// @brief Converts a block of Decibel values to linear values, a value at a time with
+		/// `decibelsToLinear`: with two doubles to a vector, the block `Exponentials::pow10` is no
+		/// faster than it
+		///
+		/// @param decibels - The Decibel values to convert
+		/// @param linear - Where to write the linear values; Must be the same size as
+		/// `decibels`, and may be the same memory
+		static inline auto
+		toLinear(utils::Span<const double> decibels, utils::Span<double> linear) noexcept -> void {
+			const auto* in = decibels.data();
+			auto* out = linear.data();
+			const auto size = decibels.size();
+			for(size_t index = 0; index < size; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[index] = decibelsToLinear(in[index]);
+			}
+		}
+
+		/// @brief Converts a block of linear values to Decibel values, with the block
+		/// `Exponentials::log10`, which the compiler can vectorize. Values below the linear value
+		/// of `MINUS_INFINITY_DB`, including zero, give `MINUS_INFINITY_DB`
+		///
+		/// @param linear - The linear values to convert; Must be non-negative
+		/// @param decibels - Where to write the Decibel values; Must be the same size as
+		/// `linear`, and may be the same memory
+		static inline auto
+		fromLinear(utils::Span<const float> linear, utils::Span<float> decibels) noexcept -> void {
+			blockFromLinear<float>(linear, decibels);
+		}
+
+		/// @brief Converts a block of linear values to Decibel values. See the float `fromLinear`
+		///
+		/// @param linear - The linear values to convert; Must be non-negative
+		/// @param decibels - Where to write the Decibel values; Must be the same size as
+		/// `linear`, and may be the same memory
+		static inline auto
+		fromLinear(utils::Span<const double> linear, utils::Span<double> decibels) noexcept
+			-> void {
+			blockFromLinear<double>(linear, decibels);
 		}
 
 		/// @brief Returns the decibel value of this
 		///
 		/// @return - The value of this
-		[[nodiscard]] constexpr inline auto getDecibels() const noexcept -> double {
+		[[nodiscard]] constexpr inline auto getDecibels() const noexcept -> FloatType {
 			return mValue;
 		}
 
@@ -117,512 +191,561 @@ namespace apex::math {
 		///
 		/// @param decibels - The value to set this to, in decibels
 		constexpr inline auto setFromDecibels(float decibels) noexcept -> void {
-			mValue = decibels;
+			mValue = narrow_cast<FloatType>(decibels);
 		}
 
 		/// @brief Sets this to the given decibel value
 		///
 		/// @param decibels - The value to set this to, in decibels
 		constexpr inline auto setFromDecibels(double decibels) noexcept -> void {
-			mValue = decibels;
+			mValue = narrow_cast<FloatType>(decibels);
 		}
 
 		/// @brief Sets this to the given decibel vlaue
 		///
 		/// @param decibels - The value to set this to
-		constexpr inline auto setFromDecibels(Decibels decibels) noexcept -> void {
+		constexpr inline auto setFromDecibels(BasicDecibels decibels) noexcept -> void {
 			mValue = decibels.mValue;
 		}
 
 		/// @brief Returns the linear value of this
 		///
+		/// @tparam Type - The floating point type to calculate the linear value in, so a
+		/// `Decibels` used in float processing needn't calculate it in double
 		/// @return - The linear value of this
-		[[nodiscard]] constexpr inline auto getLinear() const noexcept -> double {
-			return decibelsToLinear(mValue);
+		template<typename Type = FloatType,
+				 std::enable_if_t<std::is_floating_point_v<Type>, bool> = true>
+		[[nodiscard]] constexpr inline auto getLinear() const noexcept -> Type {
+			return decibelsToLinear(narrow_cast<Type>(mValue));
 		}
 
 		/// @brief Sets the this to the given linear value
 		///
 		/// @param linear - The linear value to set this to
 		constexpr inline auto setFromLinear(double linear) noexcept -> void {
-			mValue = linearToDecibels(linear);
+			mValue = narrow_cast<FloatType>(linearToDecibels(linear));
 		}
 
 		/// @brief Sets the this to the given linear value
 		///
 		/// @param linear - The linear value to set this to
 		constexpr inline auto setFromLinear(float linear) noexcept -> void {
-			mValue = linearToDecibels(linear);
+			mValue = narrow_cast<FloatType>(linearToDecibels(linear));
 		}
 
 		friend constexpr inline auto
-		operator+(const Decibels& lhs, float rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue + rhs);
+		operator+(const BasicDecibels& lhs, float rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue + rhs);
 		}
 
 		friend constexpr inline auto
-		operator+(const Decibels& lhs, double rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue + rhs);
+		operator+(const BasicDecibels& lhs, double rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue + rhs);
 		}
 
 		friend constexpr inline auto
-		operator+(const Decibels& lhs, int64_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue + narrow_cast<double>(rhs));
+		operator+(const BasicDecibels& lhs, int64_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue + narrow_cast<FloatType>(rhs));
 		}
 
 		friend constexpr inline auto
-		operator+(const Decibels& lhs, size_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue + narrow_cast<double>(rhs));
+		operator+(const BasicDecibels& lhs, size_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue + narrow_cast<FloatType>(rhs));
 		}
 
 		friend constexpr inline auto
-		operator+(float lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs + rhs.mValue);
+		operator+(float lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs + rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator+(double lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs + rhs.mValue);
+		operator+(double lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs + rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator+(int64_t lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(narrow_cast<double>(lhs) + rhs.mValue);
+		operator+(int64_t lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(narrow_cast<FloatType>(lhs) + rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator+(size_t lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(narrow_cast<double>(lhs) + rhs.mValue);
+		operator+(size_t lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(narrow_cast<FloatType>(lhs) + rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator+(const Decibels& lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue + rhs.mValue);
+		operator+(const BasicDecibels& lhs, const BasicDecibels& rhs) noexcept
+			-> BasicDecibels {
+			return BasicDecibels(lhs.mValue + rhs.mValue);
 		}
 
-		constexpr inline auto operator+=(float rhs) noexcept -> Decibels& {
-			mValue += rhs;
+		constexpr inline auto operator+=(float rhs) noexcept -> BasicDecibels& {
+			mValue += narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator+=(double rhs) noexcept -> Decibels& {
-			mValue += rhs;
+		constexpr inline auto operator+=(double rhs) noexcept -> BasicDecibels& {
+			mValue += narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator+=(int64_t rhs) noexcept -> Decibels {
-			mValue += narrow_cast<double>(rhs);
+		constexpr inline auto operator+=(int64_t rhs) noexcept -> BasicDecibels {
+			mValue += narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator+=(size_t rhs) noexcept -> Decibels {
-			mValue += narrow_cast<double>(rhs);
+		constexpr inline auto operator+=(size_t rhs) noexcept -> BasicDecibels {
+			mValue += narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator+=(const Decibels& rhs) noexcept -> Decibels& {
+		constexpr inline auto operator+=(const BasicDecibels& rhs) noexcept -> BasicDecibels& {
 			mValue += rhs.mValue;
 			return *this;
 		}
 
 		friend constexpr inline auto
-		operator-(const Decibels& lhs, float rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue - rhs);
+		operator-(const BasicDecibels& lhs, float rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue - rhs);
 		}
 
 		friend constexpr inline auto
-		operator-(const Decibels& lhs, double rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue - rhs);
+		operator-(const BasicDecibels& lhs, double rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue - rhs);
 		}
 
 		friend constexpr inline auto
-		operator-(const Decibels& lhs, int64_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue - narrow_cast<double>(rhs));
+		operator-(const BasicDecibels& lhs, int64_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue - narrow_cast<FloatType>(rhs));
 		}
 
 		friend constexpr inline auto
-		operator-(const Decibels& lhs, size_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue - narrow_cast<double>(rhs));
+		operator-(const BasicDecibels& lhs, size_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue - narrow_cast<FloatType>(rhs));
 		}
 
 		friend constexpr inline auto
-		operator-(float lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs - rhs.mValue);
+		operator-(float lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs - rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator-(double lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs - rhs.mValue);
+		operator-(double lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs - rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator-(int64_t lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(narrow_cast<double>(lhs) - rhs.mValue);
+		operator-(int64_t lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(narrow_cast<FloatType>(lhs) - rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator-(size_t lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(narrow_cast<double>(lhs) - rhs.mValue);
+		operator-(size_t lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(narrow_cast<FloatType>(lhs) - rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator-(const Decibels& lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue - rhs.mValue);
+		operator-(const BasicDecibels& lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue - rhs.mValue);
 		}
 
-		constexpr inline auto operator-=(float rhs) noexcept -> Decibels& {
-			mValue -= rhs;
+		constexpr inline auto operator-=(float rhs) noexcept -> BasicDecibels& {
+			mValue -= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator-=(double rhs) noexcept -> Decibels& {
-			mValue -= rhs;
+		constexpr inline auto operator-=(double rhs) noexcept -> BasicDecibels& {
+			mValue -= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator-=(int64_t rhs) noexcept -> Decibels& {
-			mValue -= narrow_cast<double>(rhs);
+		constexpr inline auto operator-=(int64_t rhs) noexcept -> BasicDecibels& {
+			mValue -= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator-=(size_t rhs) noexcept -> Decibels& {
-			mValue -= narrow_cast<double>(rhs);
+		constexpr inline auto operator-=(size_t rhs) noexcept -> BasicDecibels& {
+			mValue -= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator-=(const Decibels& rhs) noexcept -> Decibels& {
+		constexpr inline auto operator-=(const BasicDecibels& rhs) noexcept -> BasicDecibels& {
 			mValue -= rhs.mValue;
 			return *this;
 		}
 
-		friend constexpr inline auto operator-(const Decibels& lhs) noexcept -> Decibels {
-			return Decibels(-lhs.mValue);
+		friend constexpr inline auto operator-(const BasicDecibels& lhs) noexcept -> BasicDecibels {
+			return BasicDecibels(-lhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator*(const Decibels& lhs, float rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue * rhs);
+		operator*(const BasicDecibels& lhs, float rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue * rhs);
 		}
 
 		friend constexpr inline auto
-		operator*(const Decibels& lhs, double rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue * rhs);
+		operator*(const BasicDecibels& lhs, double rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue * rhs);
 		}
 
 		friend constexpr inline auto
-		operator*(const Decibels& lhs, int64_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue * narrow_cast<double>(rhs));
+		operator*(const BasicDecibels& lhs, int64_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue * narrow_cast<FloatType>(rhs));
 		}
 
 		friend constexpr inline auto
-		operator*(const Decibels& lhs, size_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue * narrow_cast<double>(rhs));
+		operator*(const BasicDecibels& lhs, size_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue * narrow_cast<FloatType>(rhs));
 		}
 
 		friend constexpr inline auto
-		operator*(float lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs * rhs.mValue);
+		operator*(float lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs * rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator*(double lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(lhs * rhs.mValue);
+		operator*(double lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs * rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator*(int64_t lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(narrow_cast<double>(lhs) * rhs.mValue);
+		operator*(int64_t lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(narrow_cast<FloatType>(lhs) * rhs.mValue);
 		}
 
 		friend constexpr inline auto
-		operator*(size_t lhs, const Decibels& rhs) noexcept -> Decibels {
-			return Decibels(narrow_cast<double>(lhs) * rhs.mValue);
+		operator*(size_t lhs, const BasicDecibels& rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(narrow_cast<FloatType>(lhs) * rhs.mValue);
 		}
 
-		constexpr inline auto operator*=(float rhs) noexcept -> Decibels& {
-			mValue *= rhs;
+		constexpr inline auto operator*=(float rhs) noexcept -> BasicDecibels& {
+			mValue *= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator*=(double rhs) noexcept -> Decibels& {
-			mValue *= rhs;
+		constexpr inline auto operator*=(double rhs) noexcept -> BasicDecibels& {
+			mValue *= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator*=(int64_t rhs) noexcept -> Decibels& {
-			mValue *= narrow_cast<double>(rhs);
+		constexpr inline auto operator*=(int64_t rhs) noexcept -> BasicDecibels& {
+			mValue *= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator*=(size_t rhs) noexcept -> Decibels& {
-			mValue *= narrow_cast<double>(rhs);
+		constexpr inline auto operator*=(size_t rhs) noexcept -> BasicDecibels& {
+			mValue *= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
 		friend constexpr inline auto
-		operator/(const Decibels& lhs, float rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue / rhs);
+		operator/(const BasicDecibels& lhs, float rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue / rhs);
 		}
 
 		friend constexpr inline auto
-		operator/(const Decibels& lhs, double rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue / rhs);
+		operator/(const BasicDecibels& lhs, double rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue / rhs);
 		}
 
 		friend constexpr inline auto
-		operator/(const Decibels& lhs, int64_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue / narrow_cast<double>(rhs));
+		operator/(const BasicDecibels& lhs, int64_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue / narrow_cast<FloatType>(rhs));
 		}
 
 		friend constexpr inline auto
-		operator/(const Decibels& lhs, size_t rhs) noexcept -> Decibels {
-			return Decibels(lhs.mValue / narrow_cast<double>(rhs));
+		operator/(const BasicDecibels& lhs, size_t rhs) noexcept -> BasicDecibels {
+			return BasicDecibels(lhs.mValue / narrow_cast<FloatType>(rhs));
 		}
 
-		friend constexpr inline auto operator/(float lhs, const Decibels& rhs) noexcept -> float {
+		friend constexpr inline auto
+		operator/(float lhs, const BasicDecibels& rhs) noexcept -> float {
 			return narrow_cast<float>(lhs / rhs.mValue);
 		}
 
-		friend constexpr inline auto operator/(double lhs, const Decibels& rhs) noexcept -> double {
+		friend constexpr inline auto
+		operator/(double lhs, const BasicDecibels& rhs) noexcept -> double {
 			return lhs / rhs.mValue;
 		}
 
 		friend constexpr inline auto
-		operator/(int64_t lhs, const Decibels& rhs) noexcept -> int64_t {
-			return static_cast<int64_t>(narrow_cast<double>(lhs) / rhs.mValue);
+		operator/(int64_t lhs, const BasicDecibels& rhs) noexcept -> int64_t {
+			return static_cast<int64_t>(narrow_cast<FloatType>(lhs) / rhs.mValue);
 		}
 
-		friend constexpr inline auto operator/(size_t lhs, const Decibels& rhs) noexcept -> size_t {
-			return static_cast<size_t>(narrow_cast<double>(lhs) / rhs.mValue);
+		friend constexpr inline auto
+		operator/(size_t lhs, const BasicDecibels& rhs) noexcept -> size_t {
+			return static_cast<size_t>(narrow_cast<FloatType>(lhs) / rhs.mValue);
 		}
 
-		constexpr inline auto operator/=(float rhs) noexcept -> Decibels& {
-			mValue /= rhs;
+		constexpr inline auto operator/=(float rhs) noexcept -> BasicDecibels& {
+			mValue /= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator/=(double rhs) noexcept -> Decibels& {
-			mValue /= rhs;
+		constexpr inline auto operator/=(double rhs) noexcept -> BasicDecibels& {
+			mValue /= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator/=(int64_t rhs) noexcept -> Decibels& {
-			mValue /= narrow_cast<double>(rhs);
+		constexpr inline auto operator/=(int64_t rhs) noexcept -> BasicDecibels& {
+			mValue /= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator/=(size_t rhs) noexcept -> Decibels& {
-			mValue /= narrow_cast<double>(rhs);
+		constexpr inline auto operator/=(size_t rhs) noexcept -> BasicDecibels& {
+			mValue /= narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		friend constexpr inline auto operator<(const Decibels& lhs, float rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(const BasicDecibels& lhs, float rhs) noexcept -> bool {
 			return lhs.mValue < rhs;
 		}
 
-		friend constexpr inline auto operator<(const Decibels& lhs, double rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(const BasicDecibels& lhs, double rhs) noexcept -> bool {
 			return lhs.mValue < rhs;
 		}
 
-		friend constexpr inline auto operator<(const Decibels& lhs, int64_t rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(const BasicDecibels& lhs, int64_t rhs) noexcept -> bool {
 			return lhs.mValue < rhs;
 		}
 
-		friend constexpr inline auto operator<(const Decibels& lhs, size_t rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(const BasicDecibels& lhs, size_t rhs) noexcept -> bool {
 			return lhs.mValue < rhs;
 		}
 
-		friend constexpr inline auto operator<(float lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(float lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs < rhs.mValue;
 		}
 
-		friend constexpr inline auto operator<(double lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(double lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs < rhs.mValue;
 		}
 
-		friend constexpr inline auto operator<(int64_t lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(int64_t lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs < rhs.mValue;
 		}
 
-		friend constexpr inline auto operator<(size_t lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<(size_t lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs < rhs.mValue;
 		}
 
 		friend constexpr inline auto
-		operator<(const Decibels& lhs, const Decibels& rhs) noexcept -> bool {
+		operator<(const BasicDecibels& lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs.mValue < rhs.mValue;
 		}
 
-		friend constexpr inline auto operator>(const Decibels& lhs, float rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(const BasicDecibels& lhs, float rhs) noexcept -> bool {
 			return lhs.mValue > rhs;
 		}
 
-		friend constexpr inline auto operator>(const Decibels& lhs, double rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(const BasicDecibels& lhs, double rhs) noexcept -> bool {
 			return lhs.mValue > rhs;
 		}
 
-		friend constexpr inline auto operator>(const Decibels& lhs, int64_t rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(const BasicDecibels& lhs, int64_t rhs) noexcept -> bool {
 			return lhs.mValue > rhs;
 		}
 
-		friend constexpr inline auto operator>(const Decibels& lhs, size_t rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(const BasicDecibels& lhs, size_t rhs) noexcept -> bool {
 			return lhs.mValue > rhs;
 		}
 
-		friend constexpr inline auto operator>(float lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(float lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs > rhs.mValue;
 		}
 
-		friend constexpr inline auto operator>(double lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(double lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs > rhs.mValue;
 		}
 
-		friend constexpr inline auto operator>(int64_t lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(int64_t lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs > rhs.mValue;
 		}
 
-		friend constexpr inline auto operator>(size_t lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>(size_t lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs > rhs.mValue;
 		}
 
 		friend constexpr inline auto
-		operator>(const Decibels& lhs, const Decibels& rhs) noexcept -> bool {
+		operator>(const BasicDecibels& lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs.mValue > rhs.mValue;
 		}
 
-		friend constexpr inline auto operator==(const Decibels& lhs, float rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator==(const BasicDecibels& lhs, float rhs) noexcept -> bool {
 			return lhs.mValue == rhs;
 		}
 
-		friend constexpr inline auto operator==(const Decibels& lhs, double rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator==(const BasicDecibels& lhs, double rhs) noexcept -> bool {
 			return lhs.mValue == rhs;
 		}
 
-		friend constexpr inline auto operator==(const Decibels& lhs, int64_t rhs) noexcept -> bool {
-			return lhs.mValue == narrow_cast<double>(rhs);
+		friend constexpr inline auto
+		operator==(const BasicDecibels& lhs, int64_t rhs) noexcept -> bool {
+			return lhs.mValue == narrow_cast<FloatType>(rhs);
 		}
 
-		friend constexpr inline auto operator==(const Decibels& lhs, size_t rhs) noexcept -> bool {
-			return lhs.mValue == narrow_cast<double>(rhs);
+		friend constexpr inline auto
+		operator==(const BasicDecibels& lhs, size_t rhs) noexcept -> bool {
+			return lhs.mValue == narrow_cast<FloatType>(rhs);
 		}
 
-		friend constexpr inline auto operator==(float lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator==(float lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs == rhs.mValue;
 		}
 
-		friend constexpr inline auto operator==(double lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator==(double lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs == rhs.mValue;
 		}
 
-		friend constexpr inline auto operator==(int64_t lhs, const Decibels& rhs) noexcept -> bool {
-			return narrow_cast<double>(lhs) == rhs.mValue;
+		friend constexpr inline auto
+		operator==(int64_t lhs, const BasicDecibels& rhs) noexcept -> bool {
+			return narrow_cast<FloatType>(lhs) == rhs.mValue;
 		}
 
-		friend constexpr inline auto operator==(size_t lhs, const Decibels& rhs) noexcept -> bool {
-			return narrow_cast<double>(lhs) == rhs.mValue;
+		friend constexpr inline auto
+		operator==(size_t lhs, const BasicDecibels& rhs) noexcept -> bool {
+			return narrow_cast<FloatType>(lhs) == rhs.mValue;
 		}
 
 		friend constexpr inline auto
-		operator==(const Decibels& lhs, const Decibels& rhs) noexcept -> bool {
+		operator==(const BasicDecibels& lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs.mValue == rhs.mValue;
 		}
 
-		friend constexpr inline auto operator<=(const Decibels& lhs, float rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<=(const BasicDecibels& lhs, float rhs) noexcept -> bool {
 			return lhs < rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator<=(const Decibels& lhs, double rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<=(const BasicDecibels& lhs, double rhs) noexcept -> bool {
 			return lhs < rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator<=(const Decibels& lhs, int64_t rhs) noexcept -> bool {
-			return lhs < rhs || lhs == narrow_cast<double>(rhs);
+		friend constexpr inline auto
+		operator<=(const BasicDecibels& lhs, int64_t rhs) noexcept -> bool {
+			return lhs < rhs || lhs == narrow_cast<FloatType>(rhs);
 		}
 
-		friend constexpr inline auto operator<=(const Decibels& lhs, size_t rhs) noexcept -> bool {
-			return lhs < rhs || lhs == narrow_cast<double>(rhs);
+		friend constexpr inline auto
+		operator<=(const BasicDecibels& lhs, size_t rhs) noexcept -> bool {
+			return lhs < rhs || lhs == narrow_cast<FloatType>(rhs);
 		}
 
-		friend constexpr inline auto operator<=(float lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<=(float lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs < rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator<=(double lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator<=(double lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs < rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator<=(int64_t lhs, const Decibels& rhs) noexcept -> bool {
-			return lhs < rhs || narrow_cast<double>(lhs) == rhs;
+		friend constexpr inline auto
+		operator<=(int64_t lhs, const BasicDecibels& rhs) noexcept -> bool {
+			return lhs < rhs || narrow_cast<FloatType>(lhs) == rhs;
 		}
 
-		friend constexpr inline auto operator<=(size_t lhs, const Decibels& rhs) noexcept -> bool {
-			return lhs < rhs || narrow_cast<double>(lhs) == rhs;
+		friend constexpr inline auto
+		operator<=(size_t lhs, const BasicDecibels& rhs) noexcept -> bool {
+			return lhs < rhs || narrow_cast<FloatType>(lhs) == rhs;
 		}
 
 		friend constexpr inline auto
-		operator<=(const Decibels& lhs, const Decibels& rhs) noexcept -> bool {
+		operator<=(const BasicDecibels& lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs < rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator>=(const Decibels& lhs, float rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>=(const BasicDecibels& lhs, float rhs) noexcept -> bool {
 			return lhs > rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator>=(const Decibels& lhs, double rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>=(const BasicDecibels& lhs, double rhs) noexcept -> bool {
 			return lhs > rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator>=(const Decibels& lhs, int64_t rhs) noexcept -> bool {
-			return lhs > rhs || lhs == narrow_cast<double>(rhs);
+		friend constexpr inline auto
+		operator>=(const BasicDecibels& lhs, int64_t rhs) noexcept -> bool {
+			return lhs > rhs || lhs == narrow_cast<FloatType>(rhs);
 		}
 
-		friend constexpr inline auto operator>=(const Decibels& lhs, size_t rhs) noexcept -> bool {
-			return lhs > rhs || lhs == narrow_cast<double>(rhs);
+		friend constexpr inline auto
+		operator>=(const BasicDecibels& lhs, size_t rhs) noexcept -> bool {
+			return lhs > rhs || lhs == narrow_cast<FloatType>(rhs);
 		}
 
-		friend constexpr inline auto operator>=(float lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>=(float lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs > rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator>=(double lhs, const Decibels& rhs) noexcept -> bool {
+		friend constexpr inline auto
+		operator>=(double lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs > rhs || lhs == rhs;
 		}
 
-		friend constexpr inline auto operator>=(int64_t lhs, const Decibels& rhs) noexcept -> bool {
-			return lhs > rhs || narrow_cast<double>(lhs) == rhs;
+		friend constexpr inline auto
+		operator>=(int64_t lhs, const BasicDecibels& rhs) noexcept -> bool {
+			return lhs > rhs || narrow_cast<FloatType>(lhs) == rhs;
 		}
 
-		friend constexpr inline auto operator>=(size_t lhs, const Decibels& rhs) noexcept -> bool {
-			return lhs > rhs || narrow_cast<double>(lhs) == rhs;
+		friend constexpr inline auto
+		operator>=(size_t lhs, const BasicDecibels& rhs) noexcept -> bool {
+			return lhs > rhs || narrow_cast<FloatType>(lhs) == rhs;
 		}
 
 		friend constexpr inline auto
-		operator>=(const Decibels& lhs, const Decibels& rhs) noexcept -> bool {
+		operator>=(const BasicDecibels& lhs, const BasicDecibels& rhs) noexcept -> bool {
 			return lhs > rhs || lhs == rhs;
 		}
 
-		constexpr inline auto operator=(const float& rhs) noexcept -> Decibels& {
-			mValue = rhs;
+		constexpr inline auto operator=(const float& rhs) noexcept -> BasicDecibels& {
+			mValue = narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator=(const double& rhs) noexcept -> Decibels& {
-			mValue = rhs;
+		constexpr inline auto operator=(const double& rhs) noexcept -> BasicDecibels& {
+			mValue = narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator=(const int64_t& rhs) noexcept -> Decibels& {
-			mValue = narrow_cast<double>(rhs);
+		constexpr inline auto operator=(const int64_t& rhs) noexcept -> BasicDecibels& {
+			mValue = narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator=(const size_t& rhs) noexcept -> Decibels& {
-			mValue = narrow_cast<double>(rhs);
+		constexpr inline auto operator=(const size_t& rhs) noexcept -> BasicDecibels& {
+			mValue = narrow_cast<FloatType>(rhs);
 			return *this;
 		}
 
-		constexpr inline auto operator=(const Decibels& rhs) noexcept -> Decibels& = default;
-		constexpr inline auto operator=(Decibels&& rhs) noexcept -> Decibels& = default;
+		constexpr inline auto
+		operator=(const BasicDecibels& rhs) noexcept -> BasicDecibels& = default;
+		constexpr inline auto operator=(BasicDecibels&& rhs) noexcept -> BasicDecibels& = default;
 
 		explicit constexpr inline operator float() const noexcept {
 			return narrow_cast<float>(mValue);
@@ -645,9 +768,52 @@ namespace apex::math {
 		}
 
 	  private:
-		double mValue = MINUS_INFINITY_DB;
+		FloatType mValue = MINUS_INFINITY_DB;
+
+		/// @brief Converts a block of Decibel values to linear values
+		///
+		/// @param decibels - The Decibel values to convert
+		/// @param linear - Where to write the linear values
+		template<typename Type>
+		static inline auto
+		blockToLinear(utils::Span<const Type> decibels, utils::Span<Type> linear) noexcept -> void {
+			const auto* in = decibels.data();
+			auto* out = linear.data();
+			const auto size = decibels.size();
+			constexpr auto scale = narrow_cast<Type>(1.0 / 20.0);
+			for(size_t index = 0; index < size; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[index] = in[index] * scale;
+			}
+			Exponentials<Type>::pow10(utils::Span<const Type>::MakeSpan(out, size), linear);
+		}
+
+		/// @brief Converts a block of linear values to Decibel values, floored at
+		/// `MINUS_INFINITY_DB`
+		///
+		/// @param linear - The linear values to convert
+		/// @param decibels - Where to write the Decibel values
+		template<typename Type>
+		static inline auto
+		blockFromLinear(utils::Span<const Type> linear, utils::Span<Type> decibels) noexcept
+			-> void {
+			Exponentials<Type>::log10(linear, decibels);
+			auto* out = decibels.data();
+			const auto size = linear.size();
+			constexpr auto scale = narrow_cast<Type>(20.0);
+			constexpr auto floor = narrow_cast<Type>(MINUS_INFINITY_DB);
+			for(size_t index = 0; index < size; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[index] = General<Type>::max(out[index] * scale, floor);
+			}
+		}
 	};
 
+	/// @brief Decibels stored as double
+	using Decibels = BasicDecibels<double>;
+	/// @brief Decibels stored as float
+	using DecibelsF = BasicDecibels<float>;
+
 	constexpr inline auto operator"" _dB(long double rhs) noexcept -> Decibels {
 		return Decibels(narrow_cast<double>(rhs));
 	}
@@ -1,19 +1,35 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
+#include <utility>
+
+#include "../utils/Span.h"
+#include "Accuracy.h"
 
 namespace apex::math {
 
 #ifndef _MSC_VER
+	using std::int32_t;
+	using std::int64_t;
+	using std::size_t;
 	using std::uint32_t;
 	using std::uint64_t;
 #endif
 
 	/// @brief Collection of approximations of various exponential functions
 	///
+	/// The `Balanced` tier uses the hand-tuned single value approximations. The `Fast` and
+	/// `Precise` tiers use the branch-free kernels of the block functions, with short and full
+	/// length series respectively, so they're also constexpr, and cheap enough to vectorize
+	///
 	/// @tparam Type - The floating point type to perform operations with
+	/// @tparam Tier - The accuracy of the approximations
 	template<typename FloatType = float,
+			 Accuracy Tier = Accuracy::Balanced,
 			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
 	class Exponentials {
 	  public:
@@ -41,7 +57,10 @@ namespace apex::math {
 		template<typename Type = FloatType,
 				 std::enable_if_t<std::is_same_v<FloatType, Type>, bool> = true>
 		[[nodiscard]] inline static constexpr auto exp(Type x) noexcept -> Type {
-			if constexpr(std::is_same_v<Type, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return exponentialKernel<POW_TERMS>(x, NATURAL);
+			}
+			else if constexpr(std::is_same_v<Type, float>) {
 				return expf_internal(x);
 			}
 			else {
@@ -56,7 +75,10 @@ namespace apex::math {
 		template<typename Type = FloatType,
 				 std::enable_if_t<std::is_same_v<FloatType, Type>, bool> = true>
 		[[nodiscard]] inline static constexpr auto ln(Type x) noexcept -> Type {
-			if constexpr(std::is_same_v<Type, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return logarithmKernel<LOG_TERMS>(x, NATURAL);
+			}
+			else if constexpr(std::is_same_v<Type, float>) {
 				return lnf_internal(x);
 			}
 			else {
@@ -71,7 +93,10 @@ namespace apex::math {
 		template<typename Type = FloatType,
 				 std::enable_if_t<std::is_same_v<FloatType, Type>, bool> = true>
 		[[nodiscard]] inline static constexpr auto log2(Type x) noexcept -> Type {
-			if constexpr(std::is_same_v<Type, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return logarithmKernel<LOG_TERMS>(x, BINARY);
+			}
+			else if constexpr(std::is_same_v<Type, float>) {
 				return log2f_internal(x);
 			}
 			else {
@@ -86,7 +111,10 @@ namespace apex::math {
 		template<typename Type = FloatType,
 				 std::enable_if_t<std::is_same_v<FloatType, Type>, bool> = true>
 		[[nodiscard]] inline static constexpr auto log10(Type x) noexcept -> Type {
-			if constexpr(std::is_same_v<Type, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return logarithmKernel<LOG_TERMS>(x, DECIMAL);
+			}
+			else if constexpr(std::is_same_v<Type, float>) {
 				return log10f_internal(x);
 			}
 			else {
@@ -101,7 +129,10 @@ namespace apex::math {
 		template<typename Type = FloatType,
 				 std::enable_if_t<std::is_same_v<FloatType, Type>, bool> = true>
 		[[nodiscard]] inline static constexpr auto pow2(Type x) noexcept -> Type {
-			if constexpr(std::is_same_v<Type, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return exponentialKernel<POW_TERMS>(x, BINARY);
+			}
+			else if constexpr(std::is_same_v<Type, float>) {
 				return pow2f_internal(x);
 			}
 			else {
@@ -116,7 +147,10 @@ namespace apex::math {
 		template<typename Type = FloatType,
 				 std::enable_if_t<std::is_same_v<FloatType, Type>, bool> = true>
 		[[nodiscard]] inline static constexpr auto pow10(Type x) noexcept -> Type {
-			if constexpr(std::is_same_v<Type, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return exponentialKernel<POW_TERMS>(x, DECIMAL);
+			}
+			else if constexpr(std::is_same_v<Type, float>) {
 				return pow10f_internal(x);
 			}
 			else {
@@ -132,7 +166,10 @@ namespace apex::math {
 		template<typename Type = FloatType,
 				 std::enable_if_t<std::is_same_v<FloatType, Type>, bool> = true>
 		[[nodiscard]] inline static constexpr auto pow(Type base, Type exponent) noexcept -> Type {
-			if constexpr(std::is_same_v<Type, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return powKernel(base, exponent);
+			}
+			else if constexpr(std::is_same_v<Type, float>) {
 				return powf_internal(base, exponent);
 			}
 			else {
@@ -140,7 +177,406 @@ namespace apex::math {
 			}
 		}
 
+		/// @brief Calculates base^exponent for a block of bases, all raised to the same exponent.
+		///
+		/// Unlike the single value approximations, this has no branches: each base is split into
+		/// its exponent and mantissa with bit operations, and log_2 and 2^x are evaluated with
+		/// fixed polynomials, so the compiler can vectorize the whole loop. The relative error is
+		/// a couple of ULP for results near one, and grows by up to one ULP per octave the result
+		/// is away from one. At the `Precise` tier, exponent * log_2(base) is carried in extra
+		/// precision, so the error stays within a few ULP over the whole range. At the `Fast`
+		/// tier the series are shorter, for around 1e-4 relative error. Results are clamped to
+		/// [2^-126, 2^126] for float, and [2^-1022, 2^1022] for double, so they're always normal
+		///
+		/// @param bases - The bases to use; Must be non-negative. A base of zero gives zero
+		/// @param exponent - The exponent to use
+		/// @param output - Where to write the results; Must be the same size as `bases`, and may
+		/// be the same memory
+		inline static auto pow(utils::Span<const FloatType> bases,
+							   FloatType exponent,
+							   utils::Span<FloatType> output) noexcept -> void {
+			transform(bases, output, [exponent](FloatType base) {
+				return powKernel(base, exponent);
+			});
+		}
+
+		/// @brief Calculates e^x for a block of exponents.
+		///
+		/// Like the block `pow`, this has no branches, so the compiler can vectorize it. The
+		/// exponents are reduced by multiples of ln(2) split into two parts, so the result is
+		/// within a couple of ULP over the whole range. Results are clamped to the normal range
+		/// of `FloatType`. For double, this evaluates the single value `exp` instead: with two
+		/// doubles to a vector, the full length series costs more per value than the `Balanced`
+		/// approximation, and the `Fast` and `Precise` tiers use the same kernel either way
+		///
+		/// @param input - The exponents
+		/// @param output - Where to write the results; Must be the same size as `input`, and may
+		/// be the same memory
+		inline static auto
+		exp(utils::Span<const FloatType> input, utils::Span<FloatType> output) noexcept -> void {
+			transform(input, output, [](FloatType x) {
+				if constexpr(IS_FLOAT) {
+					return exponentialKernel<POW_TERMS>(x, NATURAL);
+				}
+				else {
+					return exp(x);
+				}
+			});
+		}
+
+		/// @brief Calculates 2^x for a block of exponents. See the block `exp`
+		///
+		/// @param input - The exponents
+		/// @param output - Where to write the results; Must be the same size as `input`, and may
+		/// be the same memory
+		inline static auto
+		pow2(utils::Span<const FloatType> input, utils::Span<FloatType> output) noexcept -> void {
+			transform(input, output, [](FloatType x) {
+				if constexpr(IS_FLOAT) {
+					return exponentialKernel<POW_TERMS>(x, BINARY);
+				}
+				else {
+					return pow2(x);
+				}
+			});
+		}
+
+		/// @brief Calculates 10^x for a block of exponents. See the block `exp`
+		///
+		/// @param input - The exponents
+		/// @param output - Where to write the results; Must be the same size as `input`, and may
+		/// be the same memory
+		inline static auto
+		pow10(utils::Span<const FloatType> input, utils::Span<FloatType> output) noexcept -> void {
+			transform(input, output, [](FloatType x) {
+				if constexpr(IS_FLOAT) {
+					return exponentialKernel<POW_TERMS>(x, DECIMAL);
+				}
+				else {
+					return pow10(x);
+				}
+			});
+		}
+
+		/// @brief Calculates ln(x) for a block of inputs.
+		///
+		/// Like the block `pow`, this has no branches, so the compiler can vectorize it. The
+		/// result is within a couple of ULP. Inputs must be positive and normal; Zero gives a
+		/// finite value below the log of the smallest normal
+		///
+		/// @param input - The inputs
+		/// @param output - Where to write the results; Must be the same size as `input`, and may
+		/// be the same memory
+		inline static auto
+		ln(utils::Span<const FloatType> input, utils::Span<FloatType> output) noexcept -> void {
+			transform(input, output, [](FloatType x) {
+				return logarithmKernel<LOG_TERMS>(x, NATURAL);
+			});
+		}
+
+		/// @brief Calculates log_2(x) for a block of inputs. See the block `ln`
+		///
+		/// @param input - The inputs
+		/// @param output - Where to write the results; Must be the same size as `input`, and may
+		/// be the same memory
+		inline static auto
+		log2(utils::Span<const FloatType> input, utils::Span<FloatType> output) noexcept -> void {
+			transform(input, output, [](FloatType x) {
+				return logarithmKernel<LOG_TERMS>(x, BINARY);
+			});
+		}
+
+		/// @brief Calculates log_10(x) for a block of inputs. See the block `ln`
+		///
+		/// @param input - The inputs
+		/// @param output - Where to write the results; Must be the same size as `input`, and may
+		/// be the same memory
+		inline static auto
+		log10(utils::Span<const FloatType> input, utils::Span<FloatType> output) noexcept -> void {
+			transform(input, output, [](FloatType x) {
+				return logarithmKernel<LOG_TERMS>(x, DECIMAL);
+			});
+		}
+
 	  private:
+		/// The unsigned integer type with the same size as `FloatType`
+		using Bits = std::conditional_t<std::is_same_v<FloatType, float>, uint32_t, uint64_t>;
+		/// The signed integer type with the same size as `FloatType`
+		using Integer = std::conditional_t<std::is_same_v<FloatType, float>, int32_t, int64_t>;
+
+		/// The number of explicit mantissa bits of `FloatType`
+		static constexpr Bits MANTISSA_BITS = std::numeric_limits<FloatType>::digits - 1;
+		/// The bias of `FloatType`'s exponent
+		static constexpr Integer EXPONENT_BIAS = std::numeric_limits<FloatType>::max_exponent - 1;
+		/// ln(2)
+		static constexpr double LN_TWO
+			= 0.6931471805599453094172321214581765680755001343602552541206800094;
+		/// The number of terms of the series the block kernels evaluate, enough for `FloatType`'s
+		/// precision
+		static constexpr size_t NUM_LOG_TERMS = std::is_same_v<FloatType, float> ? 5 : 11;
+		static constexpr size_t NUM_POW_TERMS = std::is_same_v<FloatType, float> ? 8 : 14;
+		/// The number of terms the `Fast` tier evaluates, enough for around 1e-4 relative error
+		static constexpr size_t FAST_LOG_TERMS = 2;
+		static constexpr size_t FAST_POW_TERMS = 5;
+		/// The number of terms evaluated at `Tier`
+		static constexpr size_t LOG_TERMS = Tier == Accuracy::Fast ? FAST_LOG_TERMS : NUM_LOG_TERMS;
+		static constexpr size_t POW_TERMS = Tier == Accuracy::Fast ? FAST_POW_TERMS : NUM_POW_TERMS;
+
+		/// The coefficients of log_2(m) = 2 / ln(2) * atanh(z), z = (m - 1) / (m + 1), in odd
+		/// powers of z
+		static constexpr std::array<FloatType, NUM_LOG_TERMS> LOG_COEFFICIENTS = []() {
+			auto coefficients = std::array<FloatType, NUM_LOG_TERMS>();
+			for(size_t term = 0; term < NUM_LOG_TERMS; ++term) {
+				coefficients.at(term)
+					= static_cast<FloatType>(2.0 / (LN_TWO * static_cast<double>(2 * term + 1)));
+			}
+			return coefficients;
+		}();
+
+		/// The Taylor coefficients of 2^x = e^(x * ln(2)), ie ln(2)^k / k!
+		static constexpr std::array<FloatType, NUM_POW_TERMS> POW_COEFFICIENTS = []() {
+			auto coefficients = std::array<FloatType, NUM_POW_TERMS>();
+			auto coefficient = 1.0;
+			for(size_t term = 0; term < NUM_POW_TERMS; ++term) {
+				coefficients.at(term) = static_cast<FloatType>(coefficient);
+				coefficient *= LN_TWO / static_cast<double>(term + 1);
+			}
+			return coefficients;
+		}();
+
+		/// @brief The constants the block kernels need to work in a given base. `step` is
+		/// log_base(2), the amount of the input that changes the result's exponent by one.
+		/// `stepHigh` is `step` with its low mantissa bits cleared, so multiplying it by any
+		/// exponent is exact, and `stepLow` is the rest of `step`
+		struct Radix {
+			FloatType step;
+			FloatType stepHigh;
+			FloatType stepLow;
+			/// log_2(base), ie 1 / `step`
+			FloatType inverseStep;
+			/// The largest magnitude of exponent `exponentialKernel` accepts: just under
+			/// `EXPONENT_BIAS` - 1 steps, so rounding can't take the result out of the normal range
+			FloatType limit;
+		};
+
+		/// Whether `FloatType` is float, for the constants that differ with precision
+		static constexpr bool IS_FLOAT = std::is_same_v<FloatType, float>;
+		/// log_10(2)
+		static constexpr double LOG10_TWO
+			= 0.3010299956639811952137388947244930267681898814621085413104274611;
+		/// Shrinks a limit by a few ULP
+		static constexpr double LIMIT_SCALE
+			= 1.0 - 4.0 * static_cast<double>(std::numeric_limits<FloatType>::epsilon());
+		/// Clears the bits of a value below its high 32, which leaves float unchanged. Limits are
+		/// rounded down with it, so `exponentialKernel` can compare magnitudes against them on
+		/// their high 32 bits alone
+		static constexpr Bits HIGH_WORD_MASK = ~static_cast<Bits>(0) << (sizeof(Bits) * 8 - 32);
+
+		static constexpr Radix BINARY = {static_cast<FloatType>(1.0),
+										 static_cast<FloatType>(1.0),
+										 static_cast<FloatType>(0.0),
+										 static_cast<FloatType>(1.0),
+										 static_cast<FloatType>(EXPONENT_BIAS - 1)};
+		static constexpr Radix NATURAL
+			= {static_cast<FloatType>(LN_TWO),
+			   static_cast<FloatType>(IS_FLOAT ? 0.693115234375 : 0.693147180559663),
+			   static_cast<FloatType>(IS_FLOAT ? 3.194618329871446e-05 : 2.8235290563031577e-13),
+			   static_cast<FloatType>(
+				   1.4426950408889634073599246810018921374266459541529859341354494069),
+			   std::bit_cast<FloatType>(
+				   std::bit_cast<Bits>(static_cast<FloatType>(
+					   static_cast<double>(EXPONENT_BIAS - 1) * LN_TWO * LIMIT_SCALE))
+				   & HIGH_WORD_MASK)};
+		static constexpr Radix DECIMAL
+			= {static_cast<FloatType>(LOG10_TWO),
+			   static_cast<FloatType>(IS_FLOAT ? 0.301025390625 : 0.30102999566383914),
+			   static_cast<FloatType>(IS_FLOAT ? 4.605039066518657e-06 : 1.42050232272661e-13),
+			   static_cast<FloatType>(
+				   3.3219280948873623478703194294893901758648313930245806120547563958),
+			   std::bit_cast<FloatType>(
+				   std::bit_cast<Bits>(static_cast<FloatType>(
+					   static_cast<double>(EXPONENT_BIAS - 1) * LOG10_TWO * LIMIT_SCALE))
+				   & HIGH_WORD_MASK)};
+
+		/// The number of low mantissa bits cleared to split a value into a high part with about
+		/// half its bits and a low part with the rest. Either part times an exponent of
+		/// `FloatType`, which has at most 11 bits, is exact
+		static constexpr Bits SPLIT_BITS = (MANTISSA_BITS + 1) / 2;
+		/// Clears the low `SPLIT_BITS` bits of a value
+		static constexpr Bits SPLIT_MASK = ~((static_cast<Bits>(1) << SPLIT_BITS) - 1);
+
+		/// 2^11 + 0.5: adding it to an exponent of at most 2^11 in magnitude makes it positive, so
+		/// converting the sum to an integer, which truncates, rounds the exponent to the nearest
+		/// integer, plus `ROUNDING_BIAS`. The kernels round with conversions, rather than by
+		/// adding and subtracting a large constant, because fast-math folds that back to the
+		/// unrounded value. 32 bit conversions vectorize for double, too, up to AVX2
+		static constexpr FloatType ROUNDING_OFFSET = static_cast<FloatType>(2048.5);
+		/// The integer part of `ROUNDING_OFFSET`
+		static constexpr int32_t ROUNDING_BIAS = 2048;
+
+		/// @brief Applies `kernel` to each element of `input`, writing the results to `output`.
+		/// The kernels have no branches, so the compiler can vectorize the loop
+		///
+		/// @param input - The inputs
+		/// @param output - Where to write the results; Must be the same size as `input`, and may
+		/// be the same memory
+		/// @param kernel - The function to apply
+		template<typename Kernel>
+		inline static auto transform(utils::Span<const FloatType> input,
+									 utils::Span<FloatType> output,
+									 Kernel kernel) noexcept -> void {
+			const auto* in = input.data();
+			auto* out = output.data();
+			const auto size = input.size();
+			for(size_t index = 0; index < size; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[index] = kernel(in[index]);
+			}
+		}
+
+		/// @brief Branch-free log_base(x), for positive, normal `x`, used by the block functions.
+		/// Zero gives a finite value below the log of the smallest normal
+		///
+		/// @tparam Terms - The number of terms of the series to evaluate
+		/// @param x - The input
+		/// @param radix - The constants of the base
+		/// @return - log_base(x)
+		template<size_t Terms = NUM_LOG_TERMS>
+		[[nodiscard]] inline static constexpr auto
+		logarithmKernel(FloatType x, const Radix& radix = BINARY) noexcept -> FloatType {
+			const auto [exponent, mantissaLog] = logarithmParts<Terms>(x);
+			// the exponent's part is exact, so its rounding doesn't swamp the mantissa's part
+			return exponent * radix.stepHigh
+				   + (exponent * radix.stepLow + mantissaLog * radix.step);
+		}
+
+		/// @brief Branch-free log_2(x), for positive, normal `x`, split into the exponent of `x`
+		/// and log_2 of its mantissa, which is in [-0.5, 0.5]
+		///
+		/// @tparam Terms - The number of terms of the series to evaluate
+		/// @param x - The input
+		/// @return - The exponent of `x`, an integer, and log_2 of its mantissa
+		template<size_t Terms = NUM_LOG_TERMS>
+		[[nodiscard]] inline static constexpr auto
+		logarithmParts(FloatType x) noexcept -> std::pair<FloatType, FloatType> {
+			constexpr auto mantissaMask = (static_cast<Bits>(1) << MANTISSA_BITS) - 1;
+			constexpr auto sqrtHalf
+				= std::bit_cast<Bits>(static_cast<FloatType>(0.70710678118654752440084436210485));
+			constexpr auto one = std::bit_cast<Bits>(static_cast<FloatType>(1.0));
+			// offsetting the bits by those of sqrt(1/2) splits x into an exponent and a mantissa
+			// in [sqrt(1/2), sqrt(2)), centred on one, where the series converges fastest, with
+			// integer operations only. The exponent is kept biased, so it's never negative
+			const auto offset = std::bit_cast<Bits>(x) - sqrtHalf + one;
+			const auto exponent
+				= static_cast<FloatType>(static_cast<int32_t>(offset >> MANTISSA_BITS)
+										 - static_cast<int32_t>(EXPONENT_BIAS));
+			const auto mantissa = std::bit_cast<FloatType>((offset & mantissaMask) + sqrtHalf);
+			const auto z = (mantissa - static_cast<FloatType>(1.0))
+						   / (mantissa + static_cast<FloatType>(1.0));
+			const auto zSquared = z * z;
+			auto series = LOG_COEFFICIENTS[Terms - 1];
+			for(auto term = Terms - 1; term > 0; --term) {
+				series = series * zSquared + LOG_COEFFICIENTS[term - 1];
+			}
+			return {exponent, z * series};
+		}
+
+		/// @brief Branch-free base^(x + low), used by the block functions. The exponent is
+		/// clamped to the radix's limit, so the result is always normal
+		///
+		/// @tparam Terms - The number of terms of the series to evaluate
+		/// @param x - The exponent, or its exact part
+		/// @param radix - The constants of the base
+		/// @param low - The rest of the exponent, for exponents carried in extra precision. The
+		/// nearest integer to the whole exponent is taken off `x`, exactly, before `low` is
+		/// added, so `low` is only rounded to the precision of the remainder
+		/// @return - base^(x + low)
+		template<size_t Terms = NUM_POW_TERMS>
+		[[nodiscard]] inline static constexpr auto
+		exponentialKernel(FloatType x,
+						  const Radix& radix = BINARY,
+						  FloatType low = static_cast<FloatType>(0.0)) noexcept -> FloatType {
+			constexpr auto signMask = static_cast<Bits>(1) << (sizeof(Bits) * 8 - 1);
+			const auto total = x + low;
+			// clamped on the high 32 bits of the magnitude, which order like the magnitudes
+			// themselves, and exactly so against the limits, whose low bits are clear. Unlike
+			// comparing doubles or 64 bit integers, that vectorizes with SSE2. With masks,
+			// rather than selects, which the compiler turns into branches: they'd stop it
+			// vectorizing the block functions, and fast-math would reassociate across them.
+			// NaN is out of range too, so it's never converted to an integer
+			const auto totalBits = std::bit_cast<Bits>(total);
+			const auto magnitudeHigh
+				= static_cast<int32_t>((totalBits & ~signMask) >> (sizeof(Bits) * 8 - 32));
+			const auto limitHigh
+				= static_cast<int32_t>(std::bit_cast<Bits>(radix.limit) >> (sizeof(Bits) * 8 - 32));
+			const auto rangeMask = static_cast<Bits>(
+				static_cast<Integer>(-static_cast<int32_t>(magnitudeHigh < limitHigh)));
+			const auto limitBits = std::bit_cast<Bits>(radix.limit) | (totalBits & signMask);
+			// the masked parts are added, as the compiler recognises or-ing them as a select,
+			// and can't vectorize that for double with SSE2
+			const auto clamped = std::bit_cast<FloatType>(totalBits & rangeMask)
+								 + std::bit_cast<FloatType>(limitBits & ~rangeMask);
+			const auto rounded = static_cast<int32_t>(clamped * radix.inverseStep + ROUNDING_OFFSET)
+								 - ROUNDING_BIAS;
+			const auto integer = static_cast<FloatType>(rounded);
+			// the remainder is taken in the base's units, where subtracting the high part of the
+			// step is exact, and only then converted to powers of two. It's masked on its own,
+			// so fast-math can't reassociate its subtraction with the smaller terms, which would
+			// round them to the precision of `x`. Beyond the limit, the result is just the
+			// nearest power of two
+			const auto remainder = std::bit_cast<FloatType>(
+				std::bit_cast<Bits>(x - integer * radix.stepHigh) & rangeMask);
+			const auto lowPart = std::bit_cast<FloatType>(std::bit_cast<Bits>(low) & rangeMask);
+			const auto fraction = remainder * radix.inverseStep
+								  - integer * (radix.stepLow * radix.inverseStep)
+								  + lowPart * radix.inverseStep;
+			auto series = POW_COEFFICIENTS[Terms - 1];
+			for(auto term = Terms - 1; term > 0; --term) {
+				series = series * fraction + POW_COEFFICIENTS[term - 1];
+			}
+			const auto scale = std::bit_cast<FloatType>(
+				static_cast<Bits>(rounded + static_cast<int32_t>(EXPONENT_BIAS)) << MANTISSA_BITS);
+			return series * scale;
+		}
+
+		/// @brief Branch-free base^exponent, with the series lengths of `Tier`, used by the block
+		/// `pow` and the scalar `pow` of the `Fast` and `Precise` tiers
+		///
+		/// @param base - The base to use; Must be non-negative. A base of zero gives zero
+		/// @param exponent - The exponent to use
+		/// @return - base^exponent
+		[[nodiscard]] inline static constexpr auto
+		powKernel(FloatType base, FloatType exponent) noexcept -> FloatType {
+			auto value = static_cast<FloatType>(0.0);
+			if constexpr(Tier == Accuracy::Precise) {
+				// 2^x turns an absolute error in x into a relative one, so rounding
+				// exponent * log_2(base) would cost up to a ULP per unit of its magnitude. It's
+				// carried in two parts instead: the base's exponent times the high half of
+				// `exponent` is exact, and the kernel takes its integer part off before adding
+				// the rest, so only the mantissa's part, at most half of `exponent` in
+				// magnitude, is rounded
+				const auto [baseExponent, mantissaLog] = logarithmParts<LOG_TERMS>(base);
+				const auto exponentHigh
+					= std::bit_cast<FloatType>(std::bit_cast<Bits>(exponent) & SPLIT_MASK);
+				const auto exponentLow = exponent - exponentHigh;
+				value = exponentialKernel<POW_TERMS>(baseExponent * exponentHigh,
+													  BINARY,
+													  exponent * mantissaLog
+														  + baseExponent * exponentLow);
+			}
+			else {
+				value = exponentialKernel<POW_TERMS>(exponent * logarithmKernel<LOG_TERMS>(base));
+			}
+			// masked rather than selected, and compared on the high 32 bits, for the same
+			// reasons as the clamp in `exponentialKernel`. For double, that takes the smallest
+			// subnormals as zero
+			const auto baseHigh
+				= static_cast<int32_t>(std::bit_cast<Bits>(base) >> (sizeof(Bits) * 8 - 32));
+			const auto mask = static_cast<Bits>(
+				static_cast<Integer>(-static_cast<int32_t>(baseHigh > 0)));
+			return std::bit_cast<FloatType>(std::bit_cast<Bits>(value) & mask);
+		}
+
 		/// @brief Calculates the mantissa and exponent of `x`,
 		/// in the representation x = mantissa * 2^exponent
 		///
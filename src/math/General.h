@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "Accuracy.h"
+
 namespace apex::math {
 
 #ifndef _MSC_VER
@@ -52,16 +54,22 @@ namespace apex::math {
 
 		/// @brief Fast approximation calculation of the square root of the given value
 		///
+		/// The `Fast` tier takes one Newton step from the initial guess, for around 2e-3 relative
+		/// error, `Balanced` takes two, and `Precise` takes enough for `FloatType`'s precision,
+		/// then corrects the rounding of the result
+		///
+		/// @tparam Tier - The accuracy of the approximation
 		/// @param x - The value to take the square root of
 		/// @return - The square root of x
-		template<typename FloatType = NumericType,
+		template<Accuracy Tier = Accuracy::Balanced,
+				 typename FloatType = NumericType,
 				 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
 		[[nodiscard]] inline static constexpr auto sqrt(FloatType x) noexcept -> FloatType {
 			if constexpr(std::is_same_v<FloatType, float>) {
-				return sqrtf_internal(x);
+				return sqrtf_internal<Tier>(x);
 			}
 			else {
-				return sqrt_internal(x);
+				return sqrt_internal<Tier>(x);
 			}
 		}
 
@@ -132,6 +140,7 @@ namespace apex::math {
 		///
 		/// @param x - The value to take the square root of
 		/// @return - The square root of x
+		template<Accuracy Tier = Accuracy::Balanced>
 		[[nodiscard]] static constexpr inline auto sqrtf_internal(float x) noexcept -> float {
 			const float xhalf = 0.5F * x;
 			union // get bits for floating value
@@ -143,7 +152,15 @@ namespace apex::math {
 			u.i = 0x5F375A86
 				  - (u.i >> 1); // gives initial guess y0. use 0x5fe6ec85e7de30da for double
 			u.f = u.f * (1.5F - xhalf * u.f * u.f); // Newton method, repeating increases accuracy
-			u.f = u.f * (1.5F - xhalf * u.f * u.f); // Newton method, repeating increases accuracy
+			if constexpr(Tier != Accuracy::Fast) {
+				u.f = u.f * (1.5F - xhalf * u.f * u.f);
+			}
+			if constexpr(Tier == Accuracy::Precise) {
+				u.f = u.f * (1.5F - xhalf * u.f * u.f);
+				// one Heron step on the root itself corrects the rounding of the reciprocal
+				const auto root = x * u.f;
+				return root + 0.5F * u.f * (x - root * root);
+			}
 			return x * u.f;
 		}
 
@@ -151,6 +168,7 @@ namespace apex::math {
 		///
 		/// @param x - The value to take the square root of
 		/// @return - The square root of x
+		template<Accuracy Tier = Accuracy::Balanced>
 		[[nodiscard]] static constexpr inline auto sqrt_internal(double x) noexcept -> double {
 			const double xhalf = 0.5 * x;
 			union // get bits for floating value
@@ -162,7 +180,16 @@ namespace apex::math {
 			u.i = 0x5fe6ec85e7de30da
 				  - (u.i >> 1); // gives initial guess y0. use 0x5fe6ec85e7de30da for double
 			u.f = u.f * (1.5 - xhalf * u.f * u.f); // Newton method, repeating increases accuracy
-			u.f = u.f * (1.5 - xhalf * u.f * u.f); // Newton method, repeating increases accuracy
+			if constexpr(Tier != Accuracy::Fast) {
+				u.f = u.f * (1.5 - xhalf * u.f * u.f);
+			}
+			if constexpr(Tier == Accuracy::Precise) {
+				u.f = u.f * (1.5 - xhalf * u.f * u.f);
+				u.f = u.f * (1.5 - xhalf * u.f * u.f);
+				// one Heron step on the root itself corrects the rounding of the reciprocal
+				const auto root = x * u.f;
+				return root + 0.5 * u.f * (x - root * root);
+			}
 			return x * u.f;
 		}
 	};
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "../utils/Span.h"
+
+namespace apex::math {
+#ifndef _MSC_VER
+	using std::int32_t;
+	using std::size_t;
+	using std::uint32_t;
+	using std::uint64_t;
+#endif //_MSC_VER
+
+	/// @brief The distributions a `RandomBank` can fill with
+	enum class RandomDistribution
+	{
+		/// Uniform over [-1, 1)
+		Uniform = 0,
+		/// Triangular over [-1, 1), ie the mean of two uniform values, as used for TPDF dither
+		Triangular
+	};
+
+	/// @brief Pseudo-random number generator that fills whole blocks at a time, for dither and
+	/// noise generation.
+	///
+	/// Runs `LANES` independent xoshiro128+ generators side by side. Each step of the bank is a
+	/// branch-free loop over the lanes using only 32 bit integer operations, so the compiler
+	/// can vectorize it, and produces `LANES` values at once. Each lane is seeded from a
+	/// different output of a SplitMix64 sequence started at the bank's seed, so the lanes are
+	/// independent of each other, and banks constructed with different seeds (even
+	/// consecutive ones) are independent of each other
+	///
+	/// @tparam FloatType - The floating point type to generate, either float or double
+	///
+	/// @see Blackman and Vigna, "Scrambled Linear Pseudorandom Number Generators"
+	template<typename FloatType = float,
+			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
+	class RandomBank {
+	  public:
+		/// The number of generators run side by side
+		static constexpr size_t LANES = 8;
+		/// The seed used by default constructed `RandomBank`s
+		static constexpr uint64_t DEFAULT_SEED = 12345;
+
+		/// @brief Constructs a `RandomBank` seeded with `DEFAULT_SEED`
+		RandomBank() noexcept {
+			srand(DEFAULT_SEED);
+		}
+
+		/// @brief Constructs a `RandomBank` pre-seeded with the given value
+		///
+		/// @param seed - The seed to use
+		explicit RandomBank(uint64_t seed) noexcept {
+			srand(seed);
+		}
+
+		/// @brief Returns a seed no earlier call for this `FloatType` has returned, so every
+		/// `RandomBank` seeded with one has its own stream, independent of the others. Thread safe
+		///
+		/// @return - The seed
+		[[nodiscard]] static inline auto uniqueSeed() noexcept -> uint64_t {
+			static auto counter = std::atomic<uint64_t>(DEFAULT_SEED);
+			auto state = counter.fetch_add(1, std::memory_order_relaxed);
+			return splitMix(state);
+		}
+
+		/// @brief Seeds every lane of this `RandomBank` from the given value
+		///
+		/// @param seed - The seed to use
+		inline auto srand(uint64_t seed) noexcept -> void {
+			auto state = seed;
+			for(size_t lane = 0; lane < LANES; ++lane) {
+				const auto first = splitMix(state);
+				const auto second = splitMix(state);
+				mState0.at(lane) = static_cast<uint32_t>(first);
+				mState1.at(lane) = static_cast<uint32_t>(first >> 32U);
+				mState2.at(lane) = static_cast<uint32_t>(second);
+				// xoshiro's state must never be all zeros
+				mState3.at(lane) = static_cast<uint32_t>(second >> 32U) | 1U;
+			}
+			mNumLeftover = 0;
+		}
+
+		/// @brief Fills `output` with random values of the given distribution
+		///
+		/// Values are generated `LANES` at a time. Values left over from a fill are used first
+		/// by the next one (if it's of the same distribution), so the sequence doesn't depend on
+		/// how it's split into fills
+		///
+		/// @param output - The values to fill
+		/// @param distribution - The distribution of the values
+		inline auto fill(utils::Span<FloatType> output,
+						 RandomDistribution distribution = RandomDistribution::Uniform) noexcept
+			-> void {
+			auto* data = output.data();
+			const auto size = output.size();
+			if(distribution != mLeftoverDistribution) {
+				mNumLeftover = 0;
+			}
+
+			auto index = mNumLeftover < size ? mNumLeftover : size;
+			for(size_t value = 0; value < index; ++value) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				data[value] = mLeftover.at(LANES - mNumLeftover + value);
+			}
+			mNumLeftover -= index;
+
+			// whole steps are written straight to the output
+			const auto numWhole = ((size - index) / LANES) * LANES;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			generate(data + index, numWhole, distribution);
+			index += numWhole;
+
+			if(index < size) {
+				generate(mLeftover.data(), LANES, distribution);
+				const auto remaining = size - index;
+				for(size_t value = 0; value < remaining; ++value) {
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					data[index + value] = mLeftover.at(value);
+				}
+				mNumLeftover = LANES - remaining;
+				mLeftoverDistribution = distribution;
+			}
+		}
+
+	  private:
+		/// One value per lane
+		using Lanes = std::array<uint32_t, LANES>;
+
+		Lanes mState0 = Lanes();
+		Lanes mState1 = Lanes();
+		Lanes mState2 = Lanes();
+		Lanes mState3 = Lanes();
+		/// The values of the last step not used by the fill that generated them
+		std::array<FloatType, LANES> mLeftover = std::array<FloatType, LANES>();
+		size_t mNumLeftover = 0;
+		RandomDistribution mLeftoverDistribution = RandomDistribution::Uniform;
+
+		/// @brief Advances a SplitMix64 sequence, returning its next value
+		///
+		/// @param state - The state of the sequence
+		///
+		/// @return - The next value
+		static inline auto splitMix(uint64_t& state) noexcept -> uint64_t {
+			state += 0x9E3779B97F4A7C15U;
+			auto value = state;
+			value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9U;
+			value = (value ^ (value >> 27U)) * 0x94D049BB133111EBU;
+			return value ^ (value >> 31U);
+		}
+
+		/// @brief Steps every lane, writing their outputs, as signed values, to `output`
+		///
+		/// @param output - Where to write the outputs
+		/// @param state0 - The first word of each lane's state
+		/// @param state1 - The second word of each lane's state
+		/// @param state2 - The third word of each lane's state
+		/// @param state3 - The fourth word of each lane's state
+		static inline auto next(std::array<int32_t, LANES>& output,
+								Lanes& state0,
+								Lanes& state1,
+								Lanes& state2,
+								Lanes& state3) noexcept -> void {
+			for(size_t lane = 0; lane < LANES; ++lane) {
+				output.at(lane) = static_cast<int32_t>(state0.at(lane) + state3.at(lane));
+				const auto shifted = state1.at(lane) << 9U;
+				state2.at(lane) ^= state0.at(lane);
+				state3.at(lane) ^= state1.at(lane);
+				state1.at(lane) ^= state2.at(lane);
+				state0.at(lane) ^= state3.at(lane);
+				state2.at(lane) ^= shifted;
+				state3.at(lane) = (state3.at(lane) << 11U) | (state3.at(lane) >> 21U);
+			}
+		}
+
+		/// @brief Converts a random signed integer to a uniform value in [-1, 1)
+		///
+		/// @param value - The integer
+		///
+		/// @return - The uniform value
+		static inline auto toUniform(int32_t value) noexcept -> FloatType {
+			if constexpr(std::is_same_v<FloatType, float>) {
+				// the top 24 bits, which convert exactly and have the best quality
+				return static_cast<float>(value >> 8) * (1.0F / 8388608.0F);
+			}
+			else {
+				return static_cast<double>(value) * (1.0 / 2147483648.0);
+			}
+		}
+
+		/// @brief Fills `size` values from `output`, a multiple of `LANES`, with the given
+		/// distribution
+		///
+		/// @param output - The values to fill
+		/// @param size - The number of values
+		/// @param distribution - The distribution of the values
+		inline auto
+		generate(FloatType* output, size_t size, RandomDistribution distribution) noexcept -> void {
+			if(distribution == RandomDistribution::Triangular) {
+				generate<RandomDistribution::Triangular>(output, size);
+			}
+			else {
+				generate<RandomDistribution::Uniform>(output, size);
+			}
+		}
+
+		/// @brief Fills `size` values from `output`, a multiple of `LANES`, with the given
+		/// distribution
+		///
+		/// @tparam Distribution - The distribution of the values
+		///
+		/// @param output - The values to fill
+		/// @param size - The number of values
+		template<RandomDistribution Distribution>
+		inline auto generate(FloatType* output, size_t size) noexcept -> void {
+			// the state is kept in locals, so it stays in registers
+			auto state0 = mState0;
+			auto state1 = mState1;
+			auto state2 = mState2;
+			auto state3 = mState3;
+			auto first = std::array<int32_t, LANES>();
+			auto second = std::array<int32_t, LANES>();
+			for(size_t index = 0; index < size; index += LANES) {
+				next(first, state0, state1, state2, state3);
+				if constexpr(Distribution == RandomDistribution::Triangular) {
+					next(second, state0, state1, state2, state3);
+				}
+				for(size_t lane = 0; lane < LANES; ++lane) {
+					auto value = toUniform(first.at(lane));
+					if constexpr(Distribution == RandomDistribution::Triangular) {
+						value = (value + toUniform(second.at(lane))) * static_cast<FloatType>(0.5);
+					}
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+					output[index + lane] = value;
+				}
+			}
+			mState0 = state0;
+			mState1 = state1;
+			mState2 = state2;
+			mState3 = state3;
+		}
+	};
+} // namespace apex::math
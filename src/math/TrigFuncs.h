@@ -1,14 +1,27 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+
+#include "Accuracy.h"
 #include "Constants.h"
+#include "Exponentials.h"
 #include "General.h"
 
 namespace apex::math {
 
 	/// @brief Collection of approximations of various Trigonometric functions
 	///
+	/// The `Balanced` tier uses the rational and polynomial approximations of Jack Ganssle and
+	/// others. The `Fast` and `Precise` tiers reduce angles to [-pi/4, pi/4] by the nearest
+	/// multiple of pi/2 and evaluate Taylor series there, short and full length respectively;
+	/// `Precise` reduces in double, with pi/2 split in two, so the reduction is exact for any
+	/// angle of a reasonable size
+	///
 	/// @tparam Type - The floating point type to perform operations with
+	/// @tparam Tier - The accuracy of the approximations
 	template<typename FloatType = float,
+			 Accuracy Tier = Accuracy::Balanced,
 			 std::enable_if_t<std::is_floating_point_v<FloatType>, bool> = true>
 	class Trig {
 	  public:
@@ -17,7 +30,10 @@ namespace apex::math {
 		/// @param angle - The angle to calculate the cosine of
 		/// @return - The cosine of the angle
 		[[nodiscard]] static constexpr inline auto cos(FloatType angle) noexcept -> FloatType {
-			if constexpr(std::is_same_v<FloatType, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return sinCosKernel(angle, 1);
+			}
+			else if constexpr(std::is_same_v<FloatType, float>) {
 				return cosf_internal(angle);
 			}
 			else {
@@ -30,7 +46,10 @@ namespace apex::math {
 		/// @param angle - The angle to calculate the sine of
 		/// @return - The sine of the angle
 		[[nodiscard]] static constexpr inline auto sin(FloatType angle) noexcept -> FloatType {
-			if constexpr(std::is_same_v<FloatType, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return sinCosKernel(angle, 0);
+			}
+			else if constexpr(std::is_same_v<FloatType, float>) {
 				return sinf_internal(angle);
 			}
 			else {
@@ -43,7 +62,10 @@ namespace apex::math {
 		/// @param angle - The angle to calculate the tangent of
 		/// @return - The tangent of the angle
 		[[nodiscard]] static constexpr inline auto tan(FloatType angle) noexcept -> FloatType {
-			if constexpr(std::is_same_v<FloatType, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return tanKernel(angle);
+			}
+			else if constexpr(std::is_same_v<FloatType, float>) {
 				return tanf_internal(angle);
 			}
 			else {
@@ -56,7 +78,10 @@ namespace apex::math {
 		/// @param angle - The angle to calculate the arctangent of
 		/// @return - The arctangent of the angle
 		[[nodiscard]] static constexpr inline auto atan(FloatType angle) noexcept -> FloatType {
-			if constexpr(std::is_same_v<FloatType, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return atanKernel(angle);
+			}
+			else if constexpr(std::is_same_v<FloatType, float>) {
 				return atanf_internal(angle);
 			}
 			else {
@@ -69,7 +94,10 @@ namespace apex::math {
 		/// @param angle - The angle to calculate the hyperbolic tanget of
 		/// @return - The hyperbolic tangent of the angle
 		[[nodiscard]] static constexpr inline auto tanh(FloatType angle) noexcept -> FloatType {
-			if constexpr(std::is_same_v<FloatType, float>) {
+			if constexpr(Tier != Accuracy::Balanced) {
+				return tanhKernel(angle);
+			}
+			else if constexpr(std::is_same_v<FloatType, float>) {
 				return tanhf_internal(angle);
 			}
 			else {
@@ -78,6 +106,240 @@ namespace apex::math {
 		}
 
 	  private:
+		/// Whether `FloatType` is float, for the series lengths that differ with precision
+		static constexpr bool IS_FLOAT = std::is_same_v<FloatType, float>;
+		/// The number of terms of the sine and cosine series evaluated at `Tier`, enough for
+		/// around 1e-4 error at `Fast`, and `FloatType`'s precision at `Precise`
+		static constexpr size_t NUM_SINE_TERMS = Tier == Accuracy::Fast ? 3 : (IS_FLOAT ? 6 : 9);
+		/// The number of terms of the arctangent series evaluated at `Tier`
+		static constexpr size_t NUM_ATAN_TERMS = Tier == Accuracy::Fast ? 3 : (IS_FLOAT ? 6 : 14);
+		/// The number of terms of the e^x - 1 series `Precise` tanh evaluates for small angles
+		static constexpr size_t NUM_EXPM1_TERMS = IS_FLOAT ? 11 : 18;
+
+		/// The Taylor coefficients of sin(x) / x, in powers of x^2
+		static constexpr std::array<double, NUM_SINE_TERMS> SINE_COEFFICIENTS = []() {
+			auto coefficients = std::array<double, NUM_SINE_TERMS>();
+			auto coefficient = 1.0;
+			for(size_t term = 0; term < NUM_SINE_TERMS; ++term) {
+				coefficients.at(term) = coefficient;
+				coefficient /= -static_cast<double>((2 * term + 2) * (2 * term + 3));
+			}
+			return coefficients;
+		}();
+
+		/// The Taylor coefficients of cos(x), in powers of x^2
+		static constexpr std::array<double, NUM_SINE_TERMS> COSINE_COEFFICIENTS = []() {
+			auto coefficients = std::array<double, NUM_SINE_TERMS>();
+			auto coefficient = 1.0;
+			for(size_t term = 0; term < NUM_SINE_TERMS; ++term) {
+				coefficients.at(term) = coefficient;
+				coefficient /= -static_cast<double>((2 * term + 1) * (2 * term + 2));
+			}
+			return coefficients;
+		}();
+
+		/// The Taylor coefficients of arctan(x) / x, in powers of x^2
+		static constexpr std::array<double, NUM_ATAN_TERMS> ATAN_COEFFICIENTS = []() {
+			auto coefficients = std::array<double, NUM_ATAN_TERMS>();
+			for(size_t term = 0; term < NUM_ATAN_TERMS; ++term) {
+				coefficients.at(term)
+					= (term % 2 == 0 ? 1.0 : -1.0) / static_cast<double>(2 * term + 1);
+			}
+			return coefficients;
+		}();
+
+		/// The Taylor coefficients of (e^x - 1) / x, ie 1 / (k + 1)!
+		static constexpr std::array<double, NUM_EXPM1_TERMS> EXPM1_COEFFICIENTS = []() {
+			auto coefficients = std::array<double, NUM_EXPM1_TERMS>();
+			auto coefficient = 1.0;
+			for(size_t term = 0; term < NUM_EXPM1_TERMS; ++term) {
+				coefficients.at(term) = coefficient;
+				coefficient /= static_cast<double>(term + 2);
+			}
+			return coefficients;
+		}();
+
+		/// pi / 2 with its low 27 bits cleared, so multiplying it by any quadrant below 2^27 is
+		/// exact
+		static constexpr double PI_OVER_2_HIGH = 1.5707963109016418;
+		/// The rest of pi / 2
+		static constexpr double PI_OVER_2_LOW = 1.5893254773528196e-08;
+		/// tangent(pi / 6), ie 1 / sqrt(3)
+		static constexpr double TAN_PI_OVER_6 = 0.57735026918962576450914878050195745564760175;
+		/// tangent(pi / 12), ie 2 - sqrt(3)
+		static constexpr double TAN_PI_OVER_12 = 0.26794919243112270647255365849412763305719474;
+		/// Where `Precise` tanh switches from the e^x - 1 series to `Exponentials::exp`
+		static constexpr FloatType EXPM1_SERIES_LIMIT = static_cast<FloatType>(0.55);
+
+		/// @brief An angle reduced to [-pi/4, pi/4], and the multiple of pi/2 it was reduced by
+		struct Reduction {
+			FloatType angle;
+			int64_t quadrant;
+		};
+
+		/// @brief Reduces `angle` to [-pi/4, pi/4] by the nearest multiple of pi/2
+		///
+		/// @param angle - The angle to reduce
+		/// @return - The reduced angle and its quadrant
+		[[nodiscard]] static constexpr inline auto reduce(FloatType angle) noexcept -> Reduction {
+			if constexpr(Tier == Accuracy::Fast) {
+				const auto scaled = angle * Constants<FloatType>::twoOverPi;
+				const auto quadrant = static_cast<int64_t>(
+					scaled < static_cast<FloatType>(0.0) ? scaled - static_cast<FloatType>(0.5) :
+															scaled + static_cast<FloatType>(0.5));
+				return {angle - static_cast<FloatType>(quadrant) * Constants<FloatType>::piOver2,
+						quadrant};
+			}
+			else {
+				// in double, so float angles near multiples of pi keep their precision, and with
+				// the high part of pi/2 first, so its product is exact. Both parts are taken off
+				// at half scale, which is exact, as fast-math would otherwise merge the two
+				// products into one, with pi/2 rounded to double, losing the precision the split
+				// is for
+				const auto wide = static_cast<double>(angle);
+				const auto scaled = wide * Constants<double>::twoOverPi;
+				const auto quadrant
+					= static_cast<int64_t>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+				const auto nearest = static_cast<double>(quadrant);
+				const auto reduced
+					= ((wide - nearest * PI_OVER_2_HIGH) * 0.5 - nearest * (PI_OVER_2_LOW * 0.5))
+					  * 2.0;
+				return {static_cast<FloatType>(reduced), quadrant};
+			}
+		}
+
+		/// @brief The Taylor series of sine, for angles in [-pi/4, pi/4]
+		///
+		/// @param x - The reduced angle
+		/// @return - The sine of the angle
+		[[nodiscard]] static constexpr inline auto sineSeries(FloatType x) noexcept -> FloatType {
+			const auto x2 = x * x;
+			auto series = static_cast<FloatType>(SINE_COEFFICIENTS[NUM_SINE_TERMS - 1]);
+			for(auto term = NUM_SINE_TERMS - 1; term > 0; --term) {
+				series = series * x2 + static_cast<FloatType>(SINE_COEFFICIENTS[term - 1]);
+			}
+			return x * series;
+		}
+
+		/// @brief The Taylor series of cosine, for angles in [-pi/4, pi/4]
+		///
+		/// @param x - The reduced angle
+		/// @return - The cosine of the angle
+		[[nodiscard]] static constexpr inline auto
+		cosineSeries(FloatType x) noexcept -> FloatType {
+			const auto x2 = x * x;
+			auto series = static_cast<FloatType>(COSINE_COEFFICIENTS[NUM_SINE_TERMS - 1]);
+			for(auto term = NUM_SINE_TERMS - 1; term > 0; --term) {
+				series = series * x2 + static_cast<FloatType>(COSINE_COEFFICIENTS[term - 1]);
+			}
+			return series;
+		}
+
+		/// @brief Sine or cosine at the `Fast` and `Precise` tiers
+		///
+		/// @param angle - The angle to calculate the sine or cosine of
+		/// @param offset - The number of quarter turns to advance the angle by: 0 for the sine,
+		/// 1 for the cosine
+		/// @return - The sine of the advanced angle
+		[[nodiscard]] static constexpr inline auto
+		sinCosKernel(FloatType angle, int64_t offset) noexcept -> FloatType {
+			const auto reduction = reduce(angle);
+			const auto quadrant = reduction.quadrant + offset;
+			const auto value = (quadrant & 1) != 0 ? cosineSeries(reduction.angle) :
+													  sineSeries(reduction.angle);
+			return (quadrant & 2) != 0 ? -value : value;
+		}
+
+		/// @brief Tangent at the `Fast` and `Precise` tiers
+		///
+		/// @param angle - The angle to calculate the tangent of
+		/// @return - The tangent of the angle
+		[[nodiscard]] static constexpr inline auto
+		tanKernel(FloatType angle) noexcept -> FloatType {
+			const auto reduction = reduce(angle);
+			const auto sine = sineSeries(reduction.angle);
+			const auto cosine = cosineSeries(reduction.angle);
+			return (reduction.quadrant & 1) != 0 ? -cosine / sine : sine / cosine;
+		}
+
+		/// @brief Arctangent at the `Fast` and `Precise` tiers, with the same argument reduction
+		/// as the `Balanced` tier
+		///
+		/// @param angle - The angle to calculate the arctangent of
+		/// @return - The arctangent of the angle
+		[[nodiscard]] static constexpr inline auto
+		atanKernel(FloatType angle) noexcept -> FloatType {
+			constexpr auto one = static_cast<FloatType>(1.0);
+			constexpr auto tanPiOver6 = static_cast<FloatType>(TAN_PI_OVER_6);
+			const auto sign = angle < static_cast<FloatType>(0.0);
+			auto x = sign ? -angle : angle;
+			const auto complement = x > one;
+			if(complement) {
+				x = one / x;
+			}
+			const auto region = x > static_cast<FloatType>(TAN_PI_OVER_12);
+			if(region) {
+				x = (x - tanPiOver6) / (one + tanPiOver6 * x);
+			}
+
+			const auto x2 = x * x;
+			auto series = static_cast<FloatType>(ATAN_COEFFICIENTS[NUM_ATAN_TERMS - 1]);
+			for(auto term = NUM_ATAN_TERMS - 1; term > 0; --term) {
+				series = series * x2 + static_cast<FloatType>(ATAN_COEFFICIENTS[term - 1]);
+			}
+			auto y = x * series;
+			if(region) {
+				y += Constants<FloatType>::piOver6;
+			}
+			if(complement) {
+				y = Constants<FloatType>::piOver2 - y;
+			}
+			return sign ? -y : y;
+		}
+
+		/// @brief Hyperbolic tangent at the `Fast` and `Precise` tiers. `Fast` uses Lambert's
+		/// continued fraction, truncated to a 7/6 rational, which reaches one at about 4.97.
+		/// `Precise` uses tanh(x) = -m / (m + 2), m = e^(-2|x|) - 1
+		///
+		/// @param angle - The angle to calculate the hyperbolic tangent of
+		/// @return - The hyperbolic tangent of the angle
+		[[nodiscard]] static constexpr inline auto
+		tanhKernel(FloatType angle) noexcept -> FloatType {
+			constexpr auto one = static_cast<FloatType>(1.0);
+			if constexpr(Tier == Accuracy::Fast) {
+				constexpr auto c0 = static_cast<FloatType>(135135.0);
+				constexpr auto c1 = static_cast<FloatType>(17325.0);
+				constexpr auto c2 = static_cast<FloatType>(378.0);
+				constexpr auto c3 = static_cast<FloatType>(62370.0);
+				constexpr auto c4 = static_cast<FloatType>(3150.0);
+				constexpr auto c5 = static_cast<FloatType>(28.0);
+
+				const auto x2 = angle * angle;
+				const auto value = angle * (c0 + x2 * (c1 + x2 * (c2 + x2)))
+								   / (c0 + x2 * (c3 + x2 * (c4 + x2 * c5)));
+				return value > one ? one : (value < -one ? -one : value);
+			}
+			else {
+				const auto sign = angle < static_cast<FloatType>(0.0);
+				const auto x = static_cast<FloatType>(-2.0) * (sign ? -angle : angle);
+				auto minusOne = static_cast<FloatType>(0.0);
+				// for small angles e^x is close to one, and subtracting one would cancel most of
+				// its precision
+				if(x > -static_cast<FloatType>(2.0) * EXPM1_SERIES_LIMIT) {
+					auto series = static_cast<FloatType>(EXPM1_COEFFICIENTS[NUM_EXPM1_TERMS - 1]);
+					for(auto term = NUM_EXPM1_TERMS - 1; term > 0; --term) {
+						series = series * x + static_cast<FloatType>(EXPM1_COEFFICIENTS[term - 1]);
+					}
+					minusOne = x * series;
+				}
+				else {
+					minusOne = Exponentials<FloatType, Accuracy::Precise>::exp(x) - one;
+				}
+				const auto value = -minusOne / (minusOne + static_cast<FloatType>(2.0));
+				return sign ? -value : value;
+			}
+		}
+
 		/// @brief Helper function for `cosf`; Don't use on its own
 		///
 		/// @param x
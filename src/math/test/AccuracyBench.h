@@ -0,0 +1,99 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../test/Benchmark.h"
+#include "ApproximationError.h"
+#include "gtest/gtest.h"
+
+namespace apex::math::test {
+	using apex::test::BENCHMARK_BLOCK_SIZE;
+	using apex::test::benchmarkNanoseconds;
+	using apex::test::doNotOptimize;
+	using apex::test::reportBenchmark;
+	using apex::test::reportMeasurement;
+
+	/// @brief The cost and largest error of one approximation
+	struct AccuracyResult {
+		std::string name;
+		double nanoseconds;
+		double ulp;
+	};
+
+	/// @brief Times `function` a value at a time over the inputs of `approximated`, returning
+	/// ns/op
+	template<typename FloatType, typename Function>
+	inline auto
+	timeApproximation(const ApproximatedFunction& approximated, Function&& function) -> double {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+			// a stride coprime with the block size, so neighbouring inputs aren't similar
+			input.at(i) = inputAt<FloatType>(approximated,
+											 (i * 97U) % BENCHMARK_BLOCK_SIZE,
+											 BENCHMARK_BLOCK_SIZE);
+		}
+		// through pointers, so bounds checks don't stop the loop vectorizing where it can
+		const auto* in = input.data();
+		auto* out = output.data();
+		auto nanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				out[i] = function(in[i]);
+			}
+			doNotOptimize(output.back());
+		});
+		return nanos / static_cast<double>(BENCHMARK_BLOCK_SIZE);
+	}
+
+	/// @brief Measures each approximated function at `Tier`, adding its result to `results`,
+	/// after that of the standard library if it's the first tier measured
+	template<typename FloatType, Accuracy Tier>
+	inline auto measureTier(const std::string& typeName,
+							const std::string& tierName,
+							std::vector<std::vector<AccuracyResult>>& results) -> void {
+		auto index = 0U;
+		forEachApproximation<FloatType, Tier>(
+			[&](const ApproximatedFunction& function, auto approximation, auto reference) {
+				const auto separator = function.name.find("::");
+				const auto className = function.name.substr(0, separator);
+				const auto functionName = function.name.substr(separator);
+				if(results.size() <= index) {
+					const auto standard = [&reference](FloatType x) { return reference(x); };
+					const auto error = measureError<FloatType>(function, standard, reference);
+					results.push_back({{className + "<" + typeName + ">" + functionName + ", std",
+										timeApproximation<FloatType>(function, standard),
+										error.ulp}});
+				}
+				results.at(index).push_back(
+					{className + "<" + typeName + ", " + tierName + ">" + functionName,
+					 timeApproximation<FloatType>(function, approximation),
+					 measureError<FloatType>(function, approximation, reference).ulp});
+				++index;
+			});
+	}
+
+	template<typename FloatType>
+	inline auto benchmarkAccuracy(const std::string& typeName) -> void {
+		auto results = std::vector<std::vector<AccuracyResult>>();
+		measureTier<FloatType, Accuracy::Fast>(typeName, "Fast", results);
+		measureTier<FloatType, Accuracy::Balanced>(typeName, "Balanced", results);
+		measureTier<FloatType, Accuracy::Precise>(typeName, "Precise", results);
+
+		for(const auto& function : results) {
+			for(const auto& result : function) {
+				reportBenchmark(result.name, result.nanoseconds, "op");
+				reportMeasurement("ERROR", result.name, result.ulp, "ULP max");
+			}
+		}
+	}
+
+	TEST(AccuracyBench, tiersFloat) {
+		benchmarkAccuracy<float>("float");
+	}
+
+	TEST(AccuracyBench, tiersDouble) {
+		benchmarkAccuracy<double>("double");
+	}
+} // namespace apex::math::test
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "ApproximationError.h"
+#include "gtest/gtest.h"
+
+namespace apex::math::test {
+	/// @brief Checks every function approximated at `Tier` is within the error its tier promises
+	template<typename FloatType, Accuracy Tier>
+	inline auto checkAccuracy() -> void {
+		forEachApproximation<FloatType, Tier>(
+			[](const ApproximatedFunction& function, auto approximation, auto reference) {
+				const auto error = measureError<FloatType>(function, approximation, reference);
+				if constexpr(Tier == Accuracy::Fast) {
+					EXPECT_LE(function.fastErrorIsAbsolute ? error.absolute : error.relative,
+							  function.fastError)
+						<< function.name;
+				}
+				else {
+					EXPECT_LE(error.ulp, function.preciseUlp) << function.name;
+				}
+			});
+	}
+
+	TEST(AccuracyTest, fastFloat) {
+		checkAccuracy<float, Accuracy::Fast>();
+	}
+
+	TEST(AccuracyTest, fastDouble) {
+		checkAccuracy<double, Accuracy::Fast>();
+	}
+
+	TEST(AccuracyTest, preciseFloat) {
+		checkAccuracy<float, Accuracy::Precise>();
+	}
+
+	TEST(AccuracyTest, preciseDouble) {
+		checkAccuracy<double, Accuracy::Precise>();
+	}
+
+	TEST(AccuracyTest, constexprTiers) {
+		// the tiers other than `Balanced` are usable in constant expressions
+		constexpr auto exp = Exponentials<double, Accuracy::Precise>::exp(1.0);
+		constexpr auto sin = Trig<float, Accuracy::Fast>::sin(0.5F);
+		static_assert(exp > 2.718 && exp < 2.719);
+		static_assert(sin > 0.479F && sin < 0.480F);
+	}
+} // namespace apex::math::test
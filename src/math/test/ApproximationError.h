@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include "../Accuracy.h"
+#include "../Exponentials.h"
+#include "../General.h"
+#include "../TrigFuncs.h"
+
+namespace apex::math::test {
+	/// The number of inputs the error of an approximation is measured over
+	static const constexpr size_t NUM_ERROR_INPUTS = 100000;
+
+	/// @brief A function approximated at each `Accuracy` tier, the inputs its error is measured
+	/// over, and the accuracy promised at the `Fast` and `Precise` tiers
+	struct ApproximatedFunction {
+		std::string name;
+		double minInput;
+		double maxInput;
+		/// Whether the inputs are spread exponentially, rather than linearly
+		bool exponential;
+		/// The largest error accepted at the `Fast` tier
+		double fastError;
+		/// Whether `fastError` is absolute, rather than relative
+		bool fastErrorIsAbsolute;
+		/// The largest error, in ULP, accepted at the `Precise` tier
+		double preciseUlp;
+	};
+
+	/// @brief The largest errors of an approximation against the standard library
+	struct ApproximationError {
+		double ulp = 0.0;
+		double relative = 0.0;
+		double absolute = 0.0;
+	};
+
+	/// pi / 2 to 32 bits, so its product with any quadrant of the reference inputs is exact
+	static const constexpr long double REFERENCE_PI_OVER_2_HIGH = 1.570796326734125614166259765625L;
+	/// The rest of pi / 2
+	static const constexpr long double REFERENCE_PI_OVER_2_LOW
+		= 6.077100506506192601475144209858469968755291048747e-11L;
+
+	/// @brief The sine of `angle` advanced by `offset` quarter turns, from the standard library.
+	///
+	/// Fast-math evaluates long double sine and cosine with the x87 instructions, whose argument
+	/// reduction loses precision near multiples of pi, so long double angles, the reference, are
+	/// reduced here instead: by the high part of pi / 2, exactly, with the rest of pi / 2 applied
+	/// as a first order correction, which fast-math can't fold back into the reduction
+	///
+	/// @param angle - The angle to calculate the sine of
+	/// @param offset - The number of quarter turns to advance the angle by: 0 for the sine,
+	/// 1 for the cosine
+	/// @return - The sine of the advanced angle
+	template<typename FloatType>
+	inline auto standardSinCos(FloatType angle, int64_t offset) -> FloatType {
+		if constexpr(std::is_same_v<FloatType, long double>) {
+			const auto quadrant = std::llround(angle / REFERENCE_PI_OVER_2_HIGH);
+			const auto reduced
+				= angle - static_cast<long double>(quadrant) * REFERENCE_PI_OVER_2_HIGH;
+			const auto correction = -static_cast<long double>(quadrant) * REFERENCE_PI_OVER_2_LOW;
+			const auto sine = std::sin(reduced) + correction * std::cos(reduced);
+			const auto cosine = std::cos(reduced) - correction * std::sin(reduced);
+			switch((quadrant + offset) & 3) {
+				case 0: return sine;
+				case 1: return cosine;
+				case 2: return -sine;
+				default: return -cosine;
+			}
+		}
+		else {
+			return offset == 0 ? std::sin(angle) : std::cos(angle);
+		}
+	}
+
+	/// @brief The tangent of `angle` from the standard library, with long double angles reduced
+	/// as in `standardSinCos`
+	///
+	/// @param angle - The angle to calculate the tangent of
+	/// @return - The tangent of the angle
+	template<typename FloatType>
+	inline auto standardTan(FloatType angle) -> FloatType {
+		if constexpr(std::is_same_v<FloatType, long double>) {
+			return standardSinCos(angle, 0) / standardSinCos(angle, 1);
+		}
+		else {
+			return std::tan(angle);
+		}
+	}
+
+	/// @brief Returns the `index`th of `count` inputs spread over the range of `function`
+	template<typename FloatType>
+	inline auto
+	inputAt(const ApproximatedFunction& function, size_t index, size_t count) -> FloatType {
+		const auto position = static_cast<double>(index) / static_cast<double>(count - 1);
+		const auto input
+			= function.exponential ?
+				  function.minInput * std::pow(function.maxInput / function.minInput, position) :
+				  function.minInput + (function.maxInput - function.minInput) * position;
+		return static_cast<FloatType>(input);
+	}
+
+	/// @brief Measures the largest errors of `approximation` against `reference`, evaluated in
+	/// long double, over the inputs of `function`. ULP are those of `FloatType` at the
+	/// magnitude of the exact result
+	template<typename FloatType, typename Approximation, typename Reference>
+	inline auto measureError(const ApproximatedFunction& function,
+							 Approximation&& approximation,
+							 Reference&& reference) -> ApproximationError {
+		auto error = ApproximationError();
+		for(size_t index = 0; index < NUM_ERROR_INPUTS; ++index) {
+			const auto input = inputAt<FloatType>(function, index, NUM_ERROR_INPUTS);
+			const auto exact = reference(static_cast<long double>(input));
+			const auto absolute = static_cast<double>(
+				std::abs(static_cast<long double>(approximation(input)) - exact));
+			const auto exponent = exact == 0.0L ?
+									  std::numeric_limits<FloatType>::min_exponent - 1 :
+									  std::ilogb(exact);
+			const auto ulp = std::ldexp(
+				1.0,
+				std::max(exponent, std::numeric_limits<FloatType>::min_exponent - 1)
+					- (std::numeric_limits<FloatType>::digits - 1));
+
+			error.absolute = std::max(error.absolute, absolute);
+			error.ulp = std::max(error.ulp, absolute / ulp);
+			if(exact != 0.0L) {
+				error.relative
+					= std::max(error.relative, absolute / static_cast<double>(std::abs(exact)));
+			}
+		}
+		return error;
+	}
+
+	/// @brief Calls `callback` with each function approximated at each `Accuracy` tier, its
+	/// approximation at `Tier`, and its standard library equivalent, generic over the
+	/// floating point type
+	template<typename FloatType, Accuracy Tier, typename Callback>
+	inline auto forEachApproximation(Callback&& callback) -> void {
+		using Exponentials = Exponentials<FloatType, Tier>;
+		using Trig = Trig<FloatType, Tier>;
+		// the exponent `pow` is measured with
+		constexpr auto exponent = static_cast<FloatType>(1.7);
+
+		callback(ApproximatedFunction{"Exponentials::exp", -20.0, 20.0, false, 1.0e-4, false, 2.0},
+				 [](FloatType x) { return Exponentials::exp(x); },
+				 [](auto x) { return std::exp(x); });
+		callback(ApproximatedFunction{"Exponentials::pow2", -20.0, 20.0, false, 1.0e-4, false, 2.0},
+				 [](FloatType x) { return Exponentials::pow2(x); },
+				 [](auto x) { return std::exp2(x); });
+		callback(ApproximatedFunction{"Exponentials::pow10", -5.0, 5.0, false, 1.0e-4, false, 2.0},
+				 [](FloatType x) { return Exponentials::pow10(x); },
+				 [](auto x) { return std::pow(static_cast<decltype(x)>(10.0), x); });
+		// at the `Fast` tier, the error of log_2(base) is scaled by the exponent, so grows with
+		// the distance from one
+		callback(
+			ApproximatedFunction{"Exponentials::pow", 1.0e-3, 1.0e3, true, 5.0e-4, false, 3.0},
+			[](FloatType x) { return Exponentials::pow(x, exponent); },
+			[](auto x) { return std::pow(x, static_cast<decltype(x)>(exponent)); });
+		callback(ApproximatedFunction{"Exponentials::ln", 1.0e-5, 1.0e5, true, 5.0e-4, false, 4.0},
+				 [](FloatType x) { return Exponentials::ln(x); },
+				 [](auto x) { return std::log(x); });
+		callback(
+			ApproximatedFunction{"Exponentials::log2", 1.0e-5, 1.0e5, true, 5.0e-4, false, 4.0},
+			[](FloatType x) { return Exponentials::log2(x); },
+			[](auto x) { return std::log2(x); });
+		callback(
+			ApproximatedFunction{"Exponentials::log10", 1.0e-5, 1.0e5, true, 5.0e-4, false, 4.0},
+			[](FloatType x) { return Exponentials::log10(x); },
+			[](auto x) { return std::log10(x); });
+		callback(ApproximatedFunction{"Trig::sin", -7.0, 7.0, false, 5.0e-4, true, 3.0},
+				 [](FloatType x) { return Trig::sin(x); },
+				 [](auto x) { return standardSinCos(x, 0); });
+		callback(ApproximatedFunction{"Trig::cos", -7.0, 7.0, false, 5.0e-4, true, 3.0},
+				 [](FloatType x) { return Trig::cos(x); },
+				 [](auto x) { return standardSinCos(x, 1); });
+		callback(ApproximatedFunction{"Trig::tan", -1.5, 1.5, false, 1.0e-3, false, 4.0},
+				 [](FloatType x) { return Trig::tan(x); },
+				 [](auto x) { return standardTan(x); });
+		callback(ApproximatedFunction{"Trig::atan", -20.0, 20.0, false, 1.0e-4, true, 3.0},
+				 [](FloatType x) { return Trig::atan(x); },
+				 [](auto x) { return std::atan(x); });
+		callback(ApproximatedFunction{"Trig::tanh", -6.0, 6.0, false, 2.0e-4, true, 5.0},
+				 [](FloatType x) { return Trig::tanh(x); },
+				 [](auto x) { return std::tanh(x); });
+		callback(ApproximatedFunction{"General::sqrt", 1.0e-6, 1.0e6, true, 2.0e-3, false, 1.0},
+				 [](FloatType x) { return General<FloatType>::template sqrt<Tier>(x); },
+				 [](auto x) { return std::sqrt(x); });
+	}
+} // namespace apex::math::test
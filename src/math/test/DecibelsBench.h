@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+
+#include "../Decibels.h"
+#include "ExponentialsBench.h"
+#include "gtest/gtest.h"
+
+namespace apex::math::test {
+	/// @brief Times the conversions of `Decibels` a value at a time against their batch versions,
+	/// over the range of gain reductions and meter levels
+	template<typename FloatType>
+	inline auto benchmarkDecibels(const std::string& typeName) -> void {
+		const auto prefix = std::string("Decibels::");
+		const auto suffix = "<" + typeName + ">";
+		benchmarkExponential<FloatType>(
+			prefix + "toLinear" + suffix,
+			-100.0,
+			12.0,
+			false,
+			[](FloatType x) { return Decibels::decibelsToLinear(x); },
+			[](auto input, auto output) { Decibels::toLinear(input, output); });
+		benchmarkExponential<FloatType>(
+			prefix + "fromLinear" + suffix,
+			1.0e-5,
+			4.0,
+			true,
+			[](FloatType x) { return Decibels::linearToDecibels(x); },
+			[](auto input, auto output) { Decibels::fromLinear(input, output); });
+	}
+
+	TEST(DecibelsBench, throughputFloat) {
+		benchmarkDecibels<float>("float");
+	}
+
+	TEST(DecibelsBench, throughputDouble) {
+		benchmarkDecibels<double>("double");
+	}
+} // namespace apex::math::test
@@ -3,6 +3,9 @@
 #ifndef __MSC_VER
 	#include <cmath>
 #endif
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "../../test/TestConstants.h"
 #include "../Decibels.h"
@@ -10,6 +13,7 @@
 
 namespace apex::math::test {
 	using apex::test::DOUBLE_ACCEPTED_ERROR;
+	using apex::test::FLOAT_ACCEPTED_ERROR;
 
 	TEST(DecibelsTest, LinearToDecibelsFloatStaticCase0dB) {
 		float linear = 1.0F;
@@ -58,4 +62,94 @@ namespace apex::math::test {
 		double linear = std::pow(10.0, -3.0 / 20.0);
 		ASSERT_NEAR(linear, Decibels::decibelsToLinear(decibels), DOUBLE_ACCEPTED_ERROR);
 	}
+
+	TEST(DecibelsTest, DecibelsFStoresFloat) {
+		static_assert(std::is_same_v<decltype(DecibelsF().getDecibels()), float>);
+		auto decibels = DecibelsF::fromLinear(std::pow(10.0F, -3.0F / 20.0F));
+		ASSERT_NEAR(decibels.getDecibels(), -3.0F, FLOAT_ACCEPTED_ERROR);
+		ASSERT_FLOAT_EQ(decibels.getLinear(), DecibelsF::decibelsToLinear(decibels.getDecibels()));
+	}
+
+	TEST(DecibelsTest, DecibelsFConvertsToAndFromDecibels) {
+		// widening is implicit, and narrowing explicit
+		static_assert(std::is_convertible_v<DecibelsF, Decibels>);
+		static_assert(!std::is_convertible_v<Decibels, DecibelsF>);
+		static_assert(std::is_constructible_v<DecibelsF, Decibels>);
+
+		const auto single = DecibelsF(-6.0F);
+		const Decibels widened = single;
+		ASSERT_DOUBLE_EQ(widened.getDecibels(), -6.0);
+		ASSERT_FLOAT_EQ(DecibelsF(widened).getDecibels(), -6.0F);
+
+		// mixed arithmetic happens at the wider precision
+		const auto sum = Decibels(-3.0) + single;
+		static_assert(std::is_same_v<std::remove_const_t<decltype(sum)>, Decibels>);
+		ASSERT_DOUBLE_EQ(sum.getDecibels(), -9.0);
+		ASSERT_TRUE(Decibels(-6.0) == single);
+	}
+
+	TEST(DecibelsTest, GetLinearAtProcessingPrecision) {
+		const auto decibels = Decibels(-3.0);
+		static_assert(std::is_same_v<decltype(decibels.getLinear<float>()), float>);
+		ASSERT_NEAR(decibels.getLinear<float>(),
+					std::pow(10.0F, -3.0F / 20.0F),
+					FLOAT_ACCEPTED_ERROR);
+		ASSERT_NEAR(decibels.getLinear(), std::pow(10.0, -3.0 / 20.0), DOUBLE_ACCEPTED_ERROR);
+	}
+
+	/// @brief Checks the batch conversions of `Decibels` against the standard library, out of
+	/// place and in place, across the range of `MINUS_INFINITY_DB` to +24dB
+	template<typename FloatType>
+	inline auto checkBatchConversions() -> void {
+		constexpr auto numValues = 1001U;
+		auto decibels = std::vector<FloatType>(numValues);
+		for(auto i = 0U; i < numValues; ++i) {
+			decibels.at(i) = static_cast<FloatType>(-100.0 + 124.0 * i / (numValues - 1));
+		}
+		auto linear = std::vector<FloatType>(numValues);
+		auto roundTrip = std::vector<FloatType>(numValues);
+		const auto tolerance = 8.0 * std::numeric_limits<FloatType>::epsilon();
+
+		Decibels::toLinear(utils::Span<const FloatType>::MakeSpan(decibels.data(), numValues),
+						   utils::Span<FloatType>::MakeSpan(linear.data(), numValues));
+		for(auto i = 0U; i < numValues; ++i) {
+			if constexpr(std::is_same_v<FloatType, float>) {
+				const auto exponent = static_cast<double>(decibels.at(i)) / 20.0;
+				const auto expected = std::pow(10.0, exponent);
+				// the rounding of the exponent is amplified by ln(10) times its magnitude
+				ASSERT_NEAR(linear.at(i) / expected,
+							1.0,
+							tolerance * (1.0 + std::log(10.0) * std::abs(exponent)));
+			}
+			else {
+				// double is converted a value at a time
+				ASSERT_EQ(linear.at(i), Decibels::decibelsToLinear(decibels.at(i)));
+			}
+		}
+
+		Decibels::fromLinear(utils::Span<const FloatType>::MakeSpan(linear.data(), numValues),
+							 utils::Span<FloatType>::MakeSpan(roundTrip.data(), numValues));
+		for(auto i = 0U; i < numValues; ++i) {
+			const auto expected = 20.0 * std::log10(static_cast<double>(linear.at(i)));
+			ASSERT_NEAR(roundTrip.at(i), expected, tolerance * std::max(std::abs(expected), 1.0));
+		}
+
+		// in place, with zero floored at minus infinity dB
+		linear.at(0) = static_cast<FloatType>(0.0);
+		const auto inPlace = utils::Span<FloatType>::MakeSpan(linear.data(), numValues);
+		Decibels::fromLinear(utils::Span<const FloatType>::MakeSpan(linear.data(), numValues),
+							 inPlace);
+		ASSERT_EQ(linear.at(0), static_cast<FloatType>(Decibels::MINUS_INFINITY_DB));
+		for(auto i = 1U; i < numValues; ++i) {
+			ASSERT_EQ(linear.at(i), roundTrip.at(i));
+		}
+	}
+
+	TEST(DecibelsTest, BatchConversionsFloat) {
+		checkBatchConversions<float>();
+	}
+
+	TEST(DecibelsTest, BatchConversionsDouble) {
+		checkBatchConversions<double>();
+	}
 } // namespace apex::math::test
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../../test/Benchmark.h"
+#include "../Exponentials.h"
+#include "gtest/gtest.h"
+
+namespace apex::math::test {
+	using apex::test::BENCHMARK_BLOCK_SIZE;
+	using apex::test::benchmarkNanoseconds;
+	using apex::test::doNotOptimize;
+	using apex::test::reportBenchmark;
+
+	/// @brief Times a function of `Exponentials` a value at a time against its block version,
+	/// over inputs spread across [`minInput`, `maxInput`], exponentially if `exponential`
+	template<typename FloatType, typename Scalar, typename Block>
+	inline auto benchmarkExponential(const std::string& name,
+									 double minInput,
+									 double maxInput,
+									 bool exponential,
+									 Scalar&& scalar,
+									 Block&& block) -> void {
+		auto input = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto output = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+			// a stride coprime with the block size, so neighbouring inputs aren't similar
+			const auto position = static_cast<double>((i * 97U) % BENCHMARK_BLOCK_SIZE)
+								  / static_cast<double>(BENCHMARK_BLOCK_SIZE);
+			const auto value = exponential ?
+								   minInput * std::pow(maxInput / minInput, position) :
+								   minInput + (maxInput - minInput) * position;
+			input.at(i) = static_cast<FloatType>(value);
+		}
+		const auto inputSpan = utils::Span<const FloatType>::MakeSpan(input.data(), input.size());
+		const auto outputSpan = utils::Span<FloatType>::MakeSpan(output.data(), output.size());
+
+		auto scalarNanos = benchmarkNanoseconds([&]() {
+			for(auto i = 0U; i < BENCHMARK_BLOCK_SIZE; ++i) {
+				output.at(i) = scalar(input.at(i));
+			}
+			doNotOptimize(output.back());
+		});
+		auto blockNanos = benchmarkNanoseconds([&]() {
+			block(inputSpan, outputSpan);
+			doNotOptimize(output.back());
+		});
+
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark(name, scalarNanos / size);
+		reportBenchmark(name + ", block", blockNanos / size);
+	}
+
+	template<typename FloatType>
+	inline auto benchmarkExponentials(const std::string& typeName) -> void {
+		using Exponentials = Exponentials<FloatType>;
+		const auto prefix = "Exponentials<" + typeName + ">::";
+		benchmarkExponential<FloatType>(
+			prefix + "exp",
+			-10.0,
+			10.0,
+			false,
+			[](FloatType x) { return Exponentials::exp(x); },
+			[](auto input, auto output) { Exponentials::exp(input, output); });
+		benchmarkExponential<FloatType>(
+			prefix + "ln",
+			1.0e-5,
+			1.0e3,
+			true,
+			[](FloatType x) { return Exponentials::ln(x); },
+			[](auto input, auto output) { Exponentials::ln(input, output); });
+		// the range of Decibel conversions
+		benchmarkExponential<FloatType>(
+			prefix + "log10",
+			1.0e-5,
+			4.0,
+			true,
+			[](FloatType x) { return Exponentials::log10(x); },
+			[](auto input, auto output) { Exponentials::log10(input, output); });
+		benchmarkExponential<FloatType>(
+			prefix + "pow10",
+			-5.0,
+			0.6,
+			false,
+			[](FloatType x) { return Exponentials::pow10(x); },
+			[](auto input, auto output) { Exponentials::pow10(input, output); });
+	}
+
+	TEST(ExponentialsBench, throughputFloat) {
+		benchmarkExponentials<float>("float");
+	}
+
+	TEST(ExponentialsBench, throughputDouble) {
+		benchmarkExponentials<double>("double");
+	}
+} // namespace apex::math::test
@@ -3,6 +3,8 @@
 #ifndef __MSC_VER
 	#include <cmath>
 #endif
+#include <limits>
+#include <vector>
 
 #include "../../test/TestConstants.h"
 #include "../Exponentials.h"
@@ -168,4 +170,108 @@ namespace apex::math::test {
 					std::pow(base, exponent),
 					DOUBLE_ACCEPTED_ERROR);
 	}
+
+	TEST(ExponentialsTestDouble, powBlock) {
+		// bases spanning several decades, each side of one, and zero
+		auto bases = std::vector<double>(1024);
+		for(auto i = 0U; i < bases.size(); ++i) {
+			bases.at(i) = std::pow(10.0, -6.0 + 9.0 * i / bases.size());
+		}
+		bases.at(0) = 0.0;
+		auto results = std::vector<double>(bases.size());
+		for(auto exponent : {0.4, -2.123456, 3.7}) {
+			Exponentials<double>::pow(
+				utils::Span<const double>::MakeSpan(bases.data(), bases.size()),
+				exponent,
+				utils::Span<double>::MakeSpan(results.data(), results.size()));
+			ASSERT_EQ(results.at(0), 0.0);
+			for(auto i = 1U; i < bases.size(); ++i) {
+				const auto expected = std::pow(bases.at(i), exponent);
+				// a couple of ULP, plus up to one ULP per octave the result is away from one
+				const auto ulps = 2.0 + std::abs(std::log2(expected));
+				ASSERT_NEAR(results.at(i) / expected,
+							1.0,
+							ulps * std::numeric_limits<double>::epsilon());
+			}
+		}
+	}
+
+	TEST(ExponentialsTestDouble, expBlock) {
+		// the scalar tests' cases, then exponents across the range every base can represent
+		auto inputs = std::vector<double>{1.0, -1.0 / (44100.0 * 0.3), 3.0, 9.0, -2.123456};
+		for(auto i = 0; i <= 1000; ++i) {
+			inputs.push_back(-300.0 + 600.0 * i / 1000.0);
+		}
+		auto results = std::vector<double>(inputs.size());
+		const auto input = utils::Span<const double>::MakeSpan(inputs.data(), inputs.size());
+		const auto output = utils::Span<double>::MakeSpan(results.data(), results.size());
+		const auto check = [&](auto function) {
+			for(auto i = 0U; i < inputs.size(); ++i) {
+				const auto expected = function(inputs.at(i));
+				ASSERT_NEAR(results.at(i) / expected,
+							1.0,
+							2.0 * std::numeric_limits<double>::epsilon());
+			}
+		};
+
+		// the block kernels, which double only evaluates at the `Fast` and `Precise` tiers
+		using Precise = Exponentials<double, Accuracy::Precise>;
+		Precise::exp(input, output);
+		check([](double x) { return std::exp(x); });
+		Precise::pow2(input, output);
+		check([](double x) { return std::exp2(x); });
+		Precise::pow10(input, output);
+		// in long double, as fast-math evaluates pow(10, x) in double as exp(x ln(10)), which
+		// loses ULP to the rounding of x ln(10)
+		check([](double x) {
+			return static_cast<double>(std::pow(10.0L, static_cast<long double>(x)));
+		});
+
+		// beyond the range, results are clamped to normal values
+		inputs.at(0) = -1.0e4;
+		inputs.at(1) = 1.0e4;
+		Precise::exp(input, output);
+		ASSERT_TRUE(std::isnormal(results.at(0)));
+		ASSERT_TRUE(std::isnormal(results.at(1)));
+
+		// at the `Balanced` tier, the single value functions
+		inputs.at(0) = 1.0;
+		inputs.at(1) = -1.0 / (44100.0 * 0.3);
+		Exponentials<double>::exp(input, output);
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_EQ(results.at(i), Exponentials<double>::exp(inputs.at(i)));
+		}
+		Exponentials<double>::pow10(input, output);
+		for(auto i = 0U; i < inputs.size(); ++i) {
+			ASSERT_EQ(results.at(i), Exponentials<double>::pow10(inputs.at(i)));
+		}
+	}
+
+	TEST(ExponentialsTestDouble, lnBlock) {
+		// the scalar tests' cases, then inputs spanning the range, and either side of one
+		auto inputs = std::vector<double>{1.0, 3.0};
+		for(auto i = 0; i <= 1000; ++i) {
+			const auto decade = -300.0 + 600.0 * i / 1000.0;
+			inputs.push_back(std::pow(10.0, decade));
+			inputs.push_back(0.5 + 1.5 * i / 1000.0);
+		}
+		auto results = std::vector<double>(inputs.size());
+		const auto input = utils::Span<const double>::MakeSpan(inputs.data(), inputs.size());
+		const auto output = utils::Span<double>::MakeSpan(results.data(), results.size());
+		const auto check = [&](auto function) {
+			for(auto i = 0U; i < inputs.size(); ++i) {
+				const auto expected = function(inputs.at(i));
+				ASSERT_NEAR(results.at(i),
+							expected,
+							3.0 * std::numeric_limits<double>::epsilon() * std::abs(expected));
+			}
+		};
+
+		Exponentials<double>::ln(input, output);
+		check([](double x) { return std::log(x); });
+		Exponentials<double>::log2(input, output);
+		check([](double x) { return std::log2(x); });
+		Exponentials<double>::log10(input, output);
+		check([](double x) { return std::log10(x); });
+	}
 } // namespace apex::math::test
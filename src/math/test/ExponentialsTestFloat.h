@@ -3,6 +3,8 @@
 #ifndef __MSC_VER
 	#include <cmath>
 #endif
+#include <limits>
+#include <vector>
 
 #include "../../test/TestConstants.h"
 #include "../Exponentials.h"
@@ -160,4 +162,91 @@ namespace apex::math::test {
 					std::pow(base, exponent),
 					FLOAT_ACCEPTED_ERROR);
 	}
+
+	TEST(ExponentialsTestFloat, powfBlock) {
+		// bases spanning several decades, each side of one, and zero
+		auto bases = std::vector<float>(1024);
+		for(auto i = 0U; i < bases.size(); ++i) {
+			bases.at(i) = static_cast<float>(std::pow(10.0, -6.0 + 9.0 * i / bases.size()));
+		}
+		bases.at(0) = 0.0F;
+		auto results = std::vector<float>(bases.size());
+		for(auto exponent : {0.4F, -2.123456F, 3.7F}) {
+			Exponentials<float>::pow(
+				utils::Span<const float>::MakeSpan(bases.data(), bases.size()),
+				exponent,
+				utils::Span<float>::MakeSpan(results.data(), results.size()));
+			ASSERT_EQ(results.at(0), 0.0F);
+			for(auto i = 1U; i < bases.size(); ++i) {
+				const auto expected = std::pow(static_cast<double>(bases.at(i)),
+											   static_cast<double>(exponent));
+				// a couple of ULP, plus up to one ULP per octave the result is away from one
+				const auto ulps = 2.0 + std::abs(std::log2(expected));
+				ASSERT_NEAR(results.at(i) / expected,
+							1.0,
+							ulps * std::numeric_limits<float>::epsilon());
+			}
+		}
+	}
+
+	TEST(ExponentialsTestFloat, expfBlock) {
+		// the scalar tests' cases, then exponents across the range every base can represent
+		auto inputs = std::vector<float>{1.0F, -1.0F / (44100.0F * 0.3F), 3.0F, 9.0F, -2.123456F};
+		for(auto i = 0; i <= 1000; ++i) {
+			inputs.push_back(static_cast<float>(-37.0 + 74.0 * i / 1000.0));
+		}
+		auto results = std::vector<float>(inputs.size());
+		const auto input = utils::Span<const float>::MakeSpan(inputs.data(), inputs.size());
+		const auto output = utils::Span<float>::MakeSpan(results.data(), results.size());
+		const auto check = [&](auto function) {
+			for(auto i = 0U; i < inputs.size(); ++i) {
+				const auto expected = function(static_cast<double>(inputs.at(i)));
+				ASSERT_NEAR(results.at(i) / expected,
+							1.0,
+							2.0 * std::numeric_limits<float>::epsilon());
+			}
+		};
+
+		Exponentials<float>::exp(input, output);
+		check([](double x) { return std::exp(x); });
+		Exponentials<float>::pow2(input, output);
+		check([](double x) { return std::exp2(x); });
+		Exponentials<float>::pow10(input, output);
+		check([](double x) { return std::pow(10.0, x); });
+
+		// beyond the range, results are clamped to normal values
+		inputs.at(0) = -1.0e4F;
+		inputs.at(1) = 1.0e4F;
+		Exponentials<float>::exp(input, output);
+		ASSERT_TRUE(std::isnormal(results.at(0)));
+		ASSERT_TRUE(std::isnormal(results.at(1)));
+	}
+
+	TEST(ExponentialsTestFloat, lnfBlock) {
+		// the scalar tests' cases, then inputs spanning the range, and either side of one
+		auto inputs = std::vector<float>{1.0F, 3.0F};
+		for(auto i = 0; i <= 1000; ++i) {
+			const auto decade = -37.0 + 74.0 * i / 1000.0;
+			inputs.push_back(static_cast<float>(std::pow(10.0, decade)));
+			inputs.push_back(static_cast<float>(0.5 + 1.5 * i / 1000.0));
+		}
+		auto results = std::vector<float>(inputs.size());
+		const auto input = utils::Span<const float>::MakeSpan(inputs.data(), inputs.size());
+		const auto output = utils::Span<float>::MakeSpan(results.data(), results.size());
+		const auto check = [&](auto function) {
+			for(auto i = 0U; i < inputs.size(); ++i) {
+				const auto expected = function(static_cast<double>(inputs.at(i)));
+				ASSERT_NEAR(results.at(i),
+							expected,
+							3.0 * std::numeric_limits<float>::epsilon() * std::abs(expected));
+			}
+		};
+
+		Exponentials<float>::ln(input, output);
+		check([](double x) { return std::log(x); });
+		Exponentials<float>::log2(input, output);
+		check([](double x) { return std::log2(x); });
+		Exponentials<float>::log10(input, output);
+		check([](double x) { return std::log10(x); });
+	}
 } // namespace apex::math::test
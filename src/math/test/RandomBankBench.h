@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../test/Benchmark.h"
+#include "../Random.h"
+#include "../RandomBank.h"
+#include "gtest/gtest.h"
+
+namespace apex::math::test {
+	using apex::test::BENCHMARK_BLOCK_SIZE;
+	using apex::test::benchmarkNanoseconds;
+	using apex::test::doNotOptimize;
+	using apex::test::reportBenchmark;
+
+	template<typename FloatType>
+	inline auto benchmarkRandomBank(const std::string& typeName) -> void {
+		auto values = std::vector<FloatType>(BENCHMARK_BLOCK_SIZE);
+		auto span = utils::Span<FloatType>::MakeSpan(values.data(), values.size());
+
+		// the previous way: one scalar `Random` draw per value (two for triangular)
+		auto random = Random(1234);
+		const auto scale = static_cast<FloatType>(2.0 / static_cast<double>(Random::MAX));
+		auto uniformNanos = benchmarkNanoseconds([&]() {
+			for(auto& value : values) {
+				value = static_cast<FloatType>(random.rand()) * scale - static_cast<FloatType>(1.0);
+			}
+			doNotOptimize(values.back());
+		});
+		auto triangularNanos = benchmarkNanoseconds([&]() {
+			for(auto& value : values) {
+				value = (static_cast<FloatType>(random.rand())
+						 - static_cast<FloatType>(random.rand()))
+						* scale * static_cast<FloatType>(0.5);
+			}
+			doNotOptimize(values.back());
+		});
+
+		auto bank = RandomBank<FloatType>(1234);
+		auto bankUniformNanos = benchmarkNanoseconds([&]() {
+			bank.fill(span);
+			doNotOptimize(values.back());
+		});
+		auto bankTriangularNanos = benchmarkNanoseconds([&]() {
+			bank.fill(span, RandomDistribution::Triangular);
+			doNotOptimize(values.back());
+		});
+
+		auto size = static_cast<double>(BENCHMARK_BLOCK_SIZE);
+		reportBenchmark("Random -> " + typeName + ", uniform", uniformNanos / size);
+		reportBenchmark("Random -> " + typeName + ", triangular", triangularNanos / size);
+		reportBenchmark("RandomBank<" + typeName + ">, uniform", bankUniformNanos / size);
+		reportBenchmark("RandomBank<" + typeName + ">, triangular", bankTriangularNanos / size);
+	}
+
+	TEST(RandomBankBench, fillFloat) {
+		benchmarkRandomBank<float>("float");
+	}
+
+	TEST(RandomBankBench, fillDouble) {
+		benchmarkRandomBank<double>("double");
+	}
+} // namespace apex::math::test
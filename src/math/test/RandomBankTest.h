@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+#include "../RandomBank.h"
+
+namespace apex::math::test {
+
+	/// @brief Fills `size` values from a `RandomBank` with the given seed
+	template<typename FloatType>
+	inline auto generate(uint64_t seed,
+						 size_t size,
+						 RandomDistribution distribution = RandomDistribution::Uniform)
+		-> std::vector<FloatType> {
+		auto bank = RandomBank<FloatType>(seed);
+		auto values = std::vector<FloatType>(size);
+		bank.fill(utils::Span<FloatType>::MakeSpan(values.data(), values.size()), distribution);
+		return values;
+	}
+
+	/// @brief Returns the correlation of the values `lag` apart in `first` and `second`
+	template<typename FloatType>
+	inline auto correlation(const std::vector<FloatType>& first,
+							const std::vector<FloatType>& second,
+							size_t lag) -> double {
+		auto sum = 0.0;
+		auto firstSquares = 0.0;
+		auto secondSquares = 0.0;
+		for(auto i = 0U; i + lag < first.size(); ++i) {
+			const auto x = static_cast<double>(first.at(i));
+			const auto y = static_cast<double>(second.at(i + lag));
+			sum += x * y;
+			firstSquares += x * x;
+			secondSquares += y * y;
+		}
+		return sum / std::sqrt(firstSquares * secondSquares);
+	}
+
+	template<typename FloatType>
+	inline auto checkMoments(RandomDistribution distribution, double variance) -> void {
+		constexpr size_t size = 1U << 18U;
+		const auto values = generate<FloatType>(42, size, distribution);
+		auto mean = 0.0;
+		auto meanSquare = 0.0;
+		auto central = 0U;
+		for(auto value : values) {
+			ASSERT_GE(value, static_cast<FloatType>(-1.0));
+			ASSERT_LT(value, static_cast<FloatType>(1.0));
+			mean += static_cast<double>(value);
+			meanSquare += static_cast<double>(value) * static_cast<double>(value);
+			central += (value > static_cast<FloatType>(-0.5) && value < static_cast<FloatType>(0.5))
+						   ? 1U :
+							 0U;
+		}
+		mean /= static_cast<double>(size);
+		meanSquare /= static_cast<double>(size);
+		ASSERT_NEAR(mean, 0.0, 0.005);
+		ASSERT_NEAR(meanSquare - mean * mean, variance, 0.005);
+		// half of a uniform distribution, and three quarters of a triangular one, is within 0.5
+		const auto expected = distribution == RandomDistribution::Uniform ? 0.5 : 0.75;
+		ASSERT_NEAR(static_cast<double>(central) / static_cast<double>(size), expected, 0.005);
+	}
+
+	TEST(RandomBankTest, uniformFloat) {
+		checkMoments<float>(RandomDistribution::Uniform, 1.0 / 3.0);
+	}
+
+	TEST(RandomBankTest, uniformDouble) {
+		checkMoments<double>(RandomDistribution::Uniform, 1.0 / 3.0);
+	}
+
+	TEST(RandomBankTest, triangularFloat) {
+		checkMoments<float>(RandomDistribution::Triangular, 1.0 / 6.0);
+	}
+
+	TEST(RandomBankTest, triangularDouble) {
+		checkMoments<double>(RandomDistribution::Triangular, 1.0 / 6.0);
+	}
+
+	TEST(RandomBankTest, seeding) {
+		const auto first = generate<float>(7, 1024);
+		ASSERT_EQ(first, generate<float>(7, 1024));
+
+		// a shorter fill is the start of a longer one
+		const auto partial = generate<float>(7, 13);
+		for(auto i = 0U; i < partial.size(); ++i) {
+			ASSERT_EQ(partial.at(i), first.at(i));
+		}
+
+		// the sequence doesn't depend on how it's split into fills
+		auto split = RandomBank<float>(7);
+		auto splitValues = std::vector<float>(116);
+		for(auto [offset, size] : {std::pair<size_t, size_t>{0, 13}, {13, 100}, {113, 3}}) {
+			split.fill(utils::Span<float>::MakeSpan(&splitValues.at(offset), size));
+		}
+		for(auto i = 0U; i < splitValues.size(); ++i) {
+			ASSERT_EQ(splitValues.at(i), first.at(i));
+		}
+
+		// consecutive seeds are still independent streams
+		const auto second = generate<float>(8, 1024);
+		ASSERT_NE(first, second);
+		ASSERT_NEAR(correlation(first, second, 0), 0.0, 0.1);
+
+		auto bank = RandomBank<float>(7);
+		auto values = std::vector<float>(1024);
+		bank.fill(utils::Span<float>::MakeSpan(values.data(), values.size()));
+		bank.srand(7);
+		auto reseeded = std::vector<float>(1024);
+		bank.fill(utils::Span<float>::MakeSpan(reseeded.data(), reseeded.size()));
+		ASSERT_EQ(values, reseeded);
+	}
+
+	TEST(RandomBankTest, lanesAreIndependent) {
+		constexpr size_t size = 1U << 16U;
+		const auto values = generate<double>(3, size);
+		// neighbouring values come from neighbouring lanes, and values a whole step apart come
+		// from consecutive outputs of the same lane
+		for(auto lag : {1U, 2U, 7U, 8U, 16U}) {
+			ASSERT_NEAR(correlation(values, values, lag), 0.0, 0.02);
+		}
+	}
+} // namespace apex::math::test
@@ -0,0 +1,23 @@
+#include "../dsp/filters/test/BiQuadBankBench.h"
+#include "../dsp/filters/test/BiQuadBatchBench.h"
+#include "../dsp/filters/test/BiQuadCascadeBench.h"
+#include "../dsp/filters/test/BiQuadChunkedBench.h"
+#include "../dsp/filters/test/BiQuadFilterBench.h"
+#include "../dsp/filters/test/DitherQuantizerBench.h"
+#include "../dsp/filters/test/ResponseGridBench.h"
+#include "../dsp/filters/test/StateVariableFilterBench.h"
+#include "../dsp/processors/test/OverSamplerBench.h"
+#include "../dsp/processors/test/OversampledProcessorBench.h"
+#include "../dsp/test/WaveShaperADAABench.h"
+#include "../dsp/test/WaveShaperBench.h"
+#include "../dsp/test/WaveshaperTableBench.h"
+#include "../math/test/AccuracyBench.h"
+#include "../math/test/DecibelsBench.h"
+#include "../math/test/ExponentialsBench.h"
+#include "../math/test/RandomBankBench.h"
+#include "gtest/gtest.h"
+
+auto main(int argc, char** argv) -> int {
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -1,19 +1,34 @@
 #define TEST_HARNESS
 
+#include "../dsp/filters/test/BiQuadBankTest.h"
+#include "../dsp/filters/test/BiQuadBatchTest.h"
+#include "../dsp/filters/test/BiQuadCascadeTest.h"
+#include "../dsp/filters/test/BiQuadChunkedTest.h"
+#include "../dsp/filters/test/BiQuadFilterTest.h"
+#include "../dsp/filters/test/DitherQuantizerTest.h"
+#include "../dsp/filters/test/DitherTest.h"
+#include "../dsp/processors/test/EQBandTest.h"
+#include "../dsp/processors/test/EQCurveTest.h"
+#include "../dsp/test/WaveShaperADAATest.h"
 #include "../dsp/test/WaveShaperTest.h"
+#include "../dsp/test/WaveshaperTableTest.h"
+#include "../math/test/AccuracyTest.h"
 #include "../math/test/DecibelsTest.h"
 #include "../math/test/ExponentialsTestDouble.h"
 #include "../math/test/ExponentialsTestFloat.h"
 #include "../math/test/FrequencyTest.h"
 #include "../math/test/GeneralTestDouble.h"
 #include "../math/test/GeneralTestFloat.h"
+#include "../math/test/RandomBankTest.h"
 #include "../math/test/TrigFuncsTestDouble.h"
 #include "../math/test/TrigFuncsTestFloat.h"
+#include "../utils/test/AlignedBufferTest.h"
 #include "../utils/test/ChangeDetectorTest.h"
 #include "../utils/test/InterpolatorTest.h"
 #include "../utils/test/OptionTest.h"
 #include "../utils/test/ResultTest.h"
 #include "../utils/test/RingBufferTest.h"
+#include "../utils/test/TripleBufferTest.h"
 #include "gtest/gtest.h"
 
 auto main(int argc, char** argv) -> int {
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace apex::test {
+#ifndef _MSC_VER
+	using std::size_t;
+#endif //_MSC_VER
+
+	/// The number of samples processed per call in block benchmarks
+	static const constexpr size_t BENCHMARK_BLOCK_SIZE = 512;
+	/// The number of timed calls per benchmark
+	static const constexpr size_t BENCHMARK_ITERATIONS = 4096;
+	/// The number of untimed calls made before timing starts
+	static const constexpr size_t BENCHMARK_WARMUP_ITERATIONS = 256;
+
+	/// @brief Calls `func` `iterations` times and returns the average time per call, in
+	/// nanoseconds
+	///
+	/// @tparam Func - The type of the function to benchmark
+	///
+	/// @param func - The function to benchmark
+	/// @param iterations - The number of timed calls to make
+	///
+	/// @return - The average time per call, in nanoseconds
+	template<typename Func>
+	inline auto benchmarkNanoseconds(Func&& func, size_t iterations = BENCHMARK_ITERATIONS)
+		-> double {
+		for(size_t i = 0; i < BENCHMARK_WARMUP_ITERATIONS; ++i) {
+			func();
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		for(size_t i = 0; i < iterations; ++i) {
+			func();
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		return static_cast<double>(
+				   std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+			   / static_cast<double>(iterations);
+	}
+
+	/// @brief Prints the result of a benchmark in a consistent, grep-able format
+	///
+	/// @param name - The name of the benchmark
+	/// @param nanoseconds - The measured time
+	/// @param unit - The unit of work the time was measured for (eg "sample", "op")
+	inline auto reportBenchmark(const std::string& name,
+								double nanoseconds,
+								const std::string& unit = "sample") -> void {
+		std::cout << "[ BENCH    ] " << std::left << std::setw(56) << name << std::right
+				  << std::fixed << std::setprecision(3) << std::setw(12) << nanoseconds << " ns/"
+				  << unit << "\n";
+	}
+
+	/// @brief Prints a non-timing measurement (eg. a latency, or an error) alongside the
+	/// benchmark results, in the same format
+	///
+	/// @param tag - What kind of measurement this is, printed in place of "BENCH"
+	/// @param name - The name of the measurement
+	/// @param value - The measured value
+	/// @param unit - The unit of the value
+	inline auto reportMeasurement(const std::string& tag,
+								  const std::string& name,
+								  double value,
+								  const std::string& unit) -> void {
+		std::cout << "[ " << std::left << std::setw(9) << tag << "] " << std::setw(56) << name
+				  << std::right << std::fixed << std::setprecision(3) << std::setw(12) << value
+				  << " " << unit << "\n";
+	}
+
+	/// @brief Used to keep the optimizer from discarding the results of benchmarked code
+	///
+	/// @tparam T - The type of the value to keep alive
+	///
+	/// @param value - The value to keep alive
+	template<typename T>
+	inline auto doNotOptimize(T const& value) -> void {
+#if defined(_MSC_VER)
+		static_cast<void>(static_cast<const volatile T&>(value));
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+} // namespace apex::test
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Span.h"
+
+namespace apex::utils {
+	/// @brief Heap-allocated array whose storage is aligned to `Alignment` bytes, so block
+	/// processing over it can use aligned vector loads and never splits a cache line at its start.
+	///
+	/// Allocates only on construction and `resize`, so it's meant to be sized once, off the audio
+	/// thread (eg. in a `prepare` call), and then only read from and written to
+	///
+	/// @tparam T - The element type; Must be trivially destructible
+	/// @tparam Alignment - The alignment of the storage, in bytes; Must be a power of two
+	template<typename T, size_t Alignment = 64>
+	requires std::is_trivially_destructible_v<T> && std::is_default_constructible_v<T>
+			 && (Alignment >= alignof(T)) && ((Alignment & (Alignment - 1)) == 0)
+	class AlignedBuffer {
+	  public:
+		/// The alignment of the storage, in bytes
+		static const constexpr size_t ALIGNMENT = Alignment;
+
+		/// @brief Constructs an empty `AlignedBuffer`
+		AlignedBuffer() noexcept = default;
+
+		/// @brief Constructs an `AlignedBuffer` of `size` value-initialized elements
+		///
+		/// @param size - The number of elements
+		explicit AlignedBuffer(size_t size) noexcept {
+			resize(size);
+		}
+
+		AlignedBuffer(const AlignedBuffer& buffer) = delete;
+
+		/// @brief Move constructs an `AlignedBuffer` from the given one
+		///
+		/// @param buffer - The `AlignedBuffer` to move
+		AlignedBuffer(AlignedBuffer&& buffer) noexcept
+			: mData(std::move(buffer.mData)), mSize(std::exchange(buffer.mSize, 0)) {
+		}
+		~AlignedBuffer() noexcept = default;
+
+		/// @brief Reallocates this buffer to hold `size` value-initialized elements. The
+		/// previous contents are discarded. Allocates, so must not be called on the audio thread
+		///
+		/// @param size - The new number of elements
+		inline auto resize(size_t size) noexcept -> void {
+			if(size == mSize) {
+				fill(T());
+				return;
+			}
+
+			mData.reset();
+			mSize = 0;
+			if(size == 0) {
+				return;
+			}
+
+			auto* storage = static_cast<T*>(
+				::operator new[](size * sizeof(T), std::align_val_t(Alignment), std::nothrow));
+			if(storage == nullptr) {
+				return;
+			}
+			std::uninitialized_value_construct_n(storage, size);
+			mData.reset(storage);
+			mSize = size;
+		}
+
+		/// @brief Sets every element to the given value
+		///
+		/// @param value - The value to set
+		inline auto fill(const T& value) noexcept -> void {
+			for(auto& element : *this) {
+				element = value;
+			}
+		}
+
+		/// @brief Returns the number of elements
+		///
+		/// @return - The number of elements
+		[[nodiscard]] inline auto size() const noexcept -> size_t {
+			return mSize;
+		}
+
+		/// @brief Returns whether this buffer holds no elements
+		///
+		/// @return - Whether this is empty
+		[[nodiscard]] inline auto empty() const noexcept -> bool {
+			return mSize == 0;
+		}
+
+		/// @brief Returns the number of bytes of heap storage owned by this buffer
+		///
+		/// @return - The size of the storage, in bytes
+		[[nodiscard]] inline auto getMemoryFootprint() const noexcept -> size_t {
+			return mSize * sizeof(T);
+		}
+
+		[[nodiscard]] inline auto data() noexcept -> T* {
+			return mData.get();
+		}
+
+		[[nodiscard]] inline auto data() const noexcept -> const T* {
+			return mData.get();
+		}
+
+		/// @brief Returns the element at the given index, with bounds checking
+		///
+		/// @param index - The index of the element
+		///
+		/// @return - The element
+		[[nodiscard]] inline auto at(size_t index) noexcept -> T& {
+			return span().at(index);
+		}
+
+		/// @brief Returns the element at the given index, with bounds checking
+		///
+		/// @param index - The index of the element
+		///
+		/// @return - The element
+		[[nodiscard]] inline auto at(size_t index) const noexcept -> const T& {
+			return span().at(index);
+		}
+
+		/// @brief Returns a `Span` over the whole buffer
+		///
+		/// @return - The `Span`
+		[[nodiscard]] inline auto span() noexcept -> Span<T> {
+			return Span<T>::MakeSpan(mData.get(), mSize);
+		}
+
+		/// @brief Returns a `Span` over the whole buffer
+		///
+		/// @return - The `Span`
+		[[nodiscard]] inline auto span() const noexcept -> Span<const T> {
+			return Span<const T>::MakeSpan(mData.get(), mSize);
+		}
+
+		[[nodiscard]] inline auto begin() noexcept -> T* {
+			return mData.get();
+		}
+
+		[[nodiscard]] inline auto end() noexcept -> T* {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return mData.get() + mSize;
+		}
+
+		[[nodiscard]] inline auto begin() const noexcept -> const T* {
+			return mData.get();
+		}
+
+		[[nodiscard]] inline auto end() const noexcept -> const T* {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return mData.get() + mSize;
+		}
+
+		auto operator=(const AlignedBuffer& buffer) -> AlignedBuffer& = delete;
+		auto operator=(AlignedBuffer&& buffer) noexcept -> AlignedBuffer& {
+			mData = std::move(buffer.mData);
+			mSize = std::exchange(buffer.mSize, 0);
+			return *this;
+		}
+
+	  private:
+		/// @brief Frees storage allocated with `Alignment`
+		struct Deleter {
+			inline auto operator()(T* storage) const noexcept -> void {
+				::operator delete[](storage, std::align_val_t(Alignment));
+			}
+		};
+
+		std::unique_ptr<T[], Deleter> mData = std::unique_ptr<T[], Deleter>(); // NOLINT
+		size_t mSize = 0;
+	};
+} // namespace apex::utils
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "../Concepts.h"
+
+namespace apex::utils::synchronization {
+	/// @brief Lock-free, allocation-free handoff of a value from a single writer thread (eg. the
+	/// message thread) to a single reader thread (eg. the audio thread)
+	///
+	/// This is a double buffer (the writer's back buffer and the reader's front buffer) with a
+	/// third, shared buffer in between. The writer fills its back buffer and publishes it by
+	/// atomically swapping it with the shared one, and the reader picks up the latest published
+	/// value by swapping its front buffer with the shared one. Neither side ever waits on the
+	/// other: if the writer publishes several times between reads, only the latest value is seen
+	///
+	/// @tparam T - The type of the value to hand off
+	template<typename T>
+	requires concepts::DefaultConstructible<T> && concepts::Copyable<T>
+	class TripleBuffer {
+	  public:
+		/// @brief Constructs a `TripleBuffer` with default constructed values
+		TripleBuffer() noexcept = default;
+
+		/// @brief Constructs a `TripleBuffer` with every buffer set to the given value
+		///
+		/// @param initial - The initial value
+		explicit TripleBuffer(const T& initial) noexcept : mBuffers({initial, initial, initial}) {
+		}
+
+		TripleBuffer(const TripleBuffer& buffer) = delete;
+		TripleBuffer(TripleBuffer&& buffer) = delete;
+		~TripleBuffer() noexcept = default;
+
+		/// @brief Returns the writer's back buffer, to be filled in place before calling
+		/// `publish`. Must only be called from the writer thread
+		///
+		/// @return - The back buffer
+		[[nodiscard]] inline auto getBackBuffer() noexcept -> T& {
+			return mBuffers.at(mBackIndex);
+		}
+
+		/// @brief Publishes the back buffer to the reader, and takes ownership of a new back
+		/// buffer. Must only be called from the writer thread
+		inline auto publish() noexcept -> void {
+			const auto previous
+				= mShared.exchange(static_cast<uint8_t>(mBackIndex | NEW_DATA_FLAG),
+								   std::memory_order_acq_rel);
+			mBackIndex = static_cast<uint8_t>(previous & INDEX_MASK);
+		}
+
+		/// @brief Copies the given value into the back buffer and publishes it to the reader.
+		/// Must only be called from the writer thread
+		///
+		/// @param value - The value to publish
+		inline auto write(const T& value) noexcept -> void {
+			getBackBuffer() = value;
+			publish();
+		}
+
+		/// @brief Returns whether a value has been published since the reader last called
+		/// `update`
+		///
+		/// @return - Whether a new value is available
+		[[nodiscard]] inline auto hasNewData() const noexcept -> bool {
+			return (mShared.load(std::memory_order_relaxed) & NEW_DATA_FLAG) != 0;
+		}
+
+		/// @brief Picks up the latest published value, if there is one, making it available
+		/// through `read`. Must only be called from the reader thread
+		///
+		/// @return - Whether a new value was picked up
+		inline auto update() noexcept -> bool {
+			if(!hasNewData()) {
+				return false;
+			}
+
+			const auto previous = mShared.exchange(mFrontIndex, std::memory_order_acq_rel);
+			mFrontIndex = static_cast<uint8_t>(previous & INDEX_MASK);
+			return true;
+		}
+
+		/// @brief Returns the reader's front buffer, holding the value picked up by the last
+		/// call to `update`. Must only be called from the reader thread
+		///
+		/// @return - The front buffer
+		[[nodiscard]] inline auto read() const noexcept -> const T& {
+			return mBuffers.at(mFrontIndex);
+		}
+
+		auto operator=(const TripleBuffer& buffer) -> TripleBuffer& = delete;
+		auto operator=(TripleBuffer&& buffer) -> TripleBuffer& = delete;
+
+	  private:
+		/// Set in the shared index when it holds a value the reader has not picked up yet
+		static constexpr uint8_t NEW_DATA_FLAG = 0b100U;
+		static constexpr uint8_t INDEX_MASK = 0b011U;
+
+		static_assert(std::atomic<uint8_t>::is_always_lock_free,
+					  "TripleBuffer requires a lock-free std::atomic<uint8_t>");
+
+		std::array<T, 3> mBuffers = std::array<T, 3>();
+		/// Only touched by the reader
+		uint8_t mFrontIndex = 0;
+		/// Only touched by the writer
+		uint8_t mBackIndex = 1;
+		/// The index of the buffer between the two, and whether it holds new data
+		std::atomic<uint8_t> mShared = 2;
+	};
+} // namespace apex::utils::synchronization
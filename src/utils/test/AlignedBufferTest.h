@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <utility>
+
+#include "../AlignedBuffer.h"
+
+namespace apex::utils::test {
+
+	TEST(AlignedBufferTest, defaultIsEmpty) {
+		auto buffer = AlignedBuffer<float>();
+		ASSERT_TRUE(buffer.empty());
+		ASSERT_EQ(buffer.size(), 0U);
+		ASSERT_EQ(buffer.getMemoryFootprint(), 0U);
+		ASSERT_EQ(buffer.begin(), buffer.end());
+	}
+
+	TEST(AlignedBufferTest, sizedIsAlignedAndZeroed) {
+		auto buffer = AlignedBuffer<double, 64>(37);
+		ASSERT_EQ(buffer.size(), 37U);
+		ASSERT_EQ(buffer.getMemoryFootprint(), 37U * sizeof(double));
+		ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % 64, 0U); // NOLINT
+		for(auto value : buffer) {
+			ASSERT_EQ(value, 0.0);
+		}
+	}
+
+	TEST(AlignedBufferTest, resize) {
+		auto buffer = AlignedBuffer<float, 32>(8);
+		buffer.fill(1.0F);
+		ASSERT_EQ(buffer.at(7), 1.0F);
+
+		buffer.resize(8);
+		ASSERT_EQ(buffer.at(7), 0.0F);
+
+		buffer.resize(100);
+		ASSERT_EQ(buffer.size(), 100U);
+		ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % 32, 0U); // NOLINT
+		ASSERT_EQ(buffer.span().size(), 100U);
+
+		buffer.resize(0);
+		ASSERT_TRUE(buffer.empty());
+	}
+
+	TEST(AlignedBufferTest, move) {
+		auto buffer = AlignedBuffer<int>(4);
+		buffer.at(2) = 3;
+		const auto* data = buffer.data();
+
+		auto moved = std::move(buffer);
+		ASSERT_EQ(moved.data(), data);
+		ASSERT_EQ(moved.at(2), 3);
+		ASSERT_TRUE(buffer.empty()); // NOLINT(bugprone-use-after-move)
+
+		buffer = std::move(moved);
+		ASSERT_EQ(buffer.size(), 4U);
+		ASSERT_EQ(buffer.at(2), 3);
+	}
+} // namespace apex::utils::test
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "../synchronization/TripleBuffer.h"
+
+namespace apex::utils::synchronization::test {
+
+	TEST(TripleBufferTest, initialValue) {
+		auto buffer = TripleBuffer<int>(3);
+		ASSERT_FALSE(buffer.hasNewData());
+		ASSERT_FALSE(buffer.update());
+		ASSERT_EQ(buffer.read(), 3);
+	}
+
+	TEST(TripleBufferTest, writeThenUpdate) {
+		auto buffer = TripleBuffer<int>();
+		buffer.write(1);
+		ASSERT_TRUE(buffer.hasNewData());
+		ASSERT_EQ(buffer.read(), 0);
+		ASSERT_TRUE(buffer.update());
+		ASSERT_EQ(buffer.read(), 1);
+		ASSERT_FALSE(buffer.update());
+		ASSERT_EQ(buffer.read(), 1);
+	}
+
+	TEST(TripleBufferTest, latestValueWins) {
+		auto buffer = TripleBuffer<int>();
+		buffer.write(1);
+		buffer.write(2);
+		buffer.getBackBuffer() = 3;
+		buffer.publish();
+		ASSERT_TRUE(buffer.update());
+		ASSERT_EQ(buffer.read(), 3);
+		ASSERT_FALSE(buffer.update());
+	}
+
+	TEST(TripleBufferTest, concurrentHandoff) {
+		struct Pair {
+			int first = 0;
+			int second = 0;
+		};
+		constexpr auto numWrites = 100000;
+		auto buffer = TripleBuffer<Pair>();
+		auto done = std::atomic_bool(false);
+
+		auto writer = std::thread([&]() {
+			for(auto i = 1; i <= numWrites; ++i) {
+				buffer.write({i, -i});
+			}
+			done.store(true);
+		});
+
+		// every value read must be one that was written whole, and they must never go back
+		auto last = 0;
+		auto finished = false;
+		while(!finished) {
+			finished = done.load();
+			if(buffer.update()) {
+				const auto& value = buffer.read();
+				ASSERT_EQ(value.first, -value.second);
+				ASSERT_GT(value.first, last);
+				last = value.first;
+			}
+		}
+		writer.join();
+		ASSERT_EQ(last, numWrites);
+	}
+} // namespace apex::utils::synchronization::test
@@ -0,0 +1,5 @@
+#!/bin/zsh
+
+# the tests built with the Release flags, so the approximations are checked under fast-math.
+# Configure build-release like build, with -DCMAKE_BUILD_TYPE=Release
+cd build-release && ninja ApexTest && ./ApexTest --gtest_color=yes